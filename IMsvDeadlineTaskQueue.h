@@ -0,0 +1,116 @@
+/**************************************************************************************************//**
+* @addtogroup	MTHREADING
+* @{
+******************************************************************************************************/
+
+/**************************************************************************************************//**
+* @file
+* @brief			MarsTech Deadline Task Queue Interface
+* @details		Contains interface of thread safe earliest deadline first task queue.
+* @author		Martin Svoboda
+* @date			16.10.2026
+* @copyright	GNU General Public License (GPLv3).
+******************************************************************************************************/
+
+
+/*
+This file is part of MarsTech Threading.
+
+MarsTech Dependency Injection is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+MarsTech Promise Like Syntax is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with Foobar. If not, see <https://www.gnu.org/licenses/>.
+*/
+
+
+#ifndef MARSTECH_IDEADLINETASKQUEUE_H
+#define MARSTECH_IDEADLINETASKQUEUE_H
+
+
+#include "IMsvTask.h"
+
+#include "mheaders/MsvCompiler.h"
+MSV_DISABLE_ALL_WARNINGS
+
+#include <memory>
+#include <chrono>
+#include <cstddef>
+
+MSV_ENABLE_WARNINGS
+
+
+/**************************************************************************************************//**
+* @brief		MarsTech Deadline Task Queue Interface.
+* @details	Thread safe queue of jobs/tasks with absolute deadlines. Task with the earliest deadline is popped
+*				first (tasks with the same deadline are popped in first in first out order).
+* @see		IMsvTask
+******************************************************************************************************/
+class IMsvDeadlineTaskQueue
+{
+public:
+	/**************************************************************************************************//**
+	* @brief		Virtual destructor.
+	******************************************************************************************************/
+	virtual ~IMsvDeadlineTaskQueue() {};
+
+	/**************************************************************************************************//**
+	* @brief			Push job/task to queue.
+	* @param[in]	spTask		Shared pointer to @ref IMsvTask.
+	* @param[in]	deadline		Absolute deadline of the task.
+	* @returns		bool
+	* @retval		true	When task has been inserted.
+	* @retval		false	When queue is full (bounded queue) or allocation failed.
+	******************************************************************************************************/
+	virtual bool Push(std::shared_ptr<IMsvTask> spTask, std::chrono::steady_clock::time_point deadline) = 0;
+
+	/**************************************************************************************************//**
+	* @brief			Pop job/task with the earliest deadline from queue.
+	* @param[out]	deadline		Deadline of popped task.
+	* @returns		std::shared_ptr<IMsvTask>
+	* @retval		nullptr		When queue is empty.
+	******************************************************************************************************/
+	virtual std::shared_ptr<IMsvTask> Pop(std::chrono::steady_clock::time_point& deadline) = 0;
+
+	/**************************************************************************************************//**
+	* @brief			Push job/task to queue or drop task with the latest deadline.
+	* @details		When queue is full, task with the latest deadline (the least urgent one, the new task
+	*					included) is dropped to make room for more urgent task.
+	* @param[in]	spTask				Shared pointer to @ref IMsvTask.
+	* @param[in]	deadline				Absolute deadline of the task.
+	* @param[out]	spDroppedTask		Dropped task (spTask itself when it is the least urgent one, nullptr
+	*											when no task has been dropped).
+	* @returns		bool
+	* @retval		true	When task has been inserted or dropped.
+	* @retval		false	When allocation failed.
+	******************************************************************************************************/
+	virtual bool PushOrDropLatest(std::shared_ptr<IMsvTask> spTask, std::chrono::steady_clock::time_point deadline, std::shared_ptr<IMsvTask>& spDroppedTask) = 0;
+
+	/**************************************************************************************************//**
+	* @brief			Get queue size.
+	* @details		Returns count of tasks in the queue (without any lock).
+	* @returns		size_t
+	* @note			The value is only approximate when the queue is used by other threads.
+	******************************************************************************************************/
+	virtual size_t GetSize() const = 0;
+
+	/**************************************************************************************************//**
+	* @brief			Get queue capacity.
+	* @details		Returns maximal count of tasks in the queue.
+	* @returns		size_t
+	* @retval		0		When queue is unbounded.
+	******************************************************************************************************/
+	virtual size_t GetCapacity() const = 0;
+};
+
+
+#endif // MARSTECH_IDEADLINETASKQUEUE_H
+
+/** @} */	//End of group MTHREADING.
@@ -0,0 +1,123 @@
+/**************************************************************************************************//**
+* @addtogroup	MTHREADING
+* @{
+******************************************************************************************************/
+
+/**************************************************************************************************//**
+* @file
+* @brief			MarsTech Priority Task Queue Interface
+* @details		Contains interface of thread safe task queue with priority bands.
+* @author		Martin Svoboda
+* @date			16.10.2026
+* @copyright	GNU General Public License (GPLv3).
+******************************************************************************************************/
+
+
+/*
+This file is part of MarsTech Threading.
+
+MarsTech Dependency Injection is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+MarsTech Promise Like Syntax is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with Foobar. If not, see <https://www.gnu.org/licenses/>.
+*/
+
+
+#ifndef MARSTECH_IPRIORITYTASKQUEUE_H
+#define MARSTECH_IPRIORITYTASKQUEUE_H
+
+
+#include "IMsvTaskQueue.h"
+#include "MsvTaskPriority.h"
+
+#include "merror/MsvError.h"
+
+
+/**************************************************************************************************//**
+* @brief		MarsTech Priority Task Queue Interface.
+* @details	Thread safe queue of jobs/tasks with priority bands (see @ref MsvTaskPriority). Tasks with the
+*				same priority are popped in first in first out order. Methods of @ref IMsvTaskQueue use
+*				@ref MsvTaskPriority::MSV_TASK_PRIORITY_NORMAL for push and all bands for pop.
+* @see		IMsvTaskQueue
+* @see		MsvPriorityPolicy
+******************************************************************************************************/
+class IMsvPriorityTaskQueue:
+	public IMsvTaskQueue
+{
+public:
+	/**************************************************************************************************//**
+	* @brief		Virtual destructor.
+	******************************************************************************************************/
+	virtual ~IMsvPriorityTaskQueue() {};
+
+	//push and pop without priority are hidden by overloads
+	using IMsvTaskQueue::Push;
+	using IMsvTaskQueue::Pop;
+
+	/**************************************************************************************************//**
+	* @brief			Push job/task with priority to queue.
+	* @details		Inserts spTask at the end of the priority band.
+	* @param[in]	spTask		Shared pointer to @ref IMsvTask.
+	* @param[in]	priority		Task priority.
+	* @returns		bool
+	* @retval		true	When task has been inserted.
+	* @retval		false	When priority band is full (bounded queue) or allocation failed (unbounded queue).
+	******************************************************************************************************/
+	virtual bool Push(std::shared_ptr<IMsvTask> spTask, MsvTaskPriority priority) = 0;
+
+	/**************************************************************************************************//**
+	* @brief			Pop job/task from priority band.
+	* @details		Removes the first task from the priority band and returns it (other bands are ignored).
+	* @param[in]	priority		Task priority.
+	* @returns		std::shared_ptr<IMsvTask>
+	* @retval		nullptr		When priority band is empty.
+	******************************************************************************************************/
+	virtual std::shared_ptr<IMsvTask> Pop(MsvTaskPriority priority) = 0;
+
+	/**************************************************************************************************//**
+	* @brief			Set priority policy.
+	* @param[in]	policy		Priority policy.
+	* @returns		MsvErrorCode
+	* @retval		MSV_SUCCESS		On success.
+	* @warning		It must not be called when the queue is used by other threads.
+	******************************************************************************************************/
+	virtual MsvErrorCode SetPriorityPolicy(MsvPriorityPolicy policy) = 0;
+
+	/**************************************************************************************************//**
+	* @brief			Set priority weights.
+	* @details		Weights are used by @ref MsvPriorityPolicy::MSV_PRIORITY_WEIGHTED policy. Band is served
+	*					weight times in one round (e.g. 4, 2, 1 means 4 high, 2 normal and 1 low priority tasks).
+	* @param[in]	highWeight		Weight of high priority band.
+	* @param[in]	normalWeight	Weight of normal priority band.
+	* @param[in]	lowWeight		Weight of low priority band.
+	* @returns		MsvErrorCode
+	* @retval		MSV_INVALID_DATA_ERROR	When some weight is zero or sum of weights is too big.
+	* @retval		MSV_SUCCESS					On success.
+	* @warning		It must not be called when the queue is used by other threads.
+	******************************************************************************************************/
+	virtual MsvErrorCode SetPriorityWeights(uint32_t highWeight, uint32_t normalWeight, uint32_t lowWeight) = 0;
+
+	/**************************************************************************************************//**
+	* @brief			Set priority aging.
+	* @details		Lower priority band which has not been served for agingThreshold pops is served before
+	*					higher priority bands (lower priority tasks are never starved forever).
+	* @param[in]	agingThreshold		Count of pops (zero disables aging).
+	* @returns		MsvErrorCode
+	* @retval		MSV_SUCCESS		On success.
+	* @note			It can be called when the queue is used by other threads.
+	******************************************************************************************************/
+	virtual MsvErrorCode SetPriorityAging(uint32_t agingThreshold) = 0;
+};
+
+
+#endif // MARSTECH_IPRIORITYTASKQUEUE_H
+
+/** @} */	//End of group MTHREADING.
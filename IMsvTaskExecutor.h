@@ -0,0 +1,111 @@
+/**************************************************************************************************//**
+* @addtogroup	MTHREADING
+* @{
+******************************************************************************************************/
+
+/**************************************************************************************************//**
+* @file
+* @brief			MarsTech Task Executor Interface
+* @details		Defines interface of object which executes jobs/tasks (it is used by continuations).
+* @author		Martin Svoboda
+* @date			16.10.2026
+* @copyright	GNU General Public License (GPLv3).
+******************************************************************************************************/
+
+
+/*
+This file is part of MarsTech Threading.
+
+MarsTech Dependency Injection is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+MarsTech Promise Like Syntax is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with Foobar. If not, see <https://www.gnu.org/licenses/>.
+*/
+
+
+#ifndef MARSTECH_ITASKEXECUTOR_H
+#define MARSTECH_ITASKEXECUTOR_H
+
+
+#include "IMsvTask.h"
+#include "MsvFuture.h"
+
+#include "merror/MsvError.h"
+
+MSV_DISABLE_ALL_WARNINGS
+
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+MSV_ENABLE_WARNINGS
+
+
+/**************************************************************************************************//**
+* @brief		MarsTech Task Executor Interface.
+* @details	Common interface of thread pool and worker. Future remembers executor of its task and schedules
+*				continuations to it. Callable submitted to any executor returns typed future.
+* @see		IMsvThreadPool
+* @see		IMsvWorker
+* @see		MsvFuture::Then
+******************************************************************************************************/
+class IMsvTaskExecutor
+{
+public:
+	/**************************************************************************************************//**
+	* @brief		Virtual destructor.
+	******************************************************************************************************/
+	virtual ~IMsvTaskExecutor() {}
+
+	/**************************************************************************************************//**
+	* @brief			Add job/task to executor.
+	* @param[in]	spTask	Shared pointer to @ref IMsvTask. It will be executed by executor thread.
+	* @returns		MsvErrorCode
+	* @retval		MSV_SUCCESS					On success.
+	* @retval		other errors				When task has not been added.
+	******************************************************************************************************/
+	virtual MsvErrorCode AddTask(std::shared_ptr<IMsvTask> spTask) = 0;
+
+	/**************************************************************************************************//**
+	* @brief			Submit callable to executor.
+	* @details		Creates task which executes callable and stores its result (or exception) in the same
+	*					allocation and adds it as any other task.
+	* @param[in]	callable		Callable without parameters (it is moved or copied to the task).
+	* @returns		MsvFuture
+	* @retval		not valid future when task allocation or adding failed (see @ref MsvFuture::GetErrorCode).
+	* @see			MsvFuture
+	******************************************************************************************************/
+	template<typename Callable>
+	MsvFuture<typename std::result_of<typename std::decay<Callable>::type()>::type> Submit(Callable&& callable)
+	{
+		typedef typename std::decay<Callable>::type Function;
+		typedef typename std::result_of<Function()>::type Result;
+
+		std::shared_ptr<MsvFutureTask<Result, Function>> spTask(new (std::nothrow) MsvFutureTask<Result, Function>(std::forward<Callable>(callable)));
+		if (!spTask)
+		{
+			return MsvFuture<Result>(MSV_ALLOCATION_ERROR);
+		}
+
+		MsvErrorCode errorCode = AddTask(std::shared_ptr<IMsvTask>(spTask));
+		if (MSV_FAILED(errorCode))
+		{
+			return MsvFuture<Result>(errorCode);
+		}
+
+		return MsvFuture<Result>(spTask, this);
+	}
+};
+
+
+#endif // MARSTECH_ITASKEXECUTOR_H
+
+/** @} */	//End of group MTHREADING.
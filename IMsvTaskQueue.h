@@ -0,0 +1,112 @@
+/**************************************************************************************************//**
+* @addtogroup	MTHREADING
+* @{
+******************************************************************************************************/
+
+/**************************************************************************************************//**
+* @file
+* @brief			MarsTech Task Queue Interface
+* @details		Contains definition of @ref IMsvTaskQueue interface.
+* @author		Martin Svoboda
+* @date			16.10.2026
+* @copyright	GNU General Public License (GPLv3).
+******************************************************************************************************/
+
+
+/*
+This file is part of MarsTech Threading.
+
+MarsTech Dependency Injection is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+MarsTech Promise Like Syntax is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with Foobar. If not, see <https://www.gnu.org/licenses/>.
+*/
+
+
+#ifndef MARSTECH_ITASKQUEUE_H
+#define MARSTECH_ITASKQUEUE_H
+
+
+#include "IMsvTask.h"
+
+#include "mheaders/MsvCompiler.h"
+MSV_DISABLE_ALL_WARNINGS
+
+#include <memory>
+#include <cstddef>
+
+MSV_ENABLE_WARNINGS
+
+
+/**************************************************************************************************//**
+* @brief		MarsTech Task Queue Interface.
+* @details	Thread safe first in first out queue of jobs/tasks. It can be used by many producers and
+*				many consumers at the same time.
+* @see		IMsvTask
+******************************************************************************************************/
+class IMsvTaskQueue
+{
+public:
+	/**************************************************************************************************//**
+	* @brief		Virtual destructor.
+	******************************************************************************************************/
+	virtual ~IMsvTaskQueue() {};
+
+	/**************************************************************************************************//**
+	* @brief			Push job/task to queue.
+	* @details		Inserts spTask at the end of the queue.
+	* @param[in]	spTask	Shared pointer to @ref IMsvTask.
+	* @returns		bool
+	* @retval		true	When task has been inserted.
+	* @retval		false	When queue is full (bounded queue) or allocation failed (unbounded queue).
+	******************************************************************************************************/
+	virtual bool Push(std::shared_ptr<IMsvTask> spTask) = 0;
+
+	/**************************************************************************************************//**
+	* @brief			Pop job/task from queue.
+	* @details		Removes the first task from the queue and returns it.
+	* @returns		std::shared_ptr<IMsvTask>
+	* @retval		nullptr		When queue is empty.
+	******************************************************************************************************/
+	virtual std::shared_ptr<IMsvTask> Pop() = 0;
+
+	/**************************************************************************************************//**
+	* @brief			Pop batch of jobs/tasks from queue.
+	* @details		Removes at most maxCount first tasks from the queue at once and stores them to pTasks.
+	* @param[out]	pTasks		Array for popped tasks (it must have at least maxCount items).
+	* @param[in]	maxCount		Maximal count of popped tasks.
+	* @returns		size_t
+	* @retval		0		When queue is empty.
+	* @note			It can return fewer tasks than are in the queue (e.g. when some producer is just writing).
+	******************************************************************************************************/
+	virtual size_t PopBatch(std::shared_ptr<IMsvTask>* pTasks, size_t maxCount) = 0;
+
+	/**************************************************************************************************//**
+	* @brief			Get queue size.
+	* @details		Returns count of tasks in the queue.
+	* @returns		size_t
+	* @note			The value is only approximate when the queue is used by other threads.
+	******************************************************************************************************/
+	virtual size_t GetSize() const = 0;
+
+	/**************************************************************************************************//**
+	* @brief			Get queue capacity.
+	* @details		Returns maximal count of tasks in the queue.
+	* @returns		size_t
+	* @retval		0		When queue is unbounded.
+	******************************************************************************************************/
+	virtual size_t GetCapacity() const = 0;
+};
+
+
+#endif // MARSTECH_ITASKQUEUE_H
+
+/** @} */	//End of group MTHREADING.
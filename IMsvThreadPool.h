@@ -36,6 +36,10 @@ along with Foobar. If not, see <https://www.gnu.org/licenses/>.
 
 
 #include "IMsvTask.h"
+#include "IMsvTaskExecutor.h"
+#include "MsvQueueFullPolicy.h"
+#include "MsvTaskPriority.h"
+#include "MsvPeriodicPolicy.h"
 
 #include "merror/MsvError.h"
 
@@ -43,6 +47,10 @@ MSV_DISABLE_ALL_WARNINGS
 
 #include <memory>
 #include <functional>
+#include <chrono>
+#include <vector>
+#include <iterator>
+#include <initializer_list>
 
 MSV_ENABLE_WARNINGS
 
@@ -51,7 +59,8 @@ MSV_ENABLE_WARNINGS
 * @brief		MarsTech Thread Pool Interface.
 * @details	Thread pool with task/task queue.
 ******************************************************************************************************/
-class IMsvThreadPool
+class IMsvThreadPool:
+	public IMsvTaskExecutor
 {
 public:
 	/**************************************************************************************************//**
@@ -64,9 +73,18 @@ public:
 	* @details		Adds spTask to queue.
 	* @param[in]	spTask	Shared pointer to @ref IMsvTask. It will be assigned to queue and executed
 	*								by one of thread pool worker thread.
+	* @returns		MsvErrorCode
+	* @retval		MSV_ALLOCATION_ERROR		When task queue does not exist or its allocation failed.
+	* @retval		MSV_QUEUE_FULL_ERROR		When bounded task queue is full (see @ref MsvQueueFullPolicy).
+	* @retval		MSV_SUCCESS					On success.
+	* @note			Shared pointer without owner (aliasing constructor with empty owner) is allowed. Thread
+	*					pool does not own such task (caller must keep it alive until it is executed), but worker
+	*					pushes it to its deque without any allocation (work stealing mode). Tasks which are still
+	*					in worker deques when thread pool stops are executed by the thread which waits for the
+	*					stop (see @ref WaitForThreadPoolStop), so such task is never dropped.
 	* @see			IMsvTask
 	******************************************************************************************************/
-	virtual void AddTask(std::shared_ptr<IMsvTask> spTask) = 0;
+	virtual MsvErrorCode AddTask(std::shared_ptr<IMsvTask> spTask) = 0;
 
 	/**************************************************************************************************//**
 	* @brief			Add job/task to worker.
@@ -75,6 +93,7 @@ public:
 	*								worker thread.
 	* @returns		MsvErrorCode
 	* @retval		MsvAllocationError	When create @ref IMsvTask failed.
+	* @retval		MSV_QUEUE_FULL_ERROR	When bounded task queue is full (see @ref MsvQueueFullPolicy).
 	* @retval		MSV_SUCCESS				On success.
 	******************************************************************************************************/
 	virtual MsvErrorCode AddTask(std::function<void()>& task) = 0;
@@ -87,10 +106,193 @@ public:
 	* @param[in]	pContext	Context. It will be set as task parameter.
 	* @returns		MsvErrorCode
 	* @retval		MsvAllocationError	When create @ref IMsvTask failed.
+	* @retval		MSV_QUEUE_FULL_ERROR	When bounded task queue is full (see @ref MsvQueueFullPolicy).
 	* @retval		MSV_SUCCESS				On success.
 	******************************************************************************************************/
 	virtual MsvErrorCode AddTask(std::function<void(void*)>& task, void* pContext) = 0;
 
+	/**************************************************************************************************//**
+	* @brief			Add job/task with priority to worker.
+	* @details		Adds spTask to queue of priority band. Tasks with higher priority are executed before tasks
+	*					with lower priority (by thread pool priority policy).
+	* @param[in]	spTask		Shared pointer to @ref IMsvTask. It will be assigned to queue and executed
+	*									by one of thread pool worker thread.
+	* @param[in]	priority		Task priority.
+	* @returns		MsvErrorCode
+	* @retval		MSV_ALLOCATION_ERROR		When task queue does not exist or its allocation failed.
+	* @retval		MSV_QUEUE_FULL_ERROR		When bounded task queue is full (see @ref MsvQueueFullPolicy).
+	* @retval		MSV_SUCCESS					On success.
+	* @note			@ref AddTask(std::shared_ptr<IMsvTask> spTask) uses @ref MsvTaskPriority::MSV_TASK_PRIORITY_NORMAL.
+	* @see			IMsvTask
+	* @see			MsvTaskPriority
+	******************************************************************************************************/
+	virtual MsvErrorCode AddTask(std::shared_ptr<IMsvTask> spTask, MsvTaskPriority priority) = 0;
+
+	/**************************************************************************************************//**
+	* @brief			Add job/task with priority to worker.
+	* @details		Adds task to queue of priority band (it creates @ref IMsvTask from task).
+	* @param[in]	task			Function. It will be assigned to queue and executed by one of thread pool
+	*									worker thread.
+	* @param[in]	priority		Task priority.
+	* @returns		MsvErrorCode
+	* @retval		MsvAllocationError	When create @ref IMsvTask failed.
+	* @retval		MSV_QUEUE_FULL_ERROR	When bounded task queue is full (see @ref MsvQueueFullPolicy).
+	* @retval		MSV_SUCCESS				On success.
+	* @see			MsvTaskPriority
+	******************************************************************************************************/
+	virtual MsvErrorCode AddTask(std::function<void()>& task, MsvTaskPriority priority) = 0;
+
+	/**************************************************************************************************//**
+	* @brief			Add job/task with deadline to worker.
+	* @details		Adds spTask to earliest deadline first queue (when deadline scheduling is enabled). Task with
+	*					the earliest deadline is executed first and before tasks without deadline.
+	* @param[in]	spTask		Shared pointer to @ref IMsvTask. It will be assigned to queue and executed
+	*									by one of thread pool worker thread.
+	* @param[in]	deadline		Absolute deadline of the task.
+	* @returns		MsvErrorCode
+	* @retval		MSV_ALLOCATION_ERROR		When task queue does not exist or its allocation failed.
+	* @retval		MSV_QUEUE_FULL_ERROR		When bounded task queue is full (see @ref MsvQueueFullPolicy).
+	* @retval		MSV_SUCCESS					On success.
+	* @note			Queue full policy is applied to deadline queue too (drop oldest policy drops the task with
+	*					the latest deadline, which can be the new task, and reports it like expired task).
+	* @note			Deadline is ignored when deadline scheduling is not enabled (task is added as normal
+	*					priority task).
+	* @see			IMsvTask
+	******************************************************************************************************/
+	virtual MsvErrorCode AddTask(std::shared_ptr<IMsvTask> spTask, std::chrono::steady_clock::time_point deadline) = 0;
+
+	/**************************************************************************************************//**
+	* @brief			Add job/task with deadline to worker.
+	* @details		Adds task to earliest deadline first queue (it creates @ref IMsvTask from task).
+	* @param[in]	task			Function. It will be assigned to queue and executed by one of thread pool
+	*									worker thread.
+	* @param[in]	deadline		Absolute deadline of the task.
+	* @returns		MsvErrorCode
+	* @retval		MsvAllocationError	When create @ref IMsvTask failed.
+	* @retval		MSV_QUEUE_FULL_ERROR	When bounded task queue is full (see @ref MsvQueueFullPolicy).
+	* @retval		MSV_SUCCESS				On success.
+	* @see			AddTask(std::shared_ptr<IMsvTask> spTask, std::chrono::steady_clock::time_point deadline)
+	******************************************************************************************************/
+	virtual MsvErrorCode AddTask(std::function<void()>& task, std::chrono::steady_clock::time_point deadline) = 0;
+
+	/**************************************************************************************************//**
+	* @brief			Add delayed job/task to thread pool.
+	* @details		Inserts spTask to timer wheel. Task is added to task queue (as normal priority task) when
+	*					delay elapses and it is executed by one of thread pool worker thread.
+	* @param[in]	spTask		Shared pointer to @ref IMsvTask.
+	* @param[in]	delay			Delay of the task (it is rounded up to timer resolution).
+	* @param[out]	pTimerId		Optional pointer where timer identifier is stored (it can be used for cancel).
+	* @returns		MsvErrorCode
+	* @retval		MSV_ALLOCATION_ERROR		When timer wheel does not exist or allocation failed.
+	* @retval		MSV_SUCCESS					On success.
+	* @note			Delayed tasks added to stopped thread pool are pending until thread pool starts.
+	* @see			CancelDelayedTask
+	******************************************************************************************************/
+	virtual MsvErrorCode AddDelayedTask(std::shared_ptr<IMsvTask> spTask, std::chrono::microseconds delay, uint64_t* pTimerId = nullptr) = 0;
+
+	/**************************************************************************************************//**
+	* @brief			Cancel delayed job/task.
+	* @param[in]	timerId		Timer identifier returned by @ref AddDelayedTask.
+	* @returns		MsvErrorCode
+	* @retval		MSV_NOT_INITIALIZED_ERROR	When timer wheel does not exist.
+	* @retval		MSV_NOT_PENDING_INFO			When task has already been added to task queue (or cancelled).
+	* @retval		MSV_SUCCESS						On success (task will not be executed).
+	* @see			AddDelayedTask
+	******************************************************************************************************/
+	virtual MsvErrorCode CancelDelayedTask(uint64_t timerId) = 0;
+
+	/**************************************************************************************************//**
+	* @brief			Add periodic job/task to thread pool.
+	* @details		Task is executed by thread pool workers each period (the first execution is one period
+	*					after it is added) until it is cancelled. All periodic tasks share timer thread and
+	*					workers (periodic task does not need its own thread).
+	* @param[in]	spTask					Shared pointer to @ref IMsvTask.
+	* @param[in]	period					Period of the task (measured on steady clock).
+	* @param[in]	mode						Periodic mode (fixed rate or fixed delay).
+	* @param[in]	missedTickPolicy		Missed tick policy (it is used only in fixed rate mode).
+	* @param[out]	pPeriodicTaskId		Optional pointer where periodic task identifier is stored (it can be used
+	*												for cancel).
+	* @returns		MsvErrorCode
+	* @retval		MSV_INVALID_DATA_ERROR		When period is not positive.
+	* @retval		MSV_ALLOCATION_ERROR			When timer wheel does not exist or allocation failed.
+	* @retval		MSV_SUCCESS						On success.
+	* @see			CancelPeriodicTask
+	* @see			MsvPeriodicMode
+	* @see			MsvMissedTickPolicy
+	******************************************************************************************************/
+	virtual MsvErrorCode AddPeriodicTask(std::shared_ptr<IMsvTask> spTask, std::chrono::microseconds period, MsvPeriodicMode mode = MsvPeriodicMode::MSV_PERIODIC_FIXED_RATE, MsvMissedTickPolicy missedTickPolicy = MsvMissedTickPolicy::MSV_MISSED_TICK_SKIP, uint64_t* pPeriodicTaskId = nullptr) = 0;
+
+	/**************************************************************************************************//**
+	* @brief			Cancel periodic job/task.
+	* @param[in]	periodicTaskId		Periodic task identifier returned by @ref AddPeriodicTask.
+	* @returns		MsvErrorCode
+	* @retval		MSV_NOT_PENDING_INFO			When periodic task does not exist (or it has been already cancelled).
+	* @retval		MSV_SUCCESS						On success (running execution is finished, but task is not
+	*													executed anymore).
+	* @see			AddPeriodicTask
+	******************************************************************************************************/
+	virtual MsvErrorCode CancelPeriodicTask(uint64_t periodicTaskId) = 0;
+
+	/**************************************************************************************************//**
+	* @brief			Add batch of jobs/tasks to thread pool.
+	* @details		Tasks are pushed to queue without locking and there is one wake up for the whole batch (at
+	*					most min(count, idle workers) workers are woken up).
+	* @param[in]	pTasks	Array of shared pointers to @ref IMsvTask (nullptr tasks are skipped).
+	* @param[in]	count		Count of tasks in pTasks array.
+	* @returns		MsvErrorCode
+	* @retval		MSV_ALLOCATION_ERROR		When task queue does not exist or its allocation failed.
+	* @retval		MSV_QUEUE_FULL_ERROR		When bounded task queue is full (see @ref MsvQueueFullPolicy).
+	* @retval		MSV_SUCCESS					On success.
+	* @note			Tasks are added in order until the first failure.
+	* @see			IMsvTask
+	******************************************************************************************************/
+	virtual MsvErrorCode AddTasks(const std::shared_ptr<IMsvTask>* pTasks, size_t count) = 0;
+
+	/**************************************************************************************************//**
+	* @brief			Add batch of jobs/tasks to thread pool.
+	* @param[in]	tasks		Vector of shared pointers to @ref IMsvTask.
+	* @copydetails	AddTasks(const std::shared_ptr<IMsvTask>* pTasks, size_t count)
+	******************************************************************************************************/
+	MsvErrorCode AddTasks(const std::vector<std::shared_ptr<IMsvTask>>& tasks)
+	{
+		return AddTasks(tasks.data(), tasks.size());
+	}
+
+	/**************************************************************************************************//**
+	* @brief			Add batch of jobs/tasks to thread pool.
+	* @param[in]	tasks		Initializer list of shared pointers to @ref IMsvTask.
+	* @copydetails	AddTasks(const std::shared_ptr<IMsvTask>* pTasks, size_t count)
+	******************************************************************************************************/
+	MsvErrorCode AddTasks(std::initializer_list<std::shared_ptr<IMsvTask>> tasks)
+	{
+		return AddTasks(tasks.begin(), tasks.size());
+	}
+
+	/**************************************************************************************************//**
+	* @brief			Add batch of jobs/tasks to thread pool.
+	* @param[in]	first		Iterator to the first task (shared pointer to @ref IMsvTask or derived class).
+	* @param[in]	last		Iterator after the last task.
+	* @copydetails	AddTasks(const std::shared_ptr<IMsvTask>* pTasks, size_t count)
+	******************************************************************************************************/
+	template<typename Iterator>
+	MsvErrorCode AddTasks(Iterator first, Iterator last)
+	{
+		//copy tasks to array (it converts shared pointers of derived classes too)
+		std::vector<std::shared_ptr<IMsvTask>> tasks(first, last);
+		return AddTasks(tasks.data(), tasks.size());
+	}
+
+	/**************************************************************************************************//**
+	* @brief			Add batch of jobs/tasks to thread pool.
+	* @param[in]	range		Range of tasks (any container of shared pointers to @ref IMsvTask).
+	* @copydetails	AddTasks(const std::shared_ptr<IMsvTask>* pTasks, size_t count)
+	******************************************************************************************************/
+	template<typename Range>
+	MsvErrorCode AddTasks(const Range& range)
+	{
+		return AddTasks(std::begin(range), std::end(range));
+	}
+
 	/**************************************************************************************************//**
 	* @brief			Check if thread pool is running.
 	* @details		Returns flag if thread pool is running (true) or not (false).
@@ -139,7 +341,8 @@ public:
 	/**************************************************************************************************//**
 	* @brief			Wait for thread pool stop.
 	* @details		Waits (blocks current calling thread) for thread pool stop. @ref StopThreadPool must be called before
-	*					this method. When timeout is 0, waits infinite to thread pool stop.
+	*					this method. When timeout is 0, waits infinite to thread pool stop. Tasks which are still in worker
+	*					deques (work stealing mode) are executed by the calling thread when all workers have stopped.
 	* @param[in]	timeout							Wait timeout in microseconds.
 	* @returns		MsvErrorCode
 	* @retval		MSV_NOT_RUNNING_INFO			When thread pool is not running (interpreted as success too).
@@ -148,6 +351,74 @@ public:
 	* @see			StopThread
 	******************************************************************************************************/
 	virtual MsvErrorCode WaitForThreadPoolStop(int32_t timeout = 30000000) = 0;
+
+	/**************************************************************************************************//**
+	* @brief			Check if current thread is worker of this thread pool.
+	* @returns		bool
+	* @retval		true	When current thread is worker of this thread pool.
+	* @retval		false	When current thread is not worker of this thread pool.
+	******************************************************************************************************/
+	virtual bool IsWorkerThread() const = 0;
+
+	/**************************************************************************************************//**
+	* @brief			Execute one queued task in current thread.
+	* @details		Thread which waits for other tasks can help instead of blocking (worker which blocks might
+	*					block the task it waits for).
+	* @returns		bool
+	* @retval		true	When a task has been executed.
+	* @retval		false	When there is no queued task.
+	******************************************************************************************************/
+	virtual bool TryExecuteTask() = 0;
+
+	/**************************************************************************************************//**
+	* @brief			Check if current thread has queued task which other workers can take.
+	* @details		Worker checks its own deque (work stealing mode), other threads check shared queue. Empty queue
+	*					means that idle workers have nothing to take (work is demanded).
+	* @returns		bool
+	* @retval		true	When there is task which other workers can take.
+	* @retval		false	When there is no such task.
+	* @see			MsvParallelFor
+	******************************************************************************************************/
+	virtual bool HasLocalTask() const = 0;
+
+	/**************************************************************************************************//**
+	* @brief			Get count of workers.
+	* @details		Indexes of all workers are lower than the count (it is 0 when thread pool is not running).
+	* @returns		size_t
+	* @see			GetCurrentWorkerIndex
+	******************************************************************************************************/
+	virtual size_t GetWorkerCount() const = 0;
+
+	/**************************************************************************************************//**
+	* @brief			Get index of current worker.
+	* @details		Index can be used for per-worker data (e.g. partial results of parallel reduction).
+	* @param[out]	workerIndex		Index of worker which runs in current thread.
+	* @returns		bool
+	* @retval		true		When current thread is worker of this thread pool.
+	* @retval		false		When current thread is not worker of this thread pool.
+	* @see			GetWorkerCount
+	******************************************************************************************************/
+	virtual bool GetCurrentWorkerIndex(size_t& workerIndex) const = 0;
+
+	/**************************************************************************************************//**
+	* @brief			Enter blocking region.
+	* @details		Current worker is going to block (disk, lock, ...). Thread pool may wake up (or start)
+	*					compensating worker, so queued tasks do not wait for the blocked worker.
+	* @returns		bool
+	* @retval		true		When region has been entered (@ref LeaveBlockingRegion must be called).
+	* @retval		false		When there is nothing to compensate (e.g. current thread is not worker of this thread
+	*									pool).
+	* @see			MsvBlockingScope
+	******************************************************************************************************/
+	virtual bool EnterBlockingRegion() = 0;
+
+	/**************************************************************************************************//**
+	* @brief			Leave blocking region.
+	* @details		Current worker does not block anymore. Compensating worker is retired when it finishes its
+	*					current task.
+	* @see			EnterBlockingRegion
+	******************************************************************************************************/
+	virtual void LeaveBlockingRegion() = 0;
 };
 
 
@@ -0,0 +1,113 @@
+/**************************************************************************************************//**
+* @addtogroup	MTHREADING
+* @{
+******************************************************************************************************/
+
+/**************************************************************************************************//**
+* @file
+* @brief			MarsTech Timer Wheel Interface
+* @details		Contains interface of thread safe timer wheel.
+* @author		Martin Svoboda
+* @date			16.10.2026
+* @copyright	GNU General Public License (GPLv3).
+******************************************************************************************************/
+
+
+/*
+This file is part of MarsTech Threading.
+
+MarsTech Dependency Injection is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+MarsTech Promise Like Syntax is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with Foobar. If not, see <https://www.gnu.org/licenses/>.
+*/
+
+
+#ifndef MARSTECH_ITIMERWHEEL_H
+#define MARSTECH_ITIMERWHEEL_H
+
+
+#include "IMsvTask.h"
+
+#include "mheaders/MsvCompiler.h"
+MSV_DISABLE_ALL_WARNINGS
+
+#include <memory>
+#include <vector>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+
+MSV_ENABLE_WARNINGS
+
+
+/**************************************************************************************************//**
+* @brief		MarsTech Timer Wheel Interface.
+* @details	Thread safe set of timers (tasks with expiration time). It does not execute tasks itself, expired
+*				tasks are returned by @ref Advance.
+* @see		IMsvTask
+******************************************************************************************************/
+class IMsvTimerWheel
+{
+public:
+	/**************************************************************************************************//**
+	* @brief		Virtual destructor.
+	******************************************************************************************************/
+	virtual ~IMsvTimerWheel() {};
+
+	/**************************************************************************************************//**
+	* @brief			Add timer.
+	* @param[in]	spTask			Shared pointer to @ref IMsvTask (it is returned when timer expires).
+	* @param[in]	expiration		Absolute expiration time.
+	* @param[out]	timerId			Timer identifier (it can be used to cancel the timer).
+	* @returns		bool
+	* @retval		true	When timer has been added.
+	* @retval		false	When allocation failed.
+	******************************************************************************************************/
+	virtual bool AddTimer(std::shared_ptr<IMsvTask> spTask, std::chrono::steady_clock::time_point expiration, uint64_t& timerId) = 0;
+
+	/**************************************************************************************************//**
+	* @brief			Cancel timer.
+	* @param[in]	timerId		Timer identifier.
+	* @returns		bool
+	* @retval		true	When timer has been cancelled (its task will never be returned).
+	* @retval		false	When timer has already expired, has been cancelled or does not exist.
+	******************************************************************************************************/
+	virtual bool CancelTimer(uint64_t timerId) = 0;
+
+	/**************************************************************************************************//**
+	* @brief			Advance time.
+	* @details		Moves wheel time to now and appends tasks of all expired timers to expiredTasks.
+	* @param[in]	now				Current time.
+	* @param[out]	expiredTasks	Vector to which tasks of expired timers are appended.
+	* @returns		size_t
+	* @retval		count of expired timers.
+	******************************************************************************************************/
+	virtual size_t Advance(std::chrono::steady_clock::time_point now, std::vector<std::shared_ptr<IMsvTask>>& expiredTasks) = 0;
+
+	/**************************************************************************************************//**
+	* @brief			Get count of pending timers.
+	* @returns		size_t
+	******************************************************************************************************/
+	virtual size_t GetSize() const = 0;
+
+	/**************************************************************************************************//**
+	* @brief			Get resolution.
+	* @details		Returns length of one tick in microseconds (timers expire at tick boundaries).
+	* @returns		int32_t
+	******************************************************************************************************/
+	virtual int32_t GetResolution() const = 0;
+};
+
+
+#endif // MARSTECH_ITIMERWHEEL_H
+
+/** @} */	//End of group MTHREADING.
@@ -37,11 +37,16 @@ along with Foobar. If not, see <https://www.gnu.org/licenses/>.
 
 #include "IMsvThread.h"
 #include "IMsvTask.h"
+#include "IMsvTaskExecutor.h"
+#include "MsvQueueFullPolicy.h"
 
 MSV_DISABLE_ALL_WARNINGS
 
 #include <memory>
 #include <functional>
+#include <vector>
+#include <iterator>
+#include <initializer_list>
 
 MSV_ENABLE_WARNINGS
 
@@ -53,7 +58,8 @@ MSV_ENABLE_WARNINGS
 * @see		IMsvTask
 ******************************************************************************************************/
 class IMsvWorker:
-	virtual public IMsvThread
+	virtual public IMsvThread,
+	public IMsvTaskExecutor
 {
 public:
 	/**************************************************************************************************//**
@@ -65,9 +71,12 @@ public:
 	* @brief			Add job/task to worker.
 	* @details		Adds spTask to queue.
 	* @param[in]	spTask	Shared pointer to @ref IMsvTask. It will be assigned to queue and executed.
+	* @returns		MsvErrorCode
+	* @retval		MSV_QUEUE_FULL_ERROR		When bounded task queue is full (see @ref MsvQueueFullPolicy).
+	* @retval		MSV_SUCCESS					On success.
 	* @see			IMsvTask
 	******************************************************************************************************/
-	virtual void AddTask(std::shared_ptr<IMsvTask> spTask) = 0;
+	virtual MsvErrorCode AddTask(std::shared_ptr<IMsvTask> spTask) = 0;
 
 	/**************************************************************************************************//**
 	* @brief			Add job/task to worker.
@@ -75,6 +84,7 @@ public:
 	* @param[in]	task		Function. It will be assigned to queue and executed.
 	* @returns		MsvErrorCode
 	* @retval		MsvAllocationError	When create @ref IMsvTask failed.
+	* @retval		MSV_QUEUE_FULL_ERROR	When bounded task queue is full (see @ref MsvQueueFullPolicy).
 	* @retval		MSV_SUCCESS				On success.
 	******************************************************************************************************/
 	virtual MsvErrorCode AddTask(std::function<void()>& task) = 0;
@@ -86,9 +96,68 @@ public:
 	* @param[in]	pContext	Context. It will be set as task parameter.
 	* @returns		MsvErrorCode
 	* @retval		MsvAllocationError	When create @ref IMsvTask failed.
+	* @retval		MSV_QUEUE_FULL_ERROR	When bounded task queue is full (see @ref MsvQueueFullPolicy).
 	* @retval		MSV_SUCCESS				On success.
 	******************************************************************************************************/
 	virtual MsvErrorCode AddTask(std::function<void(void*)>& task, void* pContext) = 0;
+
+	/**************************************************************************************************//**
+	* @brief			Add batch of jobs/tasks to worker.
+	* @details		Adds all tasks to queue at once (under one critical section) and wakes up worker thread only once.
+	* @param[in]	pTasks	Array of shared pointers to @ref IMsvTask (nullptr tasks are skipped).
+	* @param[in]	count		Count of tasks in pTasks array.
+	* @returns		MsvErrorCode
+	* @retval		MSV_QUEUE_FULL_ERROR		When bounded task queue is full (see @ref MsvQueueFullPolicy).
+	* @retval		MSV_SUCCESS					On success.
+	* @note			Tasks are added in order until the first failure.
+	* @see			IMsvTask
+	******************************************************************************************************/
+	virtual MsvErrorCode AddTasks(const std::shared_ptr<IMsvTask>* pTasks, size_t count) = 0;
+
+	/**************************************************************************************************//**
+	* @brief			Add batch of jobs/tasks to worker.
+	* @param[in]	tasks		Vector of shared pointers to @ref IMsvTask.
+	* @copydetails	AddTasks(const std::shared_ptr<IMsvTask>* pTasks, size_t count)
+	******************************************************************************************************/
+	MsvErrorCode AddTasks(const std::vector<std::shared_ptr<IMsvTask>>& tasks)
+	{
+		return AddTasks(tasks.data(), tasks.size());
+	}
+
+	/**************************************************************************************************//**
+	* @brief			Add batch of jobs/tasks to worker.
+	* @param[in]	tasks		Initializer list of shared pointers to @ref IMsvTask.
+	* @copydetails	AddTasks(const std::shared_ptr<IMsvTask>* pTasks, size_t count)
+	******************************************************************************************************/
+	MsvErrorCode AddTasks(std::initializer_list<std::shared_ptr<IMsvTask>> tasks)
+	{
+		return AddTasks(tasks.begin(), tasks.size());
+	}
+
+	/**************************************************************************************************//**
+	* @brief			Add batch of jobs/tasks to worker.
+	* @param[in]	first		Iterator to the first task (shared pointer to @ref IMsvTask or derived class).
+	* @param[in]	last		Iterator after the last task.
+	* @copydetails	AddTasks(const std::shared_ptr<IMsvTask>* pTasks, size_t count)
+	******************************************************************************************************/
+	template<typename Iterator>
+	MsvErrorCode AddTasks(Iterator first, Iterator last)
+	{
+		//copy tasks to array (it converts shared pointers of derived classes too)
+		std::vector<std::shared_ptr<IMsvTask>> tasks(first, last);
+		return AddTasks(tasks.data(), tasks.size());
+	}
+
+	/**************************************************************************************************//**
+	* @brief			Add batch of jobs/tasks to worker.
+	* @param[in]	range		Range of tasks (any container of shared pointers to @ref IMsvTask).
+	* @copydetails	AddTasks(const std::shared_ptr<IMsvTask>* pTasks, size_t count)
+	******************************************************************************************************/
+	template<typename Range>
+	MsvErrorCode AddTasks(const Range& range)
+	{
+		return AddTasks(std::begin(range), std::end(range));
+	}
 };
 
 
@@ -0,0 +1,33 @@
+
+
+#ifndef MARSTECH_PRIORITYTASKQUEUE_MOCK_H
+#define MARSTECH_PRIORITYTASKQUEUE_MOCK_H
+
+
+#include "..\IMsvPriorityTaskQueue.h"
+
+MSV_DISABLE_ALL_WARNINGS
+
+#include <gmock\gmock.h>
+
+MSV_ENABLE_WARNINGS
+
+
+class MsvPriorityTaskQueue_Mock:
+	public IMsvPriorityTaskQueue
+{
+public:
+	MOCK_METHOD1(Push, bool(std::shared_ptr<IMsvTask>));
+	MOCK_METHOD0(Pop, std::shared_ptr<IMsvTask>());
+	MOCK_METHOD2(PopBatch, size_t(std::shared_ptr<IMsvTask>*, size_t));
+	MOCK_CONST_METHOD0(GetSize, size_t());
+	MOCK_CONST_METHOD0(GetCapacity, size_t());
+	MOCK_METHOD2(Push, bool(std::shared_ptr<IMsvTask>, MsvTaskPriority));
+	MOCK_METHOD1(Pop, std::shared_ptr<IMsvTask>(MsvTaskPriority));
+	MOCK_METHOD1(SetPriorityPolicy, MsvErrorCode(MsvPriorityPolicy));
+	MOCK_METHOD3(SetPriorityWeights, MsvErrorCode(uint32_t, uint32_t, uint32_t));
+	MOCK_METHOD1(SetPriorityAging, MsvErrorCode(uint32_t));
+};
+
+
+#endif // MARSTECH_PRIORITYTASKQUEUE_MOCK_H
@@ -0,0 +1,28 @@
+
+
+#ifndef MARSTECH_TASKQUEUE_MOCK_H
+#define MARSTECH_TASKQUEUE_MOCK_H
+
+
+#include "..\IMsvTaskQueue.h"
+
+MSV_DISABLE_ALL_WARNINGS
+
+#include <gmock\gmock.h>
+
+MSV_ENABLE_WARNINGS
+
+
+class MsvTaskQueue_Mock:
+	public IMsvTaskQueue
+{
+public:
+	MOCK_METHOD1(Push, bool(std::shared_ptr<IMsvTask>));
+	MOCK_METHOD0(Pop, std::shared_ptr<IMsvTask>());
+	MOCK_METHOD2(PopBatch, size_t(std::shared_ptr<IMsvTask>*, size_t));
+	MOCK_CONST_METHOD0(GetSize, size_t());
+	MOCK_CONST_METHOD0(GetCapacity, size_t());
+};
+
+
+#endif // MARSTECH_TASKQUEUE_MOCK_H
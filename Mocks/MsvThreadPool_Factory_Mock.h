@@ -20,6 +20,7 @@ public:
 	MOCK_CONST_METHOD1(GetIMsvTask, MSV_INTERFACE_POINTER(IMsvTask)(std::function<void()>&));
 	MOCK_CONST_METHOD2(GetIMsvTask, MSV_INTERFACE_POINTER(IMsvTask)(std::function<void(void*)>&, void*));
 	MOCK_CONST_METHOD3(GetIMsvUniqueWorker, MSV_INTERFACE_POINTER(IMsvUniqueWorker)(std::shared_ptr<std::condition_variable>, std::shared_ptr<std::mutex>, std::shared_ptr<uint64_t>));
+	MOCK_CONST_METHOD1(GetIMsvUniqueWorker, MSV_INTERFACE_POINTER(IMsvUniqueWorker)(std::shared_ptr<MsvIdleWorkerStack>));
 };
 
 
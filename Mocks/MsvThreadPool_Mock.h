@@ -17,14 +17,31 @@ class MsvThreadPool_Mock:
 	public IMsvThreadPool
 {
 public:
-	MOCK_METHOD1(AddTask, void(std::shared_ptr<IMsvTask>));
+	MOCK_METHOD1(AddTask, MsvErrorCode(std::shared_ptr<IMsvTask>));
 	MOCK_METHOD1(AddTask, MsvErrorCode(std::function<void()>&));
 	MOCK_METHOD2(AddTask, MsvErrorCode(std::function<void(void*)>&, void*));
+	MOCK_METHOD2(AddTask, MsvErrorCode(std::shared_ptr<IMsvTask>, MsvTaskPriority));
+	MOCK_METHOD2(AddTask, MsvErrorCode(std::function<void()>&, MsvTaskPriority));
+	MOCK_METHOD2(AddTask, MsvErrorCode(std::shared_ptr<IMsvTask>, std::chrono::steady_clock::time_point));
+	MOCK_METHOD2(AddTask, MsvErrorCode(std::function<void()>&, std::chrono::steady_clock::time_point));
+	MOCK_METHOD3(AddDelayedTask, MsvErrorCode(std::shared_ptr<IMsvTask>, std::chrono::microseconds, uint64_t*));
+	MOCK_METHOD1(CancelDelayedTask, MsvErrorCode(uint64_t));
+	MOCK_METHOD5(AddPeriodicTask, MsvErrorCode(std::shared_ptr<IMsvTask>, std::chrono::microseconds, MsvPeriodicMode, MsvMissedTickPolicy, uint64_t*));
+	MOCK_METHOD1(CancelPeriodicTask, MsvErrorCode(uint64_t));
+	MOCK_METHOD2(AddTasks, MsvErrorCode(const std::shared_ptr<IMsvTask>*, size_t));
+	using IMsvThreadPool::AddTasks;
 	MOCK_CONST_METHOD0(IsRunning, bool());
 	MOCK_METHOD1(StartThreadPool, MsvErrorCode(uint16_t));
 	MOCK_METHOD0(StopThreadPool, MsvErrorCode());
 	MOCK_METHOD1(StopAndWaitForThreadPoolStop, MsvErrorCode(int32_t));
 	MOCK_METHOD1(WaitForThreadPoolStop, MsvErrorCode(int32_t));
+	MOCK_CONST_METHOD0(IsWorkerThread, bool());
+	MOCK_METHOD0(TryExecuteTask, bool());
+	MOCK_CONST_METHOD0(HasLocalTask, bool());
+	MOCK_CONST_METHOD0(GetWorkerCount, size_t());
+	MOCK_CONST_METHOD1(GetCurrentWorkerIndex, bool(size_t& workerIndex));
+	MOCK_METHOD0(EnterBlockingRegion, bool());
+	MOCK_METHOD0(LeaveBlockingRegion, void());
 };
 
 
@@ -19,9 +19,11 @@ class MsvUniqueWorker_Mock:
 	public MsvThread_Mock
 {
 public:
-	MOCK_METHOD1(AddTask, void(std::shared_ptr<IMsvTask>));
+	MOCK_METHOD1(AddTask, MsvErrorCode(std::shared_ptr<IMsvTask>));
 	MOCK_METHOD1(AddTask, MsvErrorCode(std::function<void()>&));
 	MOCK_METHOD2(AddTask, MsvErrorCode(std::function<void(void*)>&, void*));
+	MOCK_METHOD2(AddTasks, MsvErrorCode(const std::shared_ptr<IMsvTask>*, size_t));
+	using IMsvWorker::AddTasks;
 };
 
 
@@ -0,0 +1,57 @@
+/**************************************************************************************************//**
+* @addtogroup	MTHREADING
+* @{
+******************************************************************************************************/
+
+/**************************************************************************************************//**
+* @file
+* @brief			MarsTech Blocking Scope
+* @details		Contains implementation of @ref MsvBlockingScope.
+* @author		Martin Svoboda
+* @date			16.10.2026
+* @copyright	GNU General Public License (GPLv3).
+******************************************************************************************************/
+
+
+/*
+This file is part of MarsTech Threading.
+
+MarsTech Dependency Injection is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+MarsTech Promise Like Syntax is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with Foobar. If not, see <https://www.gnu.org/licenses/>.
+*/
+
+
+#include "MsvBlockingScope.h"
+
+
+/********************************************************************************************************************************
+*															Constructors and destructors
+********************************************************************************************************************************/
+
+
+MsvBlockingScope::MsvBlockingScope(IMsvThreadPool& threadPool):
+	m_threadPool(threadPool),
+	m_entered(threadPool.EnterBlockingRegion())
+{
+
+}
+
+MsvBlockingScope::~MsvBlockingScope()
+{
+	if (m_entered)
+	{
+		m_threadPool.LeaveBlockingRegion();
+	}
+}
+
+/** @} */	//End of group MTHREADING.
@@ -0,0 +1,82 @@
+/**************************************************************************************************//**
+* @addtogroup	MTHREADING
+* @{
+******************************************************************************************************/
+
+/**************************************************************************************************//**
+* @file
+* @brief			MarsTech Blocking Scope
+* @details		Defines blocking scope of thread pool worker.
+* @author		Martin Svoboda
+* @date			16.10.2026
+* @copyright	GNU General Public License (GPLv3).
+******************************************************************************************************/
+
+
+/*
+This file is part of MarsTech Threading.
+
+MarsTech Dependency Injection is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+MarsTech Promise Like Syntax is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with Foobar. If not, see <https://www.gnu.org/licenses/>.
+*/
+
+
+#ifndef MARSTECH_BLOCKINGSCOPE_H
+#define MARSTECH_BLOCKINGSCOPE_H
+
+
+#include "IMsvThreadPool.h"
+
+
+/**************************************************************************************************//**
+* @brief		MarsTech Blocking Scope.
+* @details	RAII guard of blocking region. Task which is going to block (disk, lock, waiting for other thread)
+*				creates it as a local variable. Thread pool wakes up (or starts) compensating worker while the
+*				scope exists, so queued tasks do not wait for blocked worker. Compensating worker is retired when
+*				the scope is destroyed.
+* @note		Scope is used by one thread (the one which created it) and it must not be copied. It does nothing
+*				when it is not created by worker of the thread pool.
+* @see		IMsvThreadPool::EnterBlockingRegion
+******************************************************************************************************/
+class MsvBlockingScope
+{
+public:
+	/**************************************************************************************************//**
+	* @brief			Constructor.
+	* @details		Enters blocking region.
+	* @param[in]	threadPool		Thread pool of current worker (it must outlive the scope).
+	******************************************************************************************************/
+	MsvBlockingScope(IMsvThreadPool& threadPool);
+
+	/**************************************************************************************************//**
+	* @brief		Virtual destructor.
+	* @details	Leaves blocking region.
+	******************************************************************************************************/
+	virtual ~MsvBlockingScope();
+
+protected:
+	/**************************************************************************************************//**
+	* @brief		Thread pool of current worker.
+	******************************************************************************************************/
+	IMsvThreadPool& m_threadPool;
+
+	/**************************************************************************************************//**
+	* @brief		Flag if blocking region has been entered (true) or not (false).
+	******************************************************************************************************/
+	bool m_entered;
+};
+
+
+#endif // MARSTECH_BLOCKINGSCOPE_H
+
+/** @} */	//End of group MTHREADING.
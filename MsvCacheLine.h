@@ -0,0 +1,78 @@
+/**************************************************************************************************//**
+* @addtogroup	MTHREADING
+* @{
+******************************************************************************************************/
+
+/**************************************************************************************************//**
+* @file
+* @brief			MarsTech Cache Line Helpers
+* @details		Contains cache line size and @ref MsvCacheLinePadded helper which prevents false sharing.
+* @author		Martin Svoboda
+* @date			16.10.2026
+* @copyright	GNU General Public License (GPLv3).
+******************************************************************************************************/
+
+
+/*
+This file is part of MarsTech Threading.
+
+MarsTech Dependency Injection is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+MarsTech Promise Like Syntax is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with Foobar. If not, see <https://www.gnu.org/licenses/>.
+*/
+
+
+#ifndef MARSTECH_CACHELINE_H
+#define MARSTECH_CACHELINE_H
+
+
+#include "mheaders/MsvCompiler.h"
+MSV_DISABLE_ALL_WARNINGS
+
+#include <cstddef>
+
+MSV_ENABLE_WARNINGS
+
+
+/**************************************************************************************************//**
+* @brief		Cache line size.
+* @details	Size of cache line in bytes (it is 64 bytes on all supported platforms).
+******************************************************************************************************/
+#define MSV_CACHE_LINE_SIZE 64
+
+
+/**************************************************************************************************//**
+* @brief		MarsTech Cache Line Padded Value.
+* @details	Wraps value and pads it to (at least) whole cache line. Two neighbouring padded values
+*				never share one cache line, so threads writing them do not invalidate each other caches.
+* @note		Padding is used instead of alignas, because over-aligned types are not allocated properly
+*				by new operator before C++17.
+******************************************************************************************************/
+template<typename T>
+struct MsvCacheLinePadded
+{
+	/**************************************************************************************************//**
+	* @brief		Padded value.
+	******************************************************************************************************/
+	T value;
+
+	/**************************************************************************************************//**
+	* @brief		Padding.
+	* @details	Fills the rest of cache line (and one more whole cache line when the value is not aligned).
+	******************************************************************************************************/
+	char padding[MSV_CACHE_LINE_SIZE - (sizeof(T) % MSV_CACHE_LINE_SIZE) + MSV_CACHE_LINE_SIZE];
+};
+
+
+#endif // MARSTECH_CACHELINE_H
+
+/** @} */	//End of group MTHREADING.
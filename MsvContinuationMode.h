@@ -0,0 +1,61 @@
+/**************************************************************************************************//**
+* @addtogroup	MTHREADING
+* @{
+******************************************************************************************************/
+
+/**************************************************************************************************//**
+* @file
+* @brief			MarsTech Continuation Mode
+* @details		Contains definition of continuation modes.
+* @author		Martin Svoboda
+* @date			16.10.2026
+* @copyright	GNU General Public License (GPLv3).
+******************************************************************************************************/
+
+
+/*
+This file is part of MarsTech Threading.
+
+MarsTech Dependency Injection is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+MarsTech Promise Like Syntax is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with Foobar. If not, see <https://www.gnu.org/licenses/>.
+*/
+
+
+#ifndef MARSTECH_CONTINUATIONMODE_H
+#define MARSTECH_CONTINUATIONMODE_H
+
+
+#include "mheaders/MsvCompiler.h"
+
+MSV_DISABLE_ALL_WARNINGS
+
+#include <cstdint>
+
+MSV_ENABLE_WARNINGS
+
+
+/**************************************************************************************************//**
+* @brief		MarsTech Continuation Mode.
+* @details	Says where continuation is executed when its antecedent task completes.
+* @see		MsvFuture::Then
+******************************************************************************************************/
+enum class MsvContinuationMode: uint8_t
+{
+	MSV_CONTINUATION_ASYNC = 0,					///< Continuation is added to executor of antecedent task (thread pool or worker).
+	MSV_CONTINUATION_INLINE = 1					///< Continuation is executed by thread which completes antecedent task (or by caller of Then when antecedent is already completed).
+};
+
+
+#endif // MARSTECH_CONTINUATIONMODE_H
+
+/** @} */	//End of group MTHREADING.
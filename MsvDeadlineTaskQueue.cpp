@@ -0,0 +1,168 @@
+/**************************************************************************************************//**
+* @addtogroup	MTHREADING
+* @{
+******************************************************************************************************/
+
+/**************************************************************************************************//**
+* @file
+* @brief			MarsTech Deadline Task Queue
+* @details		Contains implementation of @ref MsvDeadlineTaskQueue.
+* @author		Martin Svoboda
+* @date			16.10.2026
+* @copyright	GNU General Public License (GPLv3).
+******************************************************************************************************/
+
+
+/*
+This file is part of MarsTech Threading.
+
+MarsTech Dependency Injection is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+MarsTech Promise Like Syntax is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with Foobar. If not, see <https://www.gnu.org/licenses/>.
+*/
+
+
+#include "MsvDeadlineTaskQueue.h"
+
+MSV_DISABLE_ALL_WARNINGS
+
+#include <algorithm>
+
+MSV_ENABLE_WARNINGS
+
+
+/********************************************************************************************************************************
+*															Constructors and destructors
+********************************************************************************************************************************/
+
+
+MsvDeadlineTaskQueue::MsvDeadlineTaskQueue(size_t capacity):
+	m_capacity(capacity),
+	m_sequence(0),
+	m_size(0)
+{
+
+}
+
+MsvDeadlineTaskQueue::~MsvDeadlineTaskQueue()
+{
+
+}
+
+
+/********************************************************************************************************************************
+*															IMsvDeadlineTaskQueue public methods
+********************************************************************************************************************************/
+
+
+bool MsvDeadlineTaskQueue::Push(std::shared_ptr<IMsvTask> spTask, std::chrono::steady_clock::time_point deadline)
+{
+	std::lock_guard<std::mutex> lock(m_lock);
+
+	if (m_capacity && m_tasks.size() >= m_capacity)
+	{
+		return false;
+	}
+
+	try
+	{
+		MsvDeadlineTask task = { deadline, m_sequence++, std::move(spTask) };
+		m_tasks.push_back(std::move(task));
+	}
+	catch (...)
+	{
+		//allocation failed
+		return false;
+	}
+
+	std::push_heap(m_tasks.begin(), m_tasks.end());
+	m_size.store(m_tasks.size(), std::memory_order_release);
+
+	return true;
+}
+
+std::shared_ptr<IMsvTask> MsvDeadlineTaskQueue::Pop(std::chrono::steady_clock::time_point& deadline)
+{
+	//empty queue is detected without lock
+	if (!m_size.load(std::memory_order_acquire))
+	{
+		return nullptr;
+	}
+
+	std::lock_guard<std::mutex> lock(m_lock);
+
+	if (m_tasks.empty())
+	{
+		return nullptr;
+	}
+
+	std::pop_heap(m_tasks.begin(), m_tasks.end());
+	std::shared_ptr<IMsvTask> spTask = std::move(m_tasks.back().spTask);
+	deadline = m_tasks.back().deadline;
+	m_tasks.pop_back();
+	m_size.store(m_tasks.size(), std::memory_order_release);
+
+	return spTask;
+}
+
+bool MsvDeadlineTaskQueue::PushOrDropLatest(std::shared_ptr<IMsvTask> spTask, std::chrono::steady_clock::time_point deadline, std::shared_ptr<IMsvTask>& spDroppedTask)
+{
+	spDroppedTask = nullptr;
+
+	std::lock_guard<std::mutex> lock(m_lock);
+
+	MsvDeadlineTask task = { deadline, m_sequence++, std::move(spTask) };
+	if (!m_capacity || m_tasks.size() < m_capacity)
+	{
+		try
+		{
+			m_tasks.push_back(std::move(task));
+		}
+		catch (...)
+		{
+			//allocation failed
+			return false;
+		}
+
+		std::push_heap(m_tasks.begin(), m_tasks.end());
+		m_size.store(m_tasks.size(), std::memory_order_release);
+
+		return true;
+	}
+
+	//the latest deadline is the "least" item (it is one of heap leaves, but full search is simpler)
+	std::vector<MsvDeadlineTask>::iterator latestIt = std::min_element(m_tasks.begin(), m_tasks.end());
+	if (task < *latestIt)
+	{
+		//new task is the least urgent one
+		spDroppedTask = std::move(task.spTask);
+		return true;
+	}
+
+	spDroppedTask = std::move(latestIt->spTask);
+	*latestIt = std::move(task);
+	std::make_heap(m_tasks.begin(), m_tasks.end());
+
+	return true;
+}
+
+size_t MsvDeadlineTaskQueue::GetSize() const
+{
+	return m_size.load();
+}
+
+size_t MsvDeadlineTaskQueue::GetCapacity() const
+{
+	return m_capacity;
+}
+
+/** @} */	//End of group MTHREADING.
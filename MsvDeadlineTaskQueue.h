@@ -0,0 +1,145 @@
+/**************************************************************************************************//**
+* @addtogroup	MTHREADING
+* @{
+******************************************************************************************************/
+
+/**************************************************************************************************//**
+* @file
+* @brief			MarsTech Deadline Task Queue
+* @details		Contains implementation of earliest deadline first task queue @ref MsvDeadlineTaskQueue.
+* @author		Martin Svoboda
+* @date			16.10.2026
+* @copyright	GNU General Public License (GPLv3).
+******************************************************************************************************/
+
+
+/*
+This file is part of MarsTech Threading.
+
+MarsTech Dependency Injection is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+MarsTech Promise Like Syntax is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with Foobar. If not, see <https://www.gnu.org/licenses/>.
+*/
+
+
+#ifndef MARSTECH_DEADLINETASKQUEUE_H
+#define MARSTECH_DEADLINETASKQUEUE_H
+
+
+#include "IMsvDeadlineTaskQueue.h"
+
+MSV_DISABLE_ALL_WARNINGS
+
+#include <atomic>
+#include <mutex>
+#include <vector>
+#include <cstdint>
+
+MSV_ENABLE_WARNINGS
+
+
+/**************************************************************************************************//**
+* @brief		MarsTech Deadline Task Queue Implementation.
+* @details	Binary min-heap of tasks ordered by deadline (and push sequence number for the same deadline)
+*				protected by mutex. Push and pop are O(log n). Size is atomic, so empty queue is detected
+*				without any lock.
+* @see		IMsvDeadlineTaskQueue
+******************************************************************************************************/
+class MsvDeadlineTaskQueue:
+	public IMsvDeadlineTaskQueue
+{
+public:
+	/**************************************************************************************************//**
+	* @brief			Constructor.
+	* @param[in]	capacity		Maximal count of tasks in the queue (zero means unbounded queue).
+	******************************************************************************************************/
+	MsvDeadlineTaskQueue(size_t capacity = 0);
+
+	/**************************************************************************************************//**
+	* @brief		Virtual destructor.
+	******************************************************************************************************/
+	virtual ~MsvDeadlineTaskQueue();
+
+	/**************************************************************************************************//**
+	* @copydoc IMsvDeadlineTaskQueue::Push(std::shared_ptr<IMsvTask> spTask, std::chrono::steady_clock::time_point deadline)
+	******************************************************************************************************/
+	virtual bool Push(std::shared_ptr<IMsvTask> spTask, std::chrono::steady_clock::time_point deadline) override;
+
+	/**************************************************************************************************//**
+	* @copydoc IMsvDeadlineTaskQueue::Pop(std::chrono::steady_clock::time_point& deadline)
+	******************************************************************************************************/
+	virtual std::shared_ptr<IMsvTask> Pop(std::chrono::steady_clock::time_point& deadline) override;
+
+	/**************************************************************************************************//**
+	* @copydoc IMsvDeadlineTaskQueue::PushOrDropLatest(std::shared_ptr<IMsvTask> spTask, std::chrono::steady_clock::time_point deadline, std::shared_ptr<IMsvTask>& spDroppedTask)
+	******************************************************************************************************/
+	virtual bool PushOrDropLatest(std::shared_ptr<IMsvTask> spTask, std::chrono::steady_clock::time_point deadline, std::shared_ptr<IMsvTask>& spDroppedTask) override;
+
+	/**************************************************************************************************//**
+	* @copydoc IMsvDeadlineTaskQueue::GetSize()
+	******************************************************************************************************/
+	virtual size_t GetSize() const override;
+
+	/**************************************************************************************************//**
+	* @copydoc IMsvDeadlineTaskQueue::GetCapacity()
+	******************************************************************************************************/
+	virtual size_t GetCapacity() const override;
+
+protected:
+	/**************************************************************************************************//**
+	* @brief		Heap item.
+	******************************************************************************************************/
+	struct MsvDeadlineTask
+	{
+		std::chrono::steady_clock::time_point deadline;
+		uint64_t sequence;
+		std::shared_ptr<IMsvTask> spTask;
+
+		//heap is max-heap -> "less" item has later deadline
+		bool operator<(const MsvDeadlineTask& other) const
+		{
+			return deadline != other.deadline ? deadline > other.deadline : sequence > other.sequence;
+		}
+	};
+
+protected:
+	/**************************************************************************************************//**
+	* @brief		Queue capacity.
+	* @details	Zero means unbounded queue.
+	******************************************************************************************************/
+	size_t m_capacity;
+
+	/**************************************************************************************************//**
+	* @brief		Queue lock.
+	******************************************************************************************************/
+	std::mutex m_lock;
+
+	/**************************************************************************************************//**
+	* @brief		Heap of tasks (the earliest deadline is at front).
+	******************************************************************************************************/
+	std::vector<MsvDeadlineTask> m_tasks;
+
+	/**************************************************************************************************//**
+	* @brief		Push sequence number (keeps first in first out order of tasks with the same deadline).
+	******************************************************************************************************/
+	uint64_t m_sequence;
+
+	/**************************************************************************************************//**
+	* @brief		Count of tasks in the queue.
+	******************************************************************************************************/
+	std::atomic<size_t> m_size;
+};
+
+
+#endif // MARSTECH_DEADLINETASKQUEUE_H
+
+/** @} */	//End of group MTHREADING.
@@ -0,0 +1,207 @@
+/**************************************************************************************************//**
+* @addtogroup	MTHREADING
+* @{
+******************************************************************************************************/
+
+/**************************************************************************************************//**
+* @file
+* @brief			MarsTech Fork Join
+* @details		Contains implementation of @ref MsvForkJoin.
+* @author		Martin Svoboda
+* @date			16.10.2026
+* @copyright	GNU General Public License (GPLv3).
+******************************************************************************************************/
+
+
+/*
+This file is part of MarsTech Threading.
+
+MarsTech Dependency Injection is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+MarsTech Promise Like Syntax is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with Foobar. If not, see <https://www.gnu.org/licenses/>.
+*/
+
+
+#include "MsvForkJoin.h"
+
+#include "merror/MsvError.h"
+
+MSV_DISABLE_ALL_WARNINGS
+
+#include <thread>
+
+MSV_ENABLE_WARNINGS
+
+
+/********************************************************************************************************************************
+*															Constructors and destructors
+********************************************************************************************************************************/
+
+
+MsvForkJoin::MsvForkJoin(IMsvThreadPool& threadPool):
+	m_threadPool(threadPool),
+	m_pendingChildren(0),
+	m_pChildren(nullptr),
+	m_inlineUsed(0)
+{
+
+}
+
+MsvForkJoin::~MsvForkJoin()
+{
+	//children are stored in (and reference) this context
+	SyncChildren();
+}
+
+MsvForkJoin::MsvForkJoinChild::MsvForkJoinChild(MsvForkJoin* pContext, bool inlineStorage):
+	m_pNext(nullptr),
+	m_inlineStorage(inlineStorage),
+	m_pContext(pContext)
+{
+
+}
+
+MsvForkJoin::MsvForkJoinChild::~MsvForkJoinChild()
+{
+
+}
+
+
+/********************************************************************************************************************************
+*															MsvForkJoin public methods
+********************************************************************************************************************************/
+
+
+void MsvForkJoin::Sync()
+{
+	SyncChildren();
+
+	std::exception_ptr pException;
+	{
+		std::lock_guard<std::mutex> lock(m_exceptionLock);
+		pException = m_exception;
+		m_exception = nullptr;
+	}
+
+	if (pException)
+	{
+		std::rethrow_exception(pException);
+	}
+}
+
+
+/********************************************************************************************************************************
+*															MsvForkJoin protected methods
+********************************************************************************************************************************/
+
+
+void* MsvForkJoin::AllocateInline(size_t size, size_t alignment)
+{
+	size_t offset = (m_inlineUsed + alignment - 1) & ~(alignment - 1);
+	if (alignment > alignof(std::max_align_t) || offset + size > MSV_FORK_JOIN_INLINE_SIZE)
+	{
+		return nullptr;
+	}
+
+	m_inlineUsed = offset + size;
+
+	return reinterpret_cast<char*>(&m_inlineStorage) + offset;
+}
+
+void MsvForkJoin::AddChild(MsvForkJoinChild* pChild)
+{
+	pChild->m_pNext = m_pChildren;
+	m_pChildren = pChild;
+
+	//count the child before it can be executed
+	++m_pendingChildren;
+
+	//thread pool does not own the child (aliasing constructor without owner - no allocation), it lives until sync
+	std::shared_ptr<IMsvTask> spChild(std::shared_ptr<IMsvTask>(), pChild);
+	if (MSV_FAILED(m_threadPool.AddTask(spChild)))
+	{
+		pChild->Execute();
+	}
+}
+
+void MsvForkJoin::SyncChildren()
+{
+	//children of current worker are on top of its deque -> they are executed first
+	while (m_pendingChildren.load(std::memory_order_acquire))
+	{
+		if (!m_threadPool.TryExecuteTask())
+		{
+			//children are executed by other workers
+			std::this_thread::yield();
+		}
+	}
+
+	while (m_pChildren)
+	{
+		MsvForkJoinChild* pChild = m_pChildren;
+		m_pChildren = pChild->m_pNext;
+
+		if (pChild->m_inlineStorage)
+		{
+			pChild->~MsvForkJoinChild();
+		}
+		else
+		{
+			delete pChild;
+		}
+	}
+
+	m_inlineUsed = 0;
+}
+
+void MsvForkJoin::SetException(std::exception_ptr pException)
+{
+	std::lock_guard<std::mutex> lock(m_exceptionLock);
+	if (!m_exception)
+	{
+		m_exception = pException;
+	}
+}
+
+void MsvForkJoin::OnChildDone(std::exception_ptr pException)
+{
+	if (pException)
+	{
+		SetException(pException);
+	}
+
+	//context (and the child) can be released by sync right after this
+	m_pendingChildren.fetch_sub(1, std::memory_order_release);
+}
+
+
+/********************************************************************************************************************************
+*															MsvForkJoinChild public methods
+********************************************************************************************************************************/
+
+
+void MsvForkJoin::MsvForkJoinChild::Execute()
+{
+	std::exception_ptr pException;
+	try
+	{
+		Invoke();
+	}
+	catch (...)
+	{
+		pException = std::current_exception();
+	}
+
+	m_pContext->OnChildDone(pException);
+}
+
+/** @} */	//End of group MTHREADING.
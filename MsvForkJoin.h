@@ -0,0 +1,293 @@
+/**************************************************************************************************//**
+* @addtogroup	MTHREADING
+* @{
+******************************************************************************************************/
+
+/**************************************************************************************************//**
+* @file
+* @brief			MarsTech Fork Join
+* @details		Fork-join context for recursive divide and conquer algorithms executed by thread pool.
+* @author		Martin Svoboda
+* @date			16.10.2026
+* @copyright	GNU General Public License (GPLv3).
+******************************************************************************************************/
+
+
+/*
+This file is part of MarsTech Threading.
+
+MarsTech Dependency Injection is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+MarsTech Promise Like Syntax is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with Foobar. If not, see <https://www.gnu.org/licenses/>.
+*/
+
+
+#ifndef MARSTECH_FORKJOIN_H
+#define MARSTECH_FORKJOIN_H
+
+
+#include "IMsvThreadPool.h"
+
+MSV_DISABLE_ALL_WARNINGS
+
+#include <atomic>
+#include <cstddef>
+#include <exception>
+#include <mutex>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+MSV_ENABLE_WARNINGS
+
+
+/**************************************************************************************************//**
+* @brief		Fork join inline storage size.
+* @details	Size of storage (in bytes) for spawned children inside of fork join context. Children which do not
+*				fit are allocated on heap.
+******************************************************************************************************/
+#define MSV_FORK_JOIN_INLINE_SIZE 512
+
+
+/**************************************************************************************************//**
+* @brief		MarsTech Fork Join.
+* @details	Context of one fork join level of recursive algorithm. It is meant to be a local variable:
+*				- Spawned children are stored inside the context (on stack of the calling thread) until
+*					@ref Sync. Thread pool references them by shared pointers without owner, so worker pushes
+*					them to its deque without any allocation.
+*				- Children are pushed to deque of current worker (work stealing mode) and the spawning thread
+*					continues (help first, other workers steal the children). @ref Sync executes the children
+*					which were not stolen (the latest one first).
+*				- @ref Sync never blocks worker, it executes queued tasks until all children are done.
+*				- @ref ParallelInvoke executes the first function by calling thread without spawning it.
+*
+*				Nested levels create their own contexts inside of children.
+* @note		Context is used by one thread (the one which spawns) and it must not be copied. Exception thrown
+*				by any child is rethrown by @ref Sync (the first one only).
+* @see		IMsvThreadPool::TryExecuteTask
+******************************************************************************************************/
+class MsvForkJoin
+{
+public:
+	/**************************************************************************************************//**
+	* @brief			Constructor.
+	* @param[in]	threadPool		Thread pool which executes children (it must outlive the context).
+	******************************************************************************************************/
+	MsvForkJoin(IMsvThreadPool& threadPool);
+
+	/**************************************************************************************************//**
+	* @brief		Virtual destructor.
+	* @details	Waits for all children (they are stored in the context and they reference it).
+	******************************************************************************************************/
+	virtual ~MsvForkJoin();
+
+	/**************************************************************************************************//**
+	* @brief			Spawn child.
+	* @details		Child is added to thread pool. It is executed by calling thread when it can't be added.
+	* @param[in]	function		Function to execute (callable without parameters). It is moved (or copied) to
+	*									the child.
+	******************************************************************************************************/
+	template<typename Function>
+	void Spawn(Function&& function);
+
+	/**************************************************************************************************//**
+	* @brief			Wait until all spawned children are executed.
+	* @details		Calling thread executes queued tasks while it waits (children of current worker first).
+	* @throws		Exception of the first failed child.
+	******************************************************************************************************/
+	virtual void Sync();
+
+	/**************************************************************************************************//**
+	* @brief			Execute functions in parallel and wait for them.
+	* @details		All functions except the first one are spawned, the first one is executed by calling thread
+	*					and then @ref Sync is called.
+	* @param[in]	function		The first function (executed by calling thread).
+	* @param[in]	functions	Other functions (spawned).
+	* @throws		Exception of the first failed function.
+	******************************************************************************************************/
+	template<typename Function, typename... Functions>
+	void ParallelInvoke(Function&& function, Functions&&... functions);
+
+protected:
+	/**************************************************************************************************//**
+	* @brief		Child of fork join context.
+	* @details	Executes child function, stores its exception and counts it down.
+	******************************************************************************************************/
+	class MsvForkJoinChild:
+		public IMsvTask
+	{
+	public:
+		MsvForkJoinChild(MsvForkJoin* pContext, bool inlineStorage);
+		virtual ~MsvForkJoinChild();
+
+		virtual void Execute() override;
+
+		MsvForkJoinChild* m_pNext;
+		bool m_inlineStorage;
+
+	protected:
+		virtual void Invoke() = 0;
+
+		MsvForkJoin* m_pContext;
+	};
+
+	/**************************************************************************************************//**
+	* @brief		Child which executes function.
+	******************************************************************************************************/
+	template<typename Function>
+	class MsvForkJoinFunctionChild:
+		public MsvForkJoinChild
+	{
+	public:
+		template<typename F>
+		MsvForkJoinFunctionChild(MsvForkJoin* pContext, bool inlineStorage, F&& function):
+			MsvForkJoinChild(pContext, inlineStorage),
+			m_function(std::forward<F>(function))
+		{
+
+		}
+
+	protected:
+		virtual void Invoke() override
+		{
+			m_function();
+		}
+
+		Function m_function;
+	};
+
+	/**************************************************************************************************//**
+	* @brief			Allocate memory for child in inline storage.
+	* @param[in]	size			Size of child.
+	* @param[in]	alignment	Alignment of child.
+	* @returns		Pointer to memory or nullptr when there is no space left.
+	******************************************************************************************************/
+	void* AllocateInline(size_t size, size_t alignment);
+
+	/**************************************************************************************************//**
+	* @brief			Add child to the context and to thread pool.
+	* @param[in]	pChild		Child to add.
+	******************************************************************************************************/
+	void AddChild(MsvForkJoinChild* pChild);
+
+	/**************************************************************************************************//**
+	* @brief			Wait for all children and release them (without exception rethrow).
+	******************************************************************************************************/
+	void SyncChildren();
+
+	/**************************************************************************************************//**
+	* @brief			Store exception (the first one only).
+	* @param[in]	pException		Exception to store.
+	******************************************************************************************************/
+	void SetException(std::exception_ptr pException);
+
+	/**************************************************************************************************//**
+	* @brief			Count down executed child.
+	* @param[in]	pException		Exception of the child (nullptr when succeeded).
+	******************************************************************************************************/
+	void OnChildDone(std::exception_ptr pException);
+
+protected:
+	/**************************************************************************************************//**
+	* @brief		Thread pool which executes children.
+	******************************************************************************************************/
+	IMsvThreadPool& m_threadPool;
+
+	/**************************************************************************************************//**
+	* @brief		Count of children which have not been executed yet.
+	******************************************************************************************************/
+	std::atomic<size_t> m_pendingChildren;
+
+	/**************************************************************************************************//**
+	* @brief		List of children spawned since the last sync (the latest one first).
+	******************************************************************************************************/
+	MsvForkJoinChild* m_pChildren;
+
+	/**************************************************************************************************//**
+	* @brief		Used bytes of inline storage.
+	******************************************************************************************************/
+	size_t m_inlineUsed;
+
+	/**************************************************************************************************//**
+	* @brief		Exception of the first failed child.
+	******************************************************************************************************/
+	std::exception_ptr m_exception;
+
+	/**************************************************************************************************//**
+	* @brief		Lock of the exception.
+	******************************************************************************************************/
+	std::mutex m_exceptionLock;
+
+	/**************************************************************************************************//**
+	* @brief		Inline storage for children.
+	******************************************************************************************************/
+	typename std::aligned_storage<MSV_FORK_JOIN_INLINE_SIZE, alignof(std::max_align_t)>::type m_inlineStorage;
+};
+
+
+template<typename Function>
+void MsvForkJoin::Spawn(Function&& function)
+{
+	typedef MsvForkJoinFunctionChild<typename std::decay<Function>::type> Child;
+
+	Child* pChild = nullptr;
+	void* pStorage = AllocateInline(sizeof(Child), alignof(Child));
+	if (pStorage)
+	{
+		pChild = new (pStorage) Child(this, true, std::forward<Function>(function));
+	}
+	else
+	{
+		pChild = new (std::nothrow) Child(this, false, std::forward<Function>(function));
+	}
+
+	if (!pChild)
+	{
+		//no memory -> function is executed now (it has not been moved)
+		try
+		{
+			function();
+		}
+		catch (...)
+		{
+			SetException(std::current_exception());
+		}
+
+		return;
+	}
+
+	AddChild(pChild);
+}
+
+template<typename Function, typename... Functions>
+void MsvForkJoin::ParallelInvoke(Function&& function, Functions&&... functions)
+{
+	int spawned[] = { 0, (Spawn(std::forward<Functions>(functions)), 0)... };
+	(void)spawned;
+
+	//the first function is not spawned at all (calling thread would execute it anyway)
+	try
+	{
+		function();
+	}
+	catch (...)
+	{
+		SetException(std::current_exception());
+	}
+
+	Sync();
+}
+
+
+#endif // MARSTECH_FORKJOIN_H
+
+/** @} */	//End of group MTHREADING.
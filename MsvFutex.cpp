@@ -0,0 +1,174 @@
+/**************************************************************************************************//**
+* @addtogroup	MTHREADING
+* @{
+******************************************************************************************************/
+
+/**************************************************************************************************//**
+* @file
+* @brief			MarsTech Futex
+* @details		Contains implementation of @ref MsvFutexWait and @ref MsvFutexWake.
+* @author		Martin Svoboda
+* @date			16.10.2026
+* @copyright	GNU General Public License (GPLv3).
+******************************************************************************************************/
+
+
+/*
+This file is part of MarsTech Threading.
+
+MarsTech Dependency Injection is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+MarsTech Promise Like Syntax is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with Foobar. If not, see <https://www.gnu.org/licenses/>.
+*/
+
+
+#include "MsvFutex.h"
+
+MSV_DISABLE_ALL_WARNINGS
+
+#if defined(_WIN32)
+#include <windows.h>
+#pragma comment(lib, "Synchronization.lib")
+#elif defined(__linux__)
+#include <ctime>
+#include <linux/futex.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#else
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <mutex>
+#endif
+
+MSV_ENABLE_WARNINGS
+
+
+//futex word must be plain 32 bit integer (kernel/OS waits on its address)
+static_assert(sizeof(std::atomic<uint32_t>) == sizeof(uint32_t), "std::atomic<uint32_t> can't be used as futex word.");
+
+
+#if !defined(_WIN32) && !defined(__linux__)
+
+/********************************************************************************************************************************
+*															Parking buckets (fallback)
+********************************************************************************************************************************/
+
+
+/**************************************************************************************************//**
+* @brief		Parking bucket.
+* @details	Threads waiting on words with the same address hash share one bucket.
+******************************************************************************************************/
+struct MsvParkingBucket
+{
+	/**************************************************************************************************//**
+	* @brief		Bucket mutex.
+	******************************************************************************************************/
+	std::mutex mutex;
+
+	/**************************************************************************************************//**
+	* @brief		Bucket condition variable.
+	******************************************************************************************************/
+	std::condition_variable condition;
+};
+
+/**************************************************************************************************//**
+* @brief		Count of parking buckets.
+******************************************************************************************************/
+static const size_t MSV_PARKING_BUCKET_COUNT = 64;
+
+/**************************************************************************************************//**
+* @brief			Get parking bucket of futex word.
+* @param[in]	word		Futex word.
+* @returns		MsvParkingBucket&
+******************************************************************************************************/
+static MsvParkingBucket& GetParkingBucket(const std::atomic<uint32_t>& word)
+{
+	static MsvParkingBucket buckets[MSV_PARKING_BUCKET_COUNT];
+
+	//words are at least 4 bytes aligned -> low bits are always zero
+	return buckets[(reinterpret_cast<uintptr_t>(&word) >> 2) % MSV_PARKING_BUCKET_COUNT];
+}
+
+#endif
+
+
+/********************************************************************************************************************************
+*															Futex functions
+********************************************************************************************************************************/
+
+
+void MsvFutexWait(std::atomic<uint32_t>& word, uint32_t expected, int64_t timeout)
+{
+#if defined(_WIN32)
+	//round timeout up to milliseconds (zero would not wait at all)
+	DWORD milliseconds = timeout > 0 ? static_cast<DWORD>((timeout + 999) / 1000) : INFINITE;
+	WaitOnAddress(&word, &expected, sizeof(expected), milliseconds);
+#elif defined(__linux__)
+	if (timeout > 0)
+	{
+		//relative timeout
+		struct timespec time;
+		time.tv_sec = static_cast<time_t>(timeout / 1000000);
+		time.tv_nsec = static_cast<long>((timeout % 1000000) * 1000);
+		syscall(SYS_futex, reinterpret_cast<uint32_t*>(&word), FUTEX_WAIT_PRIVATE, expected, &time, nullptr, 0);
+	}
+	else
+	{
+		syscall(SYS_futex, reinterpret_cast<uint32_t*>(&word), FUTEX_WAIT_PRIVATE, expected, nullptr, nullptr, 0);
+	}
+#else
+	MsvParkingBucket& bucket = GetParkingBucket(word);
+	std::unique_lock<std::mutex> lock(bucket.mutex);
+
+	//word is checked under bucket lock -> wake (which locks bucket after word change) can't be missed
+	if (word.load(std::memory_order_acquire) != expected)
+	{
+		return;
+	}
+
+	if (timeout > 0)
+	{
+		bucket.condition.wait_for(lock, std::chrono::microseconds(timeout));
+	}
+	else
+	{
+		bucket.condition.wait(lock);
+	}
+#endif
+}
+
+void MsvFutexWake(std::atomic<uint32_t>& word, bool all)
+{
+#if defined(_WIN32)
+	if (all)
+	{
+		WakeByAddressAll(&word);
+	}
+	else
+	{
+		WakeByAddressSingle(&word);
+	}
+#elif defined(__linux__)
+	syscall(SYS_futex, reinterpret_cast<uint32_t*>(&word), FUTEX_WAKE_PRIVATE, all ? INT32_MAX : 1, nullptr, nullptr, 0);
+#else
+	MsvParkingBucket& bucket = GetParkingBucket(word);
+
+	//bucket is shared by more words -> all its threads are woken up (the others wait once again)
+	std::unique_lock<std::mutex> lock(bucket.mutex);
+	lock.unlock();
+	bucket.condition.notify_all();
+	(void)all;
+#endif
+}
+
+/** @} */	//End of group MTHREADING.
@@ -0,0 +1,73 @@
+/**************************************************************************************************//**
+* @addtogroup	MTHREADING
+* @{
+******************************************************************************************************/
+
+/**************************************************************************************************//**
+* @file
+* @brief			MarsTech Futex
+* @details		Defines futex wait and wake (address based waiting) for all platforms.
+* @author		Martin Svoboda
+* @date			16.10.2026
+* @copyright	GNU General Public License (GPLv3).
+******************************************************************************************************/
+
+
+/*
+This file is part of MarsTech Threading.
+
+MarsTech Dependency Injection is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+MarsTech Promise Like Syntax is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with Foobar. If not, see <https://www.gnu.org/licenses/>.
+*/
+
+
+#ifndef MARSTECH_FUTEX_H
+#define MARSTECH_FUTEX_H
+
+
+#include "mheaders/MsvCompiler.h"
+MSV_DISABLE_ALL_WARNINGS
+
+#include <atomic>
+#include <cstdint>
+
+MSV_ENABLE_WARNINGS
+
+
+/**************************************************************************************************//**
+* @brief			Wait on futex word.
+* @details		Blocks calling thread while word contains expected value (until @ref MsvFutexWake is called or
+*					until timeout). It returns immediately when word does not contain expected value. It may return
+*					spuriously (caller must check the word again).
+*					Implementation:
+*					- Linux: futex syscall (private futex).
+*					- Windows: WaitOnAddress.
+*					- Other platforms: mutex and condition variable chosen by hash of the word address.
+* @param[in]	word			Futex word.
+* @param[in]	expected		Expected value of the word.
+* @param[in]	timeout		Timeout in microseconds (zero or negative means infinite wait).
+******************************************************************************************************/
+void MsvFutexWait(std::atomic<uint32_t>& word, uint32_t expected, int64_t timeout);
+
+/**************************************************************************************************//**
+* @brief			Wake threads waiting on futex word.
+* @details		Word must be changed before this call (otherwise woken thread waits once again).
+* @param[in]	word		Futex word.
+* @param[in]	all		Flag if all waiting threads are woken up (true) or only one (false).
+******************************************************************************************************/
+void MsvFutexWake(std::atomic<uint32_t>& word, bool all);
+
+
+#endif // MARSTECH_FUTEX_H
+
+/** @} */	//End of group MTHREADING.
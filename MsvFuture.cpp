@@ -0,0 +1,258 @@
+/**************************************************************************************************//**
+* @addtogroup	MTHREADING
+* @{
+******************************************************************************************************/
+
+/**************************************************************************************************//**
+* @file
+* @brief			MarsTech Future
+* @details		Contains implementation of @ref MsvFutureStateBase.
+* @author		Martin Svoboda
+* @date			16.10.2026
+* @copyright	GNU General Public License (GPLv3).
+******************************************************************************************************/
+
+
+/*
+This file is part of MarsTech Threading.
+
+MarsTech Dependency Injection is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+MarsTech Promise Like Syntax is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with Foobar. If not, see <https://www.gnu.org/licenses/>.
+*/
+
+
+#include "MsvFuture.h"
+#include "IMsvTaskExecutor.h"
+
+MSV_DISABLE_ALL_WARNINGS
+
+#include <mutex>
+#include <condition_variable>
+#include <chrono>
+#include <cstdint>
+
+MSV_ENABLE_WARNINGS
+
+
+/********************************************************************************************************************************
+*															Parking lot
+********************************************************************************************************************************/
+
+
+namespace
+{
+	/**************************************************************************************************//**
+	* @brief		Parking lot bucket.
+	* @details	Waiters of all futures which are hashed to the bucket share its mutex and condition.
+	******************************************************************************************************/
+	struct MsvParkingBucket
+	{
+		std::mutex lock;
+		std::condition_variable condition;
+	};
+
+	/**************************************************************************************************//**
+	* @brief		Count of parking lot buckets.
+	******************************************************************************************************/
+	const size_t MSV_PARKING_LOT_SIZE = 64;
+
+	/**************************************************************************************************//**
+	* @brief		Returns parking lot bucket of address.
+	******************************************************************************************************/
+	MsvParkingBucket& GetParkingBucket(const void* pAddress)
+	{
+		static MsvParkingBucket parkingLot[MSV_PARKING_LOT_SIZE];
+
+		//low bits are the same for aligned objects
+		uintptr_t address = reinterpret_cast<uintptr_t>(pAddress);
+		return parkingLot[((address >> 4) ^ (address >> 12)) % MSV_PARKING_LOT_SIZE];
+	}
+}
+
+
+/********************************************************************************************************************************
+*															Static members
+********************************************************************************************************************************/
+
+
+const uint32_t MsvFutureStateBase::MSV_FUTURE_SPIN_COUNT;
+
+
+/********************************************************************************************************************************
+*															Constructors and destructors
+********************************************************************************************************************************/
+
+
+MsvFutureStateBase::MsvFutureStateBase():
+	m_ready(false),
+	m_waiters(0),
+	m_pCallbacks(nullptr),
+	m_pContinuationExecutor(nullptr),
+	m_continuationMode(MsvContinuationMode::MSV_CONTINUATION_ASYNC)
+{
+
+}
+
+MsvFutureStateBase::~MsvFutureStateBase()
+{
+
+}
+
+
+/********************************************************************************************************************************
+*															MsvFutureStateBase public methods
+********************************************************************************************************************************/
+
+
+bool MsvFutureStateBase::IsReady() const
+{
+	return m_ready.load(std::memory_order_acquire);
+}
+
+void MsvFutureStateBase::Wait() const
+{
+	//short tasks are ready soon
+	for (uint32_t i = 0; i < MSV_FUTURE_SPIN_COUNT; ++i)
+	{
+		if (IsReady())
+		{
+			return;
+		}
+	}
+
+	MsvParkingBucket& bucket = GetParkingBucket(this);
+	std::unique_lock<std::mutex> lock(bucket.lock);
+
+	//seq_cst increment pairs with seq_cst store in SetReady (waiter is counted or it sees ready state)
+	++m_waiters;
+	bucket.condition.wait(lock, [this] { return m_ready.load(); });
+	--m_waiters;
+}
+
+bool MsvFutureStateBase::WaitFor(int32_t timeout) const
+{
+	for (uint32_t i = 0; i < MSV_FUTURE_SPIN_COUNT; ++i)
+	{
+		if (IsReady())
+		{
+			return true;
+		}
+	}
+
+	MsvParkingBucket& bucket = GetParkingBucket(this);
+	std::unique_lock<std::mutex> lock(bucket.lock);
+
+	++m_waiters;
+	bool ready = bucket.condition.wait_for(lock, std::chrono::microseconds(timeout), [this] { return m_ready.load(); });
+	--m_waiters;
+
+	return ready;
+}
+
+void MsvFutureStateBase::AddCallback(MsvFutureCallback* pCallback)
+{
+	MsvFutureCallback* pHead = m_pCallbacks.load(std::memory_order_acquire);
+	do
+	{
+		if (pHead == this)
+		{
+			//this state is ready already -> call callback now
+			pCallback->OnFutureReady();
+			return;
+		}
+
+		pCallback->m_pNextCallback = pHead;
+	}
+	while (!m_pCallbacks.compare_exchange_weak(pHead, pCallback, std::memory_order_acq_rel, std::memory_order_acquire));
+}
+
+void MsvFutureStateBase::AddContinuation(std::shared_ptr<MsvFutureStateBase> spContinuation, IMsvTaskExecutor* pExecutor, MsvContinuationMode mode)
+{
+	MsvFutureStateBase* pContinuation = spContinuation.get();
+	pContinuation->m_spContinuationSelf = std::move(spContinuation);
+	pContinuation->m_pContinuationExecutor = pExecutor;
+	pContinuation->m_continuationMode = mode;
+
+	AddCallback(pContinuation);
+}
+
+
+/********************************************************************************************************************************
+*															MsvFutureStateBase protected methods
+********************************************************************************************************************************/
+
+
+void MsvFutureStateBase::SetReady()
+{
+	m_ready.store(true);
+
+	if (m_waiters.load())
+	{
+		//lock ensures that waiter which has been counted already waits (bucket is shared -> notify all)
+		MsvParkingBucket& bucket = GetParkingBucket(this);
+		{
+			std::lock_guard<std::mutex> lock(bucket.lock);
+		}
+		bucket.condition.notify_all();
+	}
+
+	//take callbacks (this state as list head means that callbacks are called immediately)
+	MsvFutureCallback* pCallback = m_pCallbacks.exchange(this, std::memory_order_acq_rel);
+
+	//list is in reverse order -> the first added callback is called first
+	MsvFutureCallback* pReversed = nullptr;
+	while (pCallback)
+	{
+		MsvFutureCallback* pNext = pCallback->m_pNextCallback;
+		pCallback->m_pNextCallback = pReversed;
+		pReversed = pCallback;
+		pCallback = pNext;
+	}
+
+	while (pReversed)
+	{
+		//callback might be released by the call
+		MsvFutureCallback* pNext = pReversed->m_pNextCallback;
+		pReversed->OnFutureReady();
+		pReversed = pNext;
+	}
+}
+
+void MsvFutureStateBase::OnFutureReady()
+{
+	std::shared_ptr<MsvFutureStateBase> spSelf(std::move(m_spContinuationSelf));
+	m_pNextCallback = nullptr;
+
+	if (m_continuationMode == MsvContinuationMode::MSV_CONTINUATION_ASYNC && m_pContinuationExecutor && MSV_SUCCEEDED(m_pContinuationExecutor->AddTask(spSelf)))
+	{
+		return;
+	}
+
+	//inline continuation (or executor did not accept it)
+	static_cast<IMsvTask*>(spSelf.get())->Execute();
+}
+
+void MsvFutureStateBase::SetException()
+{
+	m_exception = std::current_exception();
+}
+
+void MsvFutureStateBase::RethrowException() const
+{
+	if (m_exception)
+	{
+		std::rethrow_exception(m_exception);
+	}
+}
+
+/** @} */	//End of group MTHREADING.
@@ -0,0 +1,611 @@
+/**************************************************************************************************//**
+* @addtogroup	MTHREADING
+* @{
+******************************************************************************************************/
+
+/**************************************************************************************************//**
+* @file
+* @brief			MarsTech Future
+* @details		Contains declaration of @ref MsvFuture and its shared state (task which stores its result).
+* @author		Martin Svoboda
+* @date			16.10.2026
+* @copyright	GNU General Public License (GPLv3).
+******************************************************************************************************/
+
+
+/*
+This file is part of MarsTech Threading.
+
+MarsTech Dependency Injection is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+MarsTech Promise Like Syntax is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with Foobar. If not, see <https://www.gnu.org/licenses/>.
+*/
+
+
+#ifndef MARSTECH_FUTURE_H
+#define MARSTECH_FUTURE_H
+
+
+#include "IMsvTask.h"
+#include "MsvContinuationMode.h"
+
+#include "merror/MsvErrorCodes.h"
+
+MSV_DISABLE_ALL_WARNINGS
+
+#include <atomic>
+#include <memory>
+#include <exception>
+#include <stdexcept>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+MSV_ENABLE_WARNINGS
+
+
+//forward declaration of MarsTech Task Executor Interface (it submits callables and returns futures)
+class IMsvTaskExecutor;
+
+
+/**************************************************************************************************//**
+* @brief		MarsTech Future Callback.
+* @details	Intrusive node of future callback list. It is called once by the thread which completes the future.
+* @see		MsvFutureStateBase::AddCallback
+******************************************************************************************************/
+class MsvFutureCallback
+{
+public:
+	/**************************************************************************************************//**
+	* @brief		Constructor.
+	******************************************************************************************************/
+	MsvFutureCallback():
+		m_pNextCallback(nullptr)
+	{
+
+	}
+
+	/**************************************************************************************************//**
+	* @brief		Virtual destructor.
+	******************************************************************************************************/
+	virtual ~MsvFutureCallback() {}
+
+	/**************************************************************************************************//**
+	* @brief		Future is ready.
+	* @details	Callback must not be released before it is called (future references it).
+	******************************************************************************************************/
+	virtual void OnFutureReady() = 0;
+
+protected:
+	//future state links callbacks
+	friend class MsvFutureStateBase;
+
+	/**************************************************************************************************//**
+	* @brief		The next callback in the list.
+	******************************************************************************************************/
+	MsvFutureCallback* m_pNextCallback;
+};
+
+
+/**************************************************************************************************//**
+* @brief		MarsTech Future State Base.
+* @details	Task which stores result of its execution (result and task are one allocation). Waiters spin
+*				for a while and then they park in shared parking lot (mutex and condition variable are not
+*				allocated per future). Ready state is set once (after result or exception is stored).
+*				Callbacks (e.g. continuations) are kept in lock-free intrusive list (continuation is future
+*				state too, so it does not need any other allocation) and they are called by the thread which
+*				sets ready state.
+* @see		MsvFutureState
+******************************************************************************************************/
+class MsvFutureStateBase:
+	public IMsvTask,
+	public MsvFutureCallback
+{
+public:
+	/**************************************************************************************************//**
+	* @brief		Constructor.
+	******************************************************************************************************/
+	MsvFutureStateBase();
+
+	/**************************************************************************************************//**
+	* @brief		Virtual destructor.
+	******************************************************************************************************/
+	virtual ~MsvFutureStateBase();
+
+	/**************************************************************************************************//**
+	* @brief			Check if result (or exception) is ready.
+	* @returns		bool
+	* @retval		true		When result is ready.
+	* @retval		false		When task has not been executed yet.
+	******************************************************************************************************/
+	bool IsReady() const;
+
+	/**************************************************************************************************//**
+	* @brief			Wait until result is ready.
+	******************************************************************************************************/
+	void Wait() const;
+
+	/**************************************************************************************************//**
+	* @brief			Wait until result is ready or until timeout.
+	* @param[in]	timeout		Timeout in microseconds.
+	* @returns		bool
+	* @retval		true		When result is ready.
+	* @retval		false		When timeout elapsed.
+	******************************************************************************************************/
+	bool WaitFor(int32_t timeout) const;
+
+	/**************************************************************************************************//**
+	* @brief			Add callback.
+	* @details		Callback is called when this state becomes ready (or immediately when it is ready
+	*					already). It never blocks.
+	* @param[in]	pCallback		Callback (it must be valid until it is called).
+	******************************************************************************************************/
+	void AddCallback(MsvFutureCallback* pCallback);
+
+	/**************************************************************************************************//**
+	* @brief			Add continuation.
+	* @details		Continuation is scheduled when this state becomes ready (or immediately when it is ready
+	*					already). It never blocks.
+	* @param[in]	spContinuation		Continuation (it is kept alive until it is scheduled).
+	* @param[in]	pExecutor			Executor for asynchronous continuation (nullptr means inline).
+	* @param[in]	mode					Continuation mode.
+	* @note			Asynchronous continuation which can't be added to executor is executed inline.
+	******************************************************************************************************/
+	void AddContinuation(std::shared_ptr<MsvFutureStateBase> spContinuation, IMsvTaskExecutor* pExecutor, MsvContinuationMode mode);
+
+protected:
+	/**************************************************************************************************//**
+	* @brief			Schedule this continuation (add it to its executor or execute it inline).
+	* @details		It is called when antecedent of this continuation is ready.
+	******************************************************************************************************/
+	virtual void OnFutureReady() override;
+
+	/**************************************************************************************************//**
+	* @brief			Set ready state and wake up parked waiters.
+	* @details		It must be called once (after result or exception is stored).
+	******************************************************************************************************/
+	void SetReady();
+
+	/**************************************************************************************************//**
+	* @brief			Store current exception.
+	* @details		It is called from catch block of the task execution.
+	******************************************************************************************************/
+	void SetException();
+
+	/**************************************************************************************************//**
+	* @brief			Rethrow stored exception (if any).
+	******************************************************************************************************/
+	void RethrowException() const;
+
+protected:
+	/**************************************************************************************************//**
+	* @brief		Count of checks before waiter parks.
+	******************************************************************************************************/
+	static const uint32_t MSV_FUTURE_SPIN_COUNT = 64;
+
+	/**************************************************************************************************//**
+	* @brief		Flag if result is ready (true) or not (false).
+	******************************************************************************************************/
+	std::atomic<bool> m_ready;
+
+	/**************************************************************************************************//**
+	* @brief		Count of parked waiters.
+	* @details	Parking lot is notified only when somebody waits.
+	******************************************************************************************************/
+	mutable std::atomic<uint32_t> m_waiters;
+
+	/**************************************************************************************************//**
+	* @brief		Exception thrown by the task.
+	******************************************************************************************************/
+	std::exception_ptr m_exception;
+
+	/**************************************************************************************************//**
+	* @brief		Head of callback list.
+	* @details	It points to this state when state is ready (callbacks are called immediately then).
+	******************************************************************************************************/
+	std::atomic<MsvFutureCallback*> m_pCallbacks;
+
+	/**************************************************************************************************//**
+	* @brief		Reference to this continuation (it keeps continuation alive until it is scheduled).
+	******************************************************************************************************/
+	std::shared_ptr<MsvFutureStateBase> m_spContinuationSelf;
+
+	/**************************************************************************************************//**
+	* @brief		Executor of this continuation.
+	******************************************************************************************************/
+	IMsvTaskExecutor* m_pContinuationExecutor;
+
+	/**************************************************************************************************//**
+	* @brief		Mode of this continuation.
+	******************************************************************************************************/
+	MsvContinuationMode m_continuationMode;
+};
+
+
+/**************************************************************************************************//**
+* @brief		MarsTech Future State.
+* @details	Stores result of type T (in place, it is constructed by the task execution).
+* @see		MsvFutureStateBase
+******************************************************************************************************/
+template<typename T>
+class MsvFutureState:
+	public MsvFutureStateBase
+{
+public:
+	/**************************************************************************************************//**
+	* @brief		Constructor.
+	******************************************************************************************************/
+	MsvFutureState():
+		m_hasResult(false)
+	{
+
+	}
+
+	/**************************************************************************************************//**
+	* @brief		Virtual destructor.
+	******************************************************************************************************/
+	virtual ~MsvFutureState()
+	{
+		if (m_hasResult)
+		{
+			reinterpret_cast<T*>(&m_result)->~T();
+		}
+	}
+
+	/**************************************************************************************************//**
+	* @brief			Get result.
+	* @details		Moves result out of the state (it can be called only once) or rethrows stored exception.
+	* @returns		T
+	* @warning		Result must be ready.
+	******************************************************************************************************/
+	T GetResult()
+	{
+		RethrowException();
+		return std::move(*reinterpret_cast<T*>(&m_result));
+	}
+
+protected:
+	/**************************************************************************************************//**
+	* @brief			Run callable and store its result (or exception).
+	* @param[in]	callable		Callable which returns T.
+	******************************************************************************************************/
+	template<typename Callable>
+	void Run(Callable& callable)
+	{
+		try
+		{
+			new (&m_result) T(callable());
+			m_hasResult = true;
+		}
+		catch (...)
+		{
+			SetException();
+		}
+
+		SetReady();
+	}
+
+protected:
+	/**************************************************************************************************//**
+	* @brief		Result storage (it is valid when @ref m_hasResult is set).
+	******************************************************************************************************/
+	typename std::aligned_storage<sizeof(T), alignof(T)>::type m_result;
+
+	/**************************************************************************************************//**
+	* @brief		Flag if result has been constructed (true) or not (false).
+	******************************************************************************************************/
+	bool m_hasResult;
+};
+
+
+/**************************************************************************************************//**
+* @brief		MarsTech Future State (without result).
+* @see		MsvFutureStateBase
+******************************************************************************************************/
+template<>
+class MsvFutureState<void>:
+	public MsvFutureStateBase
+{
+public:
+	/**************************************************************************************************//**
+	* @brief			Get result.
+	* @details		Rethrows stored exception (if any).
+	* @warning		Result must be ready.
+	******************************************************************************************************/
+	void GetResult()
+	{
+		RethrowException();
+	}
+
+protected:
+	/**************************************************************************************************//**
+	* @brief			Run callable (and store its exception).
+	* @param[in]	callable		Callable which returns void.
+	******************************************************************************************************/
+	template<typename Callable>
+	void Run(Callable& callable)
+	{
+		try
+		{
+			callable();
+		}
+		catch (...)
+		{
+			SetException();
+		}
+
+		SetReady();
+	}
+};
+
+
+/**************************************************************************************************//**
+* @brief		MarsTech Future Task.
+* @details	Task which executes callable and stores its result. Callable, result and task are one object.
+* @see		MsvFuture
+******************************************************************************************************/
+template<typename T, typename Callable>
+class MsvFutureTask:
+	public MsvFutureState<T>
+{
+public:
+	/**************************************************************************************************//**
+	* @brief			Constructor.
+	* @param[in]	callable		Callable which returns T (it is moved or copied to the task).
+	******************************************************************************************************/
+	template<typename Function>
+	explicit MsvFutureTask(Function&& callable):
+		m_callable(std::forward<Function>(callable))
+	{
+
+	}
+
+protected:
+	/**************************************************************************************************//**
+	* @copydoc IMsvTask::Execute()
+	******************************************************************************************************/
+	virtual void Execute() override
+	{
+		this->Run(m_callable);
+	}
+
+protected:
+	/**************************************************************************************************//**
+	* @brief		Callable.
+	******************************************************************************************************/
+	Callable m_callable;
+};
+
+
+//forward declaration of MarsTech Future
+template<typename T>
+class MsvFuture;
+
+
+/**************************************************************************************************//**
+* @brief		MarsTech Continuation Function.
+* @details	Callable of continuation task. It calls function with antecedent future (it is ready then).
+* @see		MsvFuture::Then
+******************************************************************************************************/
+template<typename T, typename Function>
+class MsvContinuationFunction
+{
+public:
+	/**************************************************************************************************//**
+	* @brief			Constructor.
+	* @param[in]	antecedent		Antecedent future.
+	* @param[in]	function			Continuation function (it is moved or copied).
+	******************************************************************************************************/
+	template<typename Callable>
+	MsvContinuationFunction(const MsvFuture<T>& antecedent, Callable&& function):
+		m_antecedent(antecedent),
+		m_function(std::forward<Callable>(function))
+	{
+
+	}
+
+	/**************************************************************************************************//**
+	* @brief			Call continuation function.
+	* @returns		Result of continuation function.
+	******************************************************************************************************/
+	typename std::result_of<Function(MsvFuture<T>&)>::type operator()()
+	{
+		return m_function(m_antecedent);
+	}
+
+protected:
+	/**************************************************************************************************//**
+	* @brief		Antecedent future.
+	******************************************************************************************************/
+	MsvFuture<T> m_antecedent;
+
+	/**************************************************************************************************//**
+	* @brief		Continuation function.
+	******************************************************************************************************/
+	Function m_function;
+};
+
+
+/**************************************************************************************************//**
+* @brief		MarsTech Future.
+* @details	Handle of result of submitted task. Future is not valid when the task has not been submitted (its
+*				error code says why).
+* @note		Task which is never executed (e.g. dropped by queue full policy) never becomes ready (and its
+*				continuations are never executed).
+* @see		IMsvTaskExecutor::Submit
+******************************************************************************************************/
+template<typename T>
+class MsvFuture
+{
+public:
+	/**************************************************************************************************//**
+	* @brief			Constructor.
+	* @details		Creates not valid future.
+	* @param[in]	errorCode		Reason why future is not valid.
+	******************************************************************************************************/
+	MsvFuture(MsvErrorCode errorCode = MSV_NOT_INITIALIZED_ERROR):
+		m_pExecutor(nullptr),
+		m_errorCode(errorCode)
+	{
+
+	}
+
+	/**************************************************************************************************//**
+	* @brief			Constructor.
+	* @param[in]	spState		Shared state (submitted task).
+	* @param[in]	pExecutor	Executor of the task (continuations are added to it).
+	******************************************************************************************************/
+	MsvFuture(std::shared_ptr<MsvFutureState<T>> spState, IMsvTaskExecutor* pExecutor = nullptr):
+		m_spState(spState),
+		m_pExecutor(pExecutor),
+		m_errorCode(spState ? MSV_SUCCESS : MSV_NOT_INITIALIZED_ERROR)
+	{
+
+	}
+
+	/**************************************************************************************************//**
+	* @brief			Get shared state.
+	* @returns		const std::shared_ptr<MsvFutureState<T>>&
+	******************************************************************************************************/
+	const std::shared_ptr<MsvFutureState<T>>& GetState() const
+	{
+		return m_spState;
+	}
+
+	/**************************************************************************************************//**
+	* @brief			Get executor of the task.
+	* @returns		IMsvTaskExecutor*
+	* @retval		nullptr		When the task has no executor.
+	******************************************************************************************************/
+	IMsvTaskExecutor* GetExecutor() const
+	{
+		return m_pExecutor;
+	}
+
+	/**************************************************************************************************//**
+	* @brief			Check if future is valid (it has shared state).
+	* @returns		bool
+	******************************************************************************************************/
+	bool IsValid() const
+	{
+		return m_spState != nullptr;
+	}
+
+	/**************************************************************************************************//**
+	* @brief			Get error code of submit.
+	* @returns		MsvErrorCode
+	* @retval		MSV_SUCCESS		When future is valid.
+	******************************************************************************************************/
+	MsvErrorCode GetErrorCode() const
+	{
+		return m_errorCode;
+	}
+
+	/**************************************************************************************************//**
+	* @copydoc MsvFutureStateBase::IsReady()
+	******************************************************************************************************/
+	bool IsReady() const
+	{
+		return m_spState && m_spState->IsReady();
+	}
+
+	/**************************************************************************************************//**
+	* @copydoc MsvFutureStateBase::Wait()
+	******************************************************************************************************/
+	void Wait() const
+	{
+		if (m_spState)
+		{
+			m_spState->Wait();
+		}
+	}
+
+	/**************************************************************************************************//**
+	* @copydoc MsvFutureStateBase::WaitFor(int32_t timeout)
+	******************************************************************************************************/
+	bool WaitFor(int32_t timeout) const
+	{
+		return m_spState && m_spState->WaitFor(timeout);
+	}
+
+	/**************************************************************************************************//**
+	* @brief			Get result.
+	* @details		Waits until result is ready and returns it (or rethrows exception of the task). Result is
+	*					moved out, so it can be called only once.
+	* @returns		T
+	* @throws		std::logic_error	When future is not valid.
+	******************************************************************************************************/
+	T Get()
+	{
+		if (!m_spState)
+		{
+			throw std::logic_error("MsvFuture has no state.");
+		}
+
+		m_spState->Wait();
+		return m_spState->GetResult();
+	}
+
+	/**************************************************************************************************//**
+	* @brief			Add continuation.
+	* @details		Function is called with this future (it is ready then) when the task completes. Caller
+	*					never blocks and no thread waits for the task (continuation is scheduled by the thread
+	*					which completes the task).
+	* @param[in]	function		Function which takes MsvFuture<T>& (it is moved or copied to continuation task).
+	* @param[in]	mode			Continuation mode (asynchronous continuation is added to executor of this future).
+	* @returns		MsvFuture
+	* @retval		not valid future when this future is not valid or allocation failed.
+	* @note			Result of this future can be taken (by Get) only once - by continuation or by caller.
+	******************************************************************************************************/
+	template<typename Function>
+	MsvFuture<typename std::result_of<typename std::decay<Function>::type(MsvFuture<T>&)>::type> Then(Function&& function, MsvContinuationMode mode = MsvContinuationMode::MSV_CONTINUATION_ASYNC)
+	{
+		typedef MsvContinuationFunction<T, typename std::decay<Function>::type> Continuation;
+		typedef typename std::result_of<typename std::decay<Function>::type(MsvFuture<T>&)>::type Result;
+
+		if (!m_spState)
+		{
+			return MsvFuture<Result>(m_errorCode);
+		}
+
+		std::shared_ptr<MsvFutureTask<Result, Continuation>> spTask(new (std::nothrow) MsvFutureTask<Result, Continuation>(Continuation(*this, std::forward<Function>(function))));
+		if (!spTask)
+		{
+			return MsvFuture<Result>(MSV_ALLOCATION_ERROR);
+		}
+
+		m_spState->AddContinuation(spTask, m_pExecutor, mode);
+
+		return MsvFuture<Result>(spTask, m_pExecutor);
+	}
+
+protected:
+	/**************************************************************************************************//**
+	* @brief		Shared state (submitted task).
+	******************************************************************************************************/
+	std::shared_ptr<MsvFutureState<T>> m_spState;
+
+	/**************************************************************************************************//**
+	* @brief		Executor of the task (continuations are added to it).
+	******************************************************************************************************/
+	IMsvTaskExecutor* m_pExecutor;
+
+	/**************************************************************************************************//**
+	* @brief		Error code of submit.
+	******************************************************************************************************/
+	MsvErrorCode m_errorCode;
+};
+
+
+#endif // MARSTECH_FUTURE_H
+
+/** @} */	//End of group MTHREADING.
@@ -0,0 +1,203 @@
+/**************************************************************************************************//**
+* @addtogroup	MTHREADING
+* @{
+******************************************************************************************************/
+
+/**************************************************************************************************//**
+* @file
+* @brief			MarsTech Idle Worker Stack
+* @details		Contains implementation of @ref MsvIdleWorkerStack.
+* @author		Martin Svoboda
+* @date			16.10.2026
+* @copyright	GNU General Public License (GPLv3).
+******************************************************************************************************/
+
+
+/*
+This file is part of MarsTech Threading.
+
+MarsTech Dependency Injection is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+MarsTech Promise Like Syntax is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with Foobar. If not, see <https://www.gnu.org/licenses/>.
+*/
+
+
+#include "MsvIdleWorkerStack.h"
+
+
+/********************************************************************************************************************************
+*															Constructors and destructors
+********************************************************************************************************************************/
+
+
+MsvIdleWorkerStack::MsvIdleWorkerStack():
+	m_pTop(nullptr),
+	m_idleCount(0),
+	m_permits(0)
+{
+
+}
+
+MsvIdleWorkerStack::~MsvIdleWorkerStack()
+{
+
+}
+
+
+/********************************************************************************************************************************
+*															MsvIdleWorkerStack public methods
+********************************************************************************************************************************/
+
+
+bool MsvIdleWorkerStack::Wait(MsvSleepSlot& slot, int32_t timeout)
+{
+	//signaled before wait (or woken up after timeout) -> consume signal
+	bool stopped = false;
+	if (slot.TryWait(stopped))
+	{
+		return !stopped;
+	}
+
+	//wake up for nobody -> the first waiting worker consumes it
+	if (TryTakePermit())
+	{
+		return true;
+	}
+
+	std::unique_lock<std::mutex> lock(m_lock);
+
+	//the latest idle worker is on top
+	slot.pNext = m_pTop;
+	slot.idle = true;
+	m_pTop = &slot;
+	m_idleCount.fetch_add(1, std::memory_order_seq_cst);
+
+	//check permits once again (seq_cst pairs with Wake: it adds permits first and then it checks idle count)
+	if (TryTakePermit())
+	{
+		RemoveSlot(slot);
+		return true;
+	}
+	lock.unlock();
+
+	bool woken = slot.Wait(timeout);
+
+	//leave the stack (signaled or timed out slot may be still there)
+	lock.lock();
+	bool popped = !slot.idle;
+	RemoveSlot(slot);
+	lock.unlock();
+
+	if (!woken && popped)
+	{
+		//stopped slot has been popped by wake -> pass its wake up to another worker
+		Wake(1);
+	}
+
+	return woken;
+}
+
+void MsvIdleWorkerStack::Wake(size_t count)
+{
+	m_permits.fetch_add(count, std::memory_order_seq_cst);
+
+	//nobody is idle -> workers consume permits without waiting (no lock, no syscall)
+	if (!m_idleCount.load(std::memory_order_seq_cst))
+	{
+		return;
+	}
+
+	std::lock_guard<std::mutex> lock(m_lock);
+
+	//exactly one slot for each wake up
+	while (m_pTop && TryTakePermit())
+	{
+		MsvSleepSlot* pSlot = m_pTop;
+		m_pTop = pSlot->pNext;
+		pSlot->pNext = nullptr;
+		pSlot->idle = false;
+		m_idleCount.fetch_sub(1, std::memory_order_relaxed);
+
+		if (pSlot->IsSignaled())
+		{
+			//slot has been already signaled (or stopped) -> it wakes up anyway, give wake up back
+			m_permits.fetch_add(1, std::memory_order_relaxed);
+			continue;
+		}
+
+		pSlot->Signal();
+	}
+}
+
+void MsvIdleWorkerStack::Signal(MsvSleepSlot& slot)
+{
+	slot.Signal();
+}
+
+void MsvIdleWorkerStack::Stop(MsvSleepSlot& slot)
+{
+	slot.Stop();
+}
+
+size_t MsvIdleWorkerStack::GetIdleCount() const
+{
+	return m_idleCount.load(std::memory_order_acquire);
+}
+
+uint64_t MsvIdleWorkerStack::GetPermitCount() const
+{
+	return m_permits.load(std::memory_order_acquire);
+}
+
+
+/********************************************************************************************************************************
+*															MsvIdleWorkerStack protected methods
+********************************************************************************************************************************/
+
+
+bool MsvIdleWorkerStack::TryTakePermit()
+{
+	uint64_t permits = m_permits.load(std::memory_order_seq_cst);
+	while (permits)
+	{
+		if (m_permits.compare_exchange_weak(permits, permits - 1, std::memory_order_seq_cst))
+		{
+			return true;
+		}
+	}
+
+	return false;
+}
+
+void MsvIdleWorkerStack::RemoveSlot(MsvSleepSlot& slot)
+{
+	if (!slot.idle)
+	{
+		return;
+	}
+
+	//stack is short (one slot for each worker)
+	for (MsvSleepSlot** ppSlot = &m_pTop; *ppSlot; ppSlot = &(*ppSlot)->pNext)
+	{
+		if (*ppSlot == &slot)
+		{
+			*ppSlot = slot.pNext;
+			break;
+		}
+	}
+
+	slot.pNext = nullptr;
+	slot.idle = false;
+	m_idleCount.fetch_sub(1, std::memory_order_relaxed);
+}
+
+/** @} */	//End of group MTHREADING.
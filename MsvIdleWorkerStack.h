@@ -0,0 +1,169 @@
+/**************************************************************************************************//**
+* @addtogroup	MTHREADING
+* @{
+******************************************************************************************************/
+
+/**************************************************************************************************//**
+* @file
+* @brief			MarsTech Idle Worker Stack
+* @details		Defines sleep slot of worker and stack of idle workers (targeted wake ups).
+* @author		Martin Svoboda
+* @date			16.10.2026
+* @copyright	GNU General Public License (GPLv3).
+******************************************************************************************************/
+
+
+/*
+This file is part of MarsTech Threading.
+
+MarsTech Dependency Injection is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+MarsTech Promise Like Syntax is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with Foobar. If not, see <https://www.gnu.org/licenses/>.
+*/
+
+
+#ifndef MARSTECH_IDLEWORKERSTACK_H
+#define MARSTECH_IDLEWORKERSTACK_H
+
+
+#include "MsvSleepSlot.h"
+
+#include "mheaders/MsvCompiler.h"
+MSV_DISABLE_ALL_WARNINGS
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+
+MSV_ENABLE_WARNINGS
+
+
+/**************************************************************************************************//**
+* @brief		MarsTech Idle Worker Stack.
+* @details	Replaces shared condition variable (with shared predicate) of workers:
+*				- Idle worker pushes its sleep slot to the stack and waits in the slot.
+*				- @ref Wake pops exactly count slots and signals them (the latest idle worker first, it has the
+*					warmest cache). Wake ups for nobody are stored as permits, so worker which is going to wait
+*					returns immediately (the same as shared predicate).
+*				- @ref Signal wakes up one particular worker (targeted notify).
+*				Fast paths are lock-free and without syscall: wait with permit (or signal), wake when no worker
+*				is idle and signal of awake worker. Stack mutex is locked only when any worker is going to sleep
+*				(or it sleeps) and futex wake syscall is called only for sleeping worker.
+* @see		MsvSleepSlot
+* @see		MsvThread
+******************************************************************************************************/
+class MsvIdleWorkerStack
+{
+public:
+	/**************************************************************************************************//**
+	* @brief		Constructor.
+	******************************************************************************************************/
+	MsvIdleWorkerStack();
+
+	/**************************************************************************************************//**
+	* @brief		Virtual destructor.
+	******************************************************************************************************/
+	virtual ~MsvIdleWorkerStack();
+
+	/**************************************************************************************************//**
+	* @brief			Wait in sleep slot.
+	* @details		Returns immediately when slot has been signaled or when there is any permit. Otherwise slot
+	*					is pushed to the stack and calling thread waits until it is signaled (or until timeout).
+	* @param[in]	slot			Sleep slot of calling thread.
+	* @param[in]	timeout		Timeout in microseconds (zero or negative means infinite wait).
+	* @returns		bool
+	* @retval		true		When thread has been woken up (or timeout has expired).
+	* @retval		false		When slot has been stopped.
+	******************************************************************************************************/
+	virtual bool Wait(MsvSleepSlot& slot, int32_t timeout);
+
+	/**************************************************************************************************//**
+	* @brief			Wake up idle workers.
+	* @details		Signals up to count the latest idle workers. The rest of count is stored as permits.
+	*					Stack is not locked when there is no idle worker.
+	* @param[in]	count		Count of wake ups.
+	******************************************************************************************************/
+	virtual void Wake(size_t count);
+
+	/**************************************************************************************************//**
+	* @brief			Signal sleep slot.
+	* @details		Wakes up owner of the slot (its next wait returns immediately when it does not wait now).
+	*					Signaled slot leaves the stack by itself (it does not consume any wake up).
+	* @param[in]	slot		Sleep slot to signal.
+	******************************************************************************************************/
+	virtual void Signal(MsvSleepSlot& slot);
+
+	/**************************************************************************************************//**
+	* @brief			Stop sleep slot.
+	* @details		Wakes up owner of the slot and all its following waits return false.
+	* @param[in]	slot		Sleep slot to stop.
+	******************************************************************************************************/
+	virtual void Stop(MsvSleepSlot& slot);
+
+	/**************************************************************************************************//**
+	* @brief			Get count of idle workers.
+	* @returns		size_t
+	******************************************************************************************************/
+	virtual size_t GetIdleCount() const;
+
+	/**************************************************************************************************//**
+	* @brief			Get count of permits.
+	* @details		Wake ups which have not been consumed by any worker yet.
+	* @returns		uint64_t
+	******************************************************************************************************/
+	virtual uint64_t GetPermitCount() const;
+
+protected:
+	/**************************************************************************************************//**
+	* @brief			Try to consume one permit.
+	* @returns		bool
+	* @retval		true		When permit has been consumed.
+	* @retval		false		When there is no permit.
+	******************************************************************************************************/
+	bool TryTakePermit();
+
+	/**************************************************************************************************//**
+	* @brief			Remove slot from the stack.
+	* @details		It does nothing when slot is not in the stack (stack mutex must be locked).
+	* @param[in]	slot		Sleep slot to remove.
+	******************************************************************************************************/
+	void RemoveSlot(MsvSleepSlot& slot);
+
+protected:
+	/**************************************************************************************************//**
+	* @brief		Stack mutex.
+	* @details	Locks stack and idle flags of slots. Permits and idle count are atomic (they are read
+	*				without lock), but they are changed under lock when stack is changed.
+	******************************************************************************************************/
+	mutable std::mutex m_lock;
+
+	/**************************************************************************************************//**
+	* @brief		The latest idle slot (top of the stack).
+	******************************************************************************************************/
+	MsvSleepSlot* m_pTop;
+
+	/**************************************************************************************************//**
+	* @brief		Count of slots in the stack.
+	******************************************************************************************************/
+	std::atomic<size_t> m_idleCount;
+
+	/**************************************************************************************************//**
+	* @brief		Count of wake ups which have not been consumed yet.
+	******************************************************************************************************/
+	std::atomic<uint64_t> m_permits;
+};
+
+
+#endif // MARSTECH_IDLEWORKERSTACK_H
+
+/** @} */	//End of group MTHREADING.
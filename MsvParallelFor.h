@@ -0,0 +1,185 @@
+/**************************************************************************************************//**
+* @addtogroup	MTHREADING
+* @{
+******************************************************************************************************/
+
+/**************************************************************************************************//**
+* @file
+* @brief			MarsTech Parallel For
+* @details		Contains declaration and implementation of @ref MsvParallelFor.
+* @author		Martin Svoboda
+* @date			16.10.2026
+* @copyright	GNU General Public License (GPLv3).
+******************************************************************************************************/
+
+
+/*
+This file is part of MarsTech Threading.
+
+MarsTech Dependency Injection is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+MarsTech Promise Like Syntax is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with Foobar. If not, see <https://www.gnu.org/licenses/>.
+*/
+
+
+#ifndef MARSTECH_PARALLELFOR_H
+#define MARSTECH_PARALLELFOR_H
+
+
+#include "MsvTaskGroup.h"
+
+#include "merror/MsvError.h"
+
+MSV_DISABLE_ALL_WARNINGS
+
+#include <algorithm>
+#include <memory>
+
+MSV_ENABLE_WARNINGS
+
+
+template<typename Index, typename Body>
+void MsvParallelForRange(MsvTaskGroup& group, IMsvThreadPool& threadPool, Index begin, Index end, Index grainSize, const Body& body);
+
+
+/**************************************************************************************************//**
+* @brief		MarsTech Parallel For Task.
+* @details	Executes part of the range which has been split off (it can be split again).
+* @see		MsvParallelFor
+******************************************************************************************************/
+template<typename Index, typename Body>
+class MsvParallelForTask:
+	public IMsvTask
+{
+public:
+	/**************************************************************************************************//**
+	* @brief			Constructor.
+	* @param[in]	group				Group which tracks the loop tasks.
+	* @param[in]	threadPool		Thread pool which executes the loop.
+	* @param[in]	begin				The first index.
+	* @param[in]	end				Index after the last one.
+	* @param[in]	grainSize		Count of iterations between split checks.
+	* @param[in]	body				Loop body (it is referenced).
+	******************************************************************************************************/
+	MsvParallelForTask(MsvTaskGroup& group, IMsvThreadPool& threadPool, Index begin, Index end, Index grainSize, const Body& body):
+		m_group(group),
+		m_threadPool(threadPool),
+		m_begin(begin),
+		m_end(end),
+		m_grainSize(grainSize),
+		m_body(body)
+	{
+
+	}
+
+protected:
+	/**************************************************************************************************//**
+	* @copydoc IMsvTask::Execute()
+	******************************************************************************************************/
+	virtual void Execute() override
+	{
+		MsvParallelForRange(m_group, m_threadPool, m_begin, m_end, m_grainSize, m_body);
+	}
+
+protected:
+	MsvTaskGroup& m_group;
+	IMsvThreadPool& m_threadPool;
+	Index m_begin;
+	Index m_end;
+	Index m_grainSize;
+	const Body& m_body;
+};
+
+
+/**************************************************************************************************//**
+* @brief			Execute range of loop with lazy binary splitting.
+* @details		Iterations are executed by chunks of grain size. Before each chunk the rest of the range is split
+*					in half when current thread has no queued task (idle workers would have nothing to take). Busy
+*					thread pool does not split at all, idle workers get work on demand.
+* @param[in]	group				Group which tracks the loop tasks.
+* @param[in]	threadPool		Thread pool which executes the loop.
+* @param[in]	begin				The first index.
+* @param[in]	end				Index after the last one.
+* @param[in]	grainSize		Count of iterations between split checks (at least 1).
+* @param[in]	body				Loop body.
+******************************************************************************************************/
+template<typename Index, typename Body>
+void MsvParallelForRange(MsvTaskGroup& group, IMsvThreadPool& threadPool, Index begin, Index end, Index grainSize, const Body& body)
+{
+	while (begin < end)
+	{
+		if (end - begin > grainSize && !threadPool.HasLocalTask())
+		{
+			//the second half is added to thread pool (the first one is hot in cache)
+			Index middle = begin + (end - begin) / 2;
+			std::shared_ptr<IMsvTask> spTask(new (std::nothrow) MsvParallelForTask<Index, Body>(group, threadPool, middle, end, grainSize, body));
+			if (spTask && MSV_SUCCEEDED(group.AddTask(spTask)))
+			{
+				end = middle;
+			}
+		}
+
+		Index chunkEnd = begin + (std::min)(grainSize, static_cast<Index>(end - begin));
+		for (; begin < chunkEnd; ++begin)
+		{
+			body(begin);
+		}
+	}
+}
+
+
+/**************************************************************************************************//**
+* @brief			Execute loop body for each index of range in parallel.
+* @details		Calling thread executes the loop too and it splits the range lazily (see
+*					@ref MsvParallelForRange), so small loops are executed by calling thread only and uneven
+*					iterations are balanced by splitting on demand. The method returns when all iterations are done.
+* @param[in]	spThreadPool		Thread pool which helps with the loop.
+* @param[in]	begin					The first index.
+* @param[in]	end					Index after the last one.
+* @param[in]	body					Loop body (callable with index parameter). It is called concurrently.
+* @param[in]	grainSize			Count of iterations between split checks (0 means automatic - about 1/1024 of
+*											the range, but at least 1).
+* @returns		MsvErrorCode
+* @retval		MSV_NOT_INITIALIZED_ERROR		When thread pool is nullptr.
+* @retval		MSV_SUCCESS							On success.
+* @throws		Exception of the loop body (the first one).
+******************************************************************************************************/
+template<typename Index, typename Body>
+MsvErrorCode MsvParallelFor(std::shared_ptr<IMsvThreadPool> spThreadPool, Index begin, Index end, const Body& body, Index grainSize = 0)
+{
+	if (!spThreadPool)
+	{
+		return MSV_NOT_INITIALIZED_ERROR;
+	}
+
+	if (begin >= end)
+	{
+		return MSV_SUCCESS;
+	}
+
+	if (!grainSize)
+	{
+		grainSize = (std::max)(static_cast<Index>((end - begin) / 1024), static_cast<Index>(1));
+	}
+
+	//group waits for split tasks (its destructor waits even when body throws in this thread)
+	MsvTaskGroup group(spThreadPool);
+	MsvParallelForRange(group, *spThreadPool, begin, end, grainSize, body);
+	group.Wait();
+
+	return MSV_SUCCESS;
+}
+
+
+#endif // MARSTECH_PARALLELFOR_H
+
+/** @} */	//End of group MTHREADING.
@@ -0,0 +1,306 @@
+/**************************************************************************************************//**
+* @addtogroup	MTHREADING
+* @{
+******************************************************************************************************/
+
+/**************************************************************************************************//**
+* @file
+* @brief			MarsTech Parallel Reduce
+* @details		Parallel reduction (and transform-reduction) of index range or random access iterator range executed by thread pool.
+* @author		Martin Svoboda
+* @date			16.10.2026
+* @copyright	GNU General Public License (GPLv3).
+******************************************************************************************************/
+
+
+/*
+This file is part of MarsTech Threading.
+
+MarsTech Dependency Injection is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+MarsTech Promise Like Syntax is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with Foobar. If not, see <https://www.gnu.org/licenses/>.
+*/
+
+
+#ifndef MARSTECH_PARALLELREDUCE_H
+#define MARSTECH_PARALLELREDUCE_H
+
+
+#include "MsvParallelFor.h"
+#include "MsvReduceOrder.h"
+#include "MsvCacheLine.h"
+
+#include "merror/MsvError.h"
+
+MSV_DISABLE_ALL_WARNINGS
+
+#include <algorithm>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+MSV_ENABLE_WARNINGS
+
+
+/**************************************************************************************************//**
+* @brief		MarsTech Reduce Slot.
+* @details	Partial result of parallel reduction (slot is empty until the first value is added).
+* @see		MsvParallelTransformReduce
+******************************************************************************************************/
+template<typename T>
+struct MsvReduceSlot
+{
+	T value;						///< Partial result.
+	bool hasValue;				///< Flag if partial result is set.
+};
+
+
+/**************************************************************************************************//**
+* @brief		MarsTech Reduce Identity.
+* @details	Transformation which returns element itself (it is used by @ref MsvParallelReduce).
+******************************************************************************************************/
+struct MsvReduceIdentity
+{
+	/**************************************************************************************************//**
+	* @brief			Return element.
+	* @param[in]	value		Element.
+	* @returns		const V&
+	******************************************************************************************************/
+	template<typename V>
+	const V& operator()(const V& value) const
+	{
+		return value;
+	}
+};
+
+
+/**************************************************************************************************//**
+* @brief			Get element of index range.
+* @details		Element of index range is the index itself.
+* @param[in]	first		The first index.
+* @param[in]	offset	Offset of element.
+* @returns		Index
+******************************************************************************************************/
+template<typename Index>
+Index MsvReduceElement(Index first, size_t offset, std::true_type)
+{
+	return static_cast<Index>(first + offset);
+}
+
+/**************************************************************************************************//**
+* @brief			Get element of iterator range.
+* @param[in]	first		The first iterator.
+* @param[in]	offset	Offset of element.
+* @returns		Reference to element.
+******************************************************************************************************/
+template<typename Iterator>
+auto MsvReduceElement(Iterator first, size_t offset, std::false_type) -> decltype(*first)
+{
+	return *(first + offset);
+}
+
+
+/**************************************************************************************************//**
+* @brief			Add value to reduce slot.
+* @param[in]	slot		Reduce slot.
+* @param[in]	value		Value to add (it is the right operand of reduce operation).
+* @param[in]	reduce	Reduce operation.
+******************************************************************************************************/
+template<typename T, typename Reduce>
+void MsvReduceSlotAdd(MsvReduceSlot<T>& slot, T&& value, const Reduce& reduce)
+{
+	if (slot.hasValue)
+	{
+		slot.value = reduce(slot.value, value);
+	}
+	else
+	{
+		slot.value = std::move(value);
+		slot.hasValue = true;
+	}
+}
+
+
+/**************************************************************************************************//**
+* @brief			Combine reduce slots in tree.
+* @details		Neighbouring slots are combined in pairs with doubling stride, so left operand is always
+*					the lower slot. Result depends only on slot values (not on scheduling).
+* @param[in]	slots		Reduce slots (they are modified).
+* @param[in]	init		Initial value (it is the left-most operand).
+* @param[in]	reduce	Reduce operation.
+* @returns		T
+******************************************************************************************************/
+template<typename T, typename Reduce>
+T MsvReduceSlotTree(std::vector<MsvCacheLinePadded<MsvReduceSlot<T>>>& slots, T init, const Reduce& reduce)
+{
+	for (size_t stride = 1; stride < slots.size(); stride *= 2)
+	{
+		for (size_t i = 0; i + stride < slots.size(); i += 2 * stride)
+		{
+			if (slots[i + stride].value.hasValue)
+			{
+				MsvReduceSlotAdd(slots[i].value, std::move(slots[i + stride].value.value), reduce);
+			}
+		}
+	}
+
+	if (slots.empty() || !slots[0].value.hasValue)
+	{
+		return init;
+	}
+
+	return reduce(init, slots[0].value.value);
+}
+
+
+/**************************************************************************************************//**
+* @brief			Transform each element of range and reduce results in parallel.
+* @details		Range is divided to blocks of grain size which are executed by @ref MsvParallelFor. Each block
+*					is reduced locally and its result is added to one cache line padded slot (no lock, no false
+*					sharing):
+*					- @ref MsvReduceOrder::MSV_REDUCE_ANY_ORDER - slot of current worker, one more slot of the
+*						calling thread and one more slot (locked) of other threads which are not workers (they can
+*						execute blocks by @ref IMsvThreadPool::TryExecuteTask).
+*					- @ref MsvReduceOrder::MSV_REDUCE_DETERMINISTIC - slot of the block.
+*
+*					Slots are combined in tree at the end (see @ref MsvReduceSlotTree). Deterministic result
+*					depends only on range and grain size (e.g. floating point sum is always the same).
+* @param[in]	spThreadPool		Thread pool which helps with the reduction.
+* @param[in]	first					The first index (or random access iterator).
+* @param[in]	last					Index (or iterator) after the last one.
+* @param[in]	init					Initial value (it is the left-most operand of reduction).
+* @param[in]	reduce				Reduce operation (callable with two T parameters which returns T). It must be
+*											associative (and commutative in any order mode).
+* @param[in]	transform			Transformation (callable with element which returns T). It is called
+*											concurrently.
+* @param[out]	result				Result of reduction (init when range is empty).
+* @param[in]	order					Order of combination.
+* @param[in]	grainSize			Count of elements in block (0 means automatic - about 1/1024 of the range in
+*											any order mode, 1/256 in deterministic mode, but at least 1).
+* @returns		MsvErrorCode
+* @retval		MSV_NOT_INITIALIZED_ERROR		When thread pool is nullptr.
+* @retval		MSV_ALLOCATION_ERROR				When slots allocation failed.
+* @retval		MSV_SUCCESS							On success.
+* @throws		Exception of transform or reduce operation (the first one).
+* @note			T must be default constructible (slots are preallocated).
+******************************************************************************************************/
+template<typename Iterator, typename T, typename Reduce, typename Transform>
+MsvErrorCode MsvParallelTransformReduce(std::shared_ptr<IMsvThreadPool> spThreadPool, Iterator first, Iterator last, T init, const Reduce& reduce, const Transform& transform, T& result, MsvReduceOrder order = MsvReduceOrder::MSV_REDUCE_ANY_ORDER, size_t grainSize = 0)
+{
+	if (!spThreadPool)
+	{
+		return MSV_NOT_INITIALIZED_ERROR;
+	}
+
+	if (!(first < last))
+	{
+		result = std::move(init);
+		return MSV_SUCCESS;
+	}
+
+	bool deterministic = order == MsvReduceOrder::MSV_REDUCE_DETERMINISTIC;
+	size_t count = static_cast<size_t>(last - first);
+	if (!grainSize)
+	{
+		grainSize = (std::max)(count / (deterministic ? 256 : 1024), static_cast<size_t>(1));
+	}
+
+	size_t blockCount = (count + grainSize - 1) / grainSize;
+	size_t slotCount = deterministic ? blockCount : spThreadPool->GetWorkerCount() + 2;
+	std::thread::id callerId = std::this_thread::get_id();
+	std::mutex otherSlotLock;
+
+	std::vector<MsvCacheLinePadded<MsvReduceSlot<T>>> slots;
+	try
+	{
+		slots.resize(slotCount);
+	}
+	catch (const std::bad_alloc&)
+	{
+		return MSV_ALLOCATION_ERROR;
+	}
+
+	IMsvThreadPool& threadPool = *spThreadPool;
+	MsvErrorCode errorCode = MsvParallelFor(spThreadPool, static_cast<size_t>(0), blockCount, [&](size_t block)
+	{
+		size_t begin = block * grainSize;
+		size_t end = (std::min)(begin + grainSize, count);
+
+		//block is reduced locally (transform can help with other tasks, so slot is updated at the end only)
+		T value = transform(MsvReduceElement(first, begin, std::is_integral<Iterator>()));
+		for (size_t i = begin + 1; i < end; ++i)
+		{
+			value = reduce(value, transform(MsvReduceElement(first, i, std::is_integral<Iterator>())));
+		}
+
+		size_t slotIndex = block;
+		if (!deterministic && (!threadPool.GetCurrentWorkerIndex(slotIndex) || slotIndex >= slotCount - 2))
+		{
+			if (std::this_thread::get_id() == callerId)
+			{
+				//calling thread (it is not worker) has its own slot
+				slotIndex = slotCount - 2;
+			}
+			else
+			{
+				//other threads (they help by TryExecuteTask, or elastic workers) share the last slot
+				std::lock_guard<std::mutex> lock(otherSlotLock);
+				MsvReduceSlotAdd(slots[slotCount - 1].value, std::move(value), reduce);
+				return;
+			}
+		}
+
+		MsvReduceSlotAdd(slots[slotIndex].value, std::move(value), reduce);
+	}, static_cast<size_t>(1));
+
+	if (MSV_FAILED(errorCode))
+	{
+		return errorCode;
+	}
+
+	result = MsvReduceSlotTree(slots, std::move(init), reduce);
+
+	return MSV_SUCCESS;
+}
+
+
+/**************************************************************************************************//**
+* @brief			Reduce elements of range in parallel.
+* @details		See @ref MsvParallelTransformReduce (elements are not transformed).
+* @param[in]	spThreadPool		Thread pool which helps with the reduction.
+* @param[in]	first					The first index (or random access iterator).
+* @param[in]	last					Index (or iterator) after the last one.
+* @param[in]	init					Initial value (it is the left-most operand of reduction).
+* @param[in]	reduce				Reduce operation (callable with two T parameters which returns T).
+* @param[out]	result				Result of reduction (init when range is empty).
+* @param[in]	order					Order of combination.
+* @param[in]	grainSize			Count of elements in block (0 means automatic).
+* @returns		MsvErrorCode
+* @retval		MSV_NOT_INITIALIZED_ERROR		When thread pool is nullptr.
+* @retval		MSV_ALLOCATION_ERROR				When slots allocation failed.
+* @retval		MSV_SUCCESS							On success.
+* @throws		Exception of reduce operation (the first one).
+******************************************************************************************************/
+template<typename Iterator, typename T, typename Reduce>
+MsvErrorCode MsvParallelReduce(std::shared_ptr<IMsvThreadPool> spThreadPool, Iterator first, Iterator last, T init, const Reduce& reduce, T& result, MsvReduceOrder order = MsvReduceOrder::MSV_REDUCE_ANY_ORDER, size_t grainSize = 0)
+{
+	return MsvParallelTransformReduce(spThreadPool, first, last, std::move(init), reduce, MsvReduceIdentity(), result, order, grainSize);
+}
+
+
+#endif // MARSTECH_PARALLELREDUCE_H
+
+/** @} */	//End of group MTHREADING.
@@ -0,0 +1,243 @@
+/**************************************************************************************************//**
+* @addtogroup	MTHREADING
+* @{
+******************************************************************************************************/
+
+/**************************************************************************************************//**
+* @file
+* @brief			MarsTech Parallel Scan
+* @details		Parallel inclusive and exclusive prefix scan of random access iterator range executed by thread pool.
+* @author		Martin Svoboda
+* @date			16.10.2026
+* @copyright	GNU General Public License (GPLv3).
+******************************************************************************************************/
+
+
+/*
+This file is part of MarsTech Threading.
+
+MarsTech Dependency Injection is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+MarsTech Promise Like Syntax is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with Foobar. If not, see <https://www.gnu.org/licenses/>.
+*/
+
+
+#ifndef MARSTECH_PARALLELSCAN_H
+#define MARSTECH_PARALLELSCAN_H
+
+
+#include "MsvParallelFor.h"
+#include "MsvCacheLine.h"
+
+#include "merror/MsvError.h"
+
+MSV_DISABLE_ALL_WARNINGS
+
+#include <algorithm>
+#include <iterator>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <vector>
+
+MSV_ENABLE_WARNINGS
+
+
+/**************************************************************************************************//**
+* @brief		Minimal scan block size.
+* @details	Minimal count of elements in one block of parallel scan (when grain size is automatic). Smaller
+*				blocks would be dominated by task overhead (scan is memory bound).
+******************************************************************************************************/
+#define MSV_SCAN_MIN_BLOCK_SIZE 4096
+
+
+/**************************************************************************************************//**
+* @brief			Scan range in parallel.
+* @details		Two-pass scan:
+*					1. Each block is reduced to its total (blocks are executed in parallel).
+*					2. Totals are scanned sequentially (it is short - one value per block) to carries.
+*					3. Each block is scanned with its carry and written to output (blocks are executed in
+*						parallel).
+*
+*					Both parallel passes are tight sequential loops over contiguous elements (the compiler can
+*					vectorize them), so the scan is bound by memory bandwidth. Input is read before output is
+*					written, so output can be the same range as input.
+* @param[in]	spThreadPool		Thread pool which helps with the scan.
+* @param[in]	first					The first input iterator.
+* @param[in]	last					Input iterator after the last one.
+* @param[in]	result				The first output iterator.
+* @param[in]	pInit					Initial value of exclusive scan (nullptr for inclusive scan).
+* @param[in]	op						Associative binary operation.
+* @param[in]	grainSize			Count of elements in block (0 means automatic).
+* @returns		MsvErrorCode
+* @retval		MSV_NOT_INITIALIZED_ERROR		When thread pool is nullptr.
+* @retval		MSV_ALLOCATION_ERROR				When allocation of block totals failed.
+* @retval		MSV_SUCCESS							On success.
+* @throws		Exception of the operation (the first one).
+******************************************************************************************************/
+template<typename InputIterator, typename OutputIterator, typename T, typename Op>
+MsvErrorCode MsvParallelScanRange(std::shared_ptr<IMsvThreadPool> spThreadPool, InputIterator first, InputIterator last, OutputIterator result, const T* pInit, const Op& op, size_t grainSize)
+{
+	if (!spThreadPool)
+	{
+		return MSV_NOT_INITIALIZED_ERROR;
+	}
+
+	if (!(first < last))
+	{
+		return MSV_SUCCESS;
+	}
+
+	size_t count = static_cast<size_t>(last - first);
+	if (!grainSize)
+	{
+		//a few blocks per worker are enough for balancing (each block is read twice)
+		size_t blockCount = (spThreadPool->GetWorkerCount() + 1) * 4;
+		grainSize = (std::max)((count + blockCount - 1) / blockCount, static_cast<size_t>(MSV_SCAN_MIN_BLOCK_SIZE));
+	}
+
+	size_t blockCount = (count + grainSize - 1) / grainSize;
+
+	//block totals (then carries) - each one has its own cache line
+	std::vector<MsvCacheLinePadded<T>> carries;
+	try
+	{
+		carries.resize(blockCount);
+	}
+	catch (const std::bad_alloc&)
+	{
+		return MSV_ALLOCATION_ERROR;
+	}
+
+	MsvErrorCode errorCode = MSV_SUCCESS;
+	if (blockCount > 1)
+	{
+		//the last block total is not needed
+		errorCode = MsvParallelFor(spThreadPool, static_cast<size_t>(0), blockCount - 1, [&](size_t block)
+		{
+			InputIterator it = first + block * grainSize;
+			InputIterator endIt = it + grainSize;
+
+			T total = *it;
+			for (++it; it != endIt; ++it)
+			{
+				total = op(total, *it);
+			}
+
+			carries[block].value = total;
+		}, static_cast<size_t>(1));
+
+		if (MSV_FAILED(errorCode))
+		{
+			return errorCode;
+		}
+	}
+
+	//totals to carries (carry of block is combination of init and all previous blocks)
+	T carry = pInit ? *pInit : T();
+	for (size_t block = 0; block < blockCount; ++block)
+	{
+		T total = carries[block].value;
+		carries[block].value = carry;
+		if (block + 1 < blockCount)
+		{
+			carry = (block || pInit) ? op(carry, total) : total;
+		}
+	}
+
+	return MsvParallelFor(spThreadPool, static_cast<size_t>(0), blockCount, [&](size_t block)
+	{
+		size_t begin = block * grainSize;
+		InputIterator it = first + begin;
+		InputIterator endIt = first + (std::min)(begin + grainSize, count);
+		OutputIterator outIt = result + begin;
+
+		if (pInit)
+		{
+			//exclusive - element is added after the output is written
+			T value = carries[block].value;
+			for (; it != endIt; ++it, ++outIt)
+			{
+				T element = *it;
+				*outIt = value;
+				value = op(value, element);
+			}
+		}
+		else
+		{
+			//inclusive - the first block has no carry
+			T value = block ? op(carries[block].value, *it) : T(*it);
+			*outIt = value;
+			for (++it, ++outIt; it != endIt; ++it, ++outIt)
+			{
+				value = op(value, *it);
+				*outIt = value;
+			}
+		}
+	}, static_cast<size_t>(1));
+}
+
+
+/**************************************************************************************************//**
+* @brief			Inclusive scan in parallel.
+* @details		Output element i is combination of input elements 0..i. See @ref MsvParallelScanRange.
+* @param[in]	spThreadPool		Thread pool which helps with the scan.
+* @param[in]	first					The first input (random access) iterator.
+* @param[in]	last					Input iterator after the last one.
+* @param[in]	result				The first output (random access) iterator (it can be equal to first).
+* @param[in]	op						Associative binary operation (e.g. std::plus).
+* @param[in]	grainSize			Count of elements in block (0 means automatic - a few blocks per worker, but
+*											at least @ref MSV_SCAN_MIN_BLOCK_SIZE elements).
+* @returns		MsvErrorCode
+* @retval		MSV_NOT_INITIALIZED_ERROR		When thread pool is nullptr.
+* @retval		MSV_ALLOCATION_ERROR				When allocation of block totals failed.
+* @retval		MSV_SUCCESS							On success.
+* @throws		Exception of the operation (the first one).
+* @note			Value type of input must be default constructible.
+******************************************************************************************************/
+template<typename InputIterator, typename OutputIterator, typename Op>
+MsvErrorCode MsvParallelInclusiveScan(std::shared_ptr<IMsvThreadPool> spThreadPool, InputIterator first, InputIterator last, OutputIterator result, const Op& op, size_t grainSize = 0)
+{
+	typedef typename std::iterator_traits<InputIterator>::value_type T;
+
+	return MsvParallelScanRange(spThreadPool, first, last, result, static_cast<const T*>(nullptr), op, grainSize);
+}
+
+/**************************************************************************************************//**
+* @brief			Exclusive scan in parallel.
+* @details		Output element i is combination of init and input elements 0..i-1. See
+*					@ref MsvParallelScanRange.
+* @param[in]	spThreadPool		Thread pool which helps with the scan.
+* @param[in]	first					The first input (random access) iterator.
+* @param[in]	last					Input iterator after the last one.
+* @param[in]	result				The first output (random access) iterator (it can be equal to first).
+* @param[in]	init					Initial value (the first output element).
+* @param[in]	op						Associative binary operation (e.g. std::plus).
+* @param[in]	grainSize			Count of elements in block (0 means automatic - a few blocks per worker, but
+*											at least @ref MSV_SCAN_MIN_BLOCK_SIZE elements).
+* @returns		MsvErrorCode
+* @retval		MSV_NOT_INITIALIZED_ERROR		When thread pool is nullptr.
+* @retval		MSV_ALLOCATION_ERROR				When allocation of block totals failed.
+* @retval		MSV_SUCCESS							On success.
+* @throws		Exception of the operation (the first one).
+* @note			T must be default constructible.
+******************************************************************************************************/
+template<typename InputIterator, typename OutputIterator, typename T, typename Op>
+MsvErrorCode MsvParallelExclusiveScan(std::shared_ptr<IMsvThreadPool> spThreadPool, InputIterator first, InputIterator last, OutputIterator result, T init, const Op& op, size_t grainSize = 0)
+{
+	return MsvParallelScanRange(spThreadPool, first, last, result, &init, op, grainSize);
+}
+
+
+#endif // MARSTECH_PARALLELSCAN_H
+
+/** @} */	//End of group MTHREADING.
@@ -0,0 +1,263 @@
+/**************************************************************************************************//**
+* @addtogroup	MTHREADING
+* @{
+******************************************************************************************************/
+
+/**************************************************************************************************//**
+* @file
+* @brief			MarsTech Parallel Sort
+* @details		Parallel merge sort of random access iterator range executed by thread pool.
+* @author		Martin Svoboda
+* @date			16.10.2026
+* @copyright	GNU General Public License (GPLv3).
+******************************************************************************************************/
+
+
+/*
+This file is part of MarsTech Threading.
+
+MarsTech Dependency Injection is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+MarsTech Promise Like Syntax is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with Foobar. If not, see <https://www.gnu.org/licenses/>.
+*/
+
+
+#ifndef MARSTECH_PARALLELSORT_H
+#define MARSTECH_PARALLELSORT_H
+
+
+#include "MsvParallelFor.h"
+
+#include "merror/MsvError.h"
+
+MSV_DISABLE_ALL_WARNINGS
+
+#include <algorithm>
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <new>
+#include <utility>
+#include <vector>
+
+MSV_ENABLE_WARNINGS
+
+
+/**************************************************************************************************//**
+* @brief		Parallel sort threshold.
+* @details	Ranges shorter than the threshold are sorted sequentially by calling thread.
+******************************************************************************************************/
+#define MSV_PARALLEL_SORT_THRESHOLD 16384
+
+/**************************************************************************************************//**
+* @brief		Minimal sort chunk size.
+* @details	Minimal count of elements sorted sequentially (chunk) or merged by one task (piece).
+******************************************************************************************************/
+#define MSV_PARALLEL_SORT_MIN_CHUNK 2048
+
+
+/**************************************************************************************************//**
+* @brief			Find merge path split.
+* @details		Finds how many elements of the first run precede diagonal of merged output (elements of the
+*					first run go first when they are equal).
+* @param[in]	first1		The first run.
+* @param[in]	count1		Count of elements in the first run.
+* @param[in]	first2		The second run.
+* @param[in]	count2		Count of elements in the second run.
+* @param[in]	diagonal		Count of merged elements (diagonal).
+* @param[in]	comp			Comparator.
+* @returns		Count of elements of the first run (the rest is from the second run).
+******************************************************************************************************/
+template<typename Iterator, typename Compare>
+size_t MsvMergePathSplit(Iterator first1, size_t count1, Iterator first2, size_t count2, size_t diagonal, const Compare& comp)
+{
+	size_t low = diagonal > count2 ? diagonal - count2 : 0;
+	size_t high = (std::min)(diagonal, count1);
+
+	while (low < high)
+	{
+		size_t middle = low + (high - low) / 2;
+		if (comp(first2[diagonal - middle - 1], first1[middle]))
+		{
+			high = middle;
+		}
+		else
+		{
+			low = middle + 1;
+		}
+	}
+
+	return low;
+}
+
+
+/**************************************************************************************************//**
+* @brief			Merge neighbouring sorted runs in parallel.
+* @details		Source is divided to pairs of runs. Output of each pair is divided to pieces which are merged
+*					independently (bounds of the piece are found by @ref MsvMergePathSplit), so even the last
+*					merge (one pair) is executed by all workers.
+* @param[in]	spThreadPool		Thread pool which helps with the merge.
+* @param[in]	source				The first source element.
+* @param[in]	destination			The first destination element.
+* @param[in]	count					Count of elements.
+* @param[in]	width					Width of sorted runs.
+* @param[in]	pieceSize			Count of elements merged by one task.
+* @param[in]	comp					Comparator.
+* @returns		MsvErrorCode
+* @throws		Exception of the comparator (the first one).
+******************************************************************************************************/
+template<typename SourceIterator, typename DestinationIterator, typename Compare>
+MsvErrorCode MsvParallelMergeRuns(std::shared_ptr<IMsvThreadPool> spThreadPool, SourceIterator source, DestinationIterator destination, size_t count, size_t width, size_t pieceSize, const Compare& comp)
+{
+	size_t pairSize = 2 * width;
+	size_t pairCount = (count + pairSize - 1) / pairSize;
+	size_t piecesPerPair = (pairSize + pieceSize - 1) / pieceSize;
+
+	return MsvParallelFor(spThreadPool, static_cast<size_t>(0), pairCount * piecesPerPair, [&](size_t piece)
+	{
+		size_t pairBegin = (piece / piecesPerPair) * pairSize;
+		size_t pairEnd = (std::min)(pairBegin + pairSize, count);
+		size_t begin = pairBegin + (piece % piecesPerPair) * pieceSize;
+		size_t end = (std::min)(begin + pieceSize, pairEnd);
+		if (begin >= end)
+		{
+			return;
+		}
+
+		SourceIterator first1 = source + pairBegin;
+		size_t count1 = (std::min)(width, pairEnd - pairBegin);
+		SourceIterator first2 = first1 + count1;
+		size_t count2 = pairEnd - pairBegin - count1;
+
+		size_t i = MsvMergePathSplit(first1, count1, first2, count2, begin - pairBegin, comp);
+		size_t j = begin - pairBegin - i;
+		DestinationIterator output = destination + begin;
+		DestinationIterator outputEnd = destination + end;
+
+		for (; output != outputEnd; ++output)
+		{
+			//the first run wins when elements are equal
+			if (j < count2 && (i >= count1 || comp(first2[j], first1[i])))
+			{
+				*output = std::move(first2[j++]);
+			}
+			else
+			{
+				*output = std::move(first1[i++]);
+			}
+		}
+	}, static_cast<size_t>(1));
+}
+
+
+/**************************************************************************************************//**
+* @brief			Sort range in parallel.
+* @details		Parallel merge sort:
+*					1. Range is divided to chunks (a few per worker) which are sorted sequentially by std::sort (cache
+*						friendly base case).
+*					2. Sorted runs are merged in rounds (width is doubled) between the range and a buffer. Each round
+*						is divided to pieces of equal size (see @ref MsvParallelMergeRuns), so all workers take part
+*						in every round.
+*
+*					Ranges shorter than @ref MSV_PARALLEL_SORT_THRESHOLD are sorted by calling thread only.
+* @param[in]	spThreadPool		Thread pool which helps with the sort.
+* @param[in]	first					The first (random access) iterator.
+* @param[in]	last					Iterator after the last one.
+* @param[in]	comp					Comparator (strict weak ordering). It is called concurrently.
+* @returns		MsvErrorCode
+* @retval		MSV_NOT_INITIALIZED_ERROR		When thread pool is nullptr.
+* @retval		MSV_ALLOCATION_ERROR				When allocation of merge buffer failed.
+* @retval		MSV_SUCCESS							On success.
+* @throws		Exception of the comparator (the first one).
+* @note			Sort is not stable. Value type must be default constructible and move assignable (merge
+*					buffer).
+******************************************************************************************************/
+template<typename RandomIterator, typename Compare>
+MsvErrorCode MsvParallelSort(std::shared_ptr<IMsvThreadPool> spThreadPool, RandomIterator first, RandomIterator last, const Compare& comp)
+{
+	typedef typename std::iterator_traits<RandomIterator>::value_type T;
+
+	if (!spThreadPool)
+	{
+		return MSV_NOT_INITIALIZED_ERROR;
+	}
+
+	size_t count = first < last ? static_cast<size_t>(last - first) : 0;
+	if (count < MSV_PARALLEL_SORT_THRESHOLD)
+	{
+		std::sort(first, last, comp);
+		return MSV_SUCCESS;
+	}
+
+	std::vector<T> buffer;
+	try
+	{
+		buffer.resize(count);
+	}
+	catch (const std::bad_alloc&)
+	{
+		return MSV_ALLOCATION_ERROR;
+	}
+
+	size_t taskCount = (spThreadPool->GetWorkerCount() + 1) * 4;
+	size_t chunkSize = (std::max)((count + taskCount - 1) / taskCount, static_cast<size_t>(MSV_PARALLEL_SORT_MIN_CHUNK));
+	size_t chunkCount = (count + chunkSize - 1) / chunkSize;
+
+	MsvErrorCode errorCode = MsvParallelFor(spThreadPool, static_cast<size_t>(0), chunkCount, [&](size_t chunk)
+	{
+		std::sort(first + chunk * chunkSize, first + (std::min)((chunk + 1) * chunkSize, count), comp);
+	}, static_cast<size_t>(1));
+
+	//runs are merged between range and buffer (ping-pong)
+	bool inBuffer = false;
+	for (size_t width = chunkSize; MSV_SUCCEEDED(errorCode) && width < count; width *= 2)
+	{
+		errorCode = inBuffer ?
+			MsvParallelMergeRuns(spThreadPool, buffer.begin(), first, count, width, chunkSize, comp) :
+			MsvParallelMergeRuns(spThreadPool, first, buffer.begin(), count, width, chunkSize, comp);
+		inBuffer = !inBuffer;
+	}
+
+	if (MSV_SUCCEEDED(errorCode) && inBuffer)
+	{
+		errorCode = MsvParallelFor(spThreadPool, static_cast<size_t>(0), chunkCount, [&](size_t chunk)
+		{
+			size_t begin = chunk * chunkSize;
+			size_t end = (std::min)(begin + chunkSize, count);
+			std::move(buffer.begin() + begin, buffer.begin() + end, first + begin);
+		}, static_cast<size_t>(1));
+	}
+
+	return errorCode;
+}
+
+/**************************************************************************************************//**
+* @brief			Sort range in parallel (ascending by operator <).
+* @details		See @ref MsvParallelSort(std::shared_ptr<IMsvThreadPool>, RandomIterator, RandomIterator, const Compare&).
+* @param[in]	spThreadPool		Thread pool which helps with the sort.
+* @param[in]	first					The first (random access) iterator.
+* @param[in]	last					Iterator after the last one.
+* @returns		MsvErrorCode
+* @retval		MSV_NOT_INITIALIZED_ERROR		When thread pool is nullptr.
+* @retval		MSV_ALLOCATION_ERROR				When allocation of merge buffer failed.
+* @retval		MSV_SUCCESS							On success.
+******************************************************************************************************/
+template<typename RandomIterator>
+MsvErrorCode MsvParallelSort(std::shared_ptr<IMsvThreadPool> spThreadPool, RandomIterator first, RandomIterator last)
+{
+	return MsvParallelSort(spThreadPool, first, last, std::less<typename std::iterator_traits<RandomIterator>::value_type>());
+}
+
+
+#endif // MARSTECH_PARALLELSORT_H
+
+/** @} */	//End of group MTHREADING.
@@ -0,0 +1,74 @@
+/**************************************************************************************************//**
+* @addtogroup	MTHREADING
+* @{
+******************************************************************************************************/
+
+/**************************************************************************************************//**
+* @file
+* @brief			MarsTech Periodic Task Policy
+* @details		Contains definition of periodic task modes and missed tick policies.
+* @author		Martin Svoboda
+* @date			16.10.2026
+* @copyright	GNU General Public License (GPLv3).
+******************************************************************************************************/
+
+
+/*
+This file is part of MarsTech Threading.
+
+MarsTech Dependency Injection is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+MarsTech Promise Like Syntax is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with Foobar. If not, see <https://www.gnu.org/licenses/>.
+*/
+
+
+#ifndef MARSTECH_PERIODICPOLICY_H
+#define MARSTECH_PERIODICPOLICY_H
+
+
+#include "mheaders/MsvCompiler.h"
+
+MSV_DISABLE_ALL_WARNINGS
+
+#include <cstdint>
+
+MSV_ENABLE_WARNINGS
+
+
+/**************************************************************************************************//**
+* @brief		MarsTech Periodic Mode.
+* @details	Says how the next execution time of periodic task is computed (always on steady clock).
+******************************************************************************************************/
+enum class MsvPeriodicMode: uint8_t
+{
+	MSV_PERIODIC_FIXED_RATE = 0,					///< Executions are scheduled from the first one (start + n * period), they do not drift.
+	MSV_PERIODIC_FIXED_DELAY = 1					///< The next execution is scheduled period after the end of previous one.
+};
+
+
+/**************************************************************************************************//**
+* @brief		MarsTech Missed Tick Policy.
+* @details	Says what happens with ticks of fixed rate periodic task which have been missed (the task has been
+*				executed later than the next tick was scheduled).
+* @note		It is not used in fixed delay mode (there are no missed ticks).
+******************************************************************************************************/
+enum class MsvMissedTickPolicy: uint8_t
+{
+	MSV_MISSED_TICK_SKIP = 0,						///< Missed ticks are skipped (the next tick is the next future tick of the original schedule).
+	MSV_MISSED_TICK_CATCH_UP = 1,					///< Task is executed for each missed tick (back to back) until it catches up.
+	MSV_MISSED_TICK_COALESCE = 2					///< Missed ticks are coalesced to one execution and the schedule restarts from it.
+};
+
+
+#endif // MARSTECH_PERIODICPOLICY_H
+
+/** @} */	//End of group MTHREADING.
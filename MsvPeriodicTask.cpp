@@ -0,0 +1,169 @@
+/**************************************************************************************************//**
+* @addtogroup	MTHREADING
+* @{
+******************************************************************************************************/
+
+/**************************************************************************************************//**
+* @file
+* @brief			MarsTech Periodic Task
+* @details		Contains implementation of @ref MsvPeriodicTask.
+* @author		Martin Svoboda
+* @date			16.10.2026
+* @copyright	GNU General Public License (GPLv3).
+******************************************************************************************************/
+
+
+/*
+This file is part of MarsTech Threading.
+
+MarsTech Dependency Injection is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+MarsTech Promise Like Syntax is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with Foobar. If not, see <https://www.gnu.org/licenses/>.
+*/
+
+
+#include "MsvPeriodicTask.h"
+
+#include "merror/MsvErrorCodes.h"
+
+
+/********************************************************************************************************************************
+*															Constructors and destructors
+********************************************************************************************************************************/
+
+
+MsvPeriodicTask::MsvPeriodicTask(std::shared_ptr<IMsvTask> spTask, std::chrono::microseconds period, MsvPeriodicMode mode, MsvMissedTickPolicy missedTickPolicy, std::shared_ptr<IMsvTimerWheel> spTimerWheel):
+	m_spTask(spTask),
+	m_period(period),
+	m_mode(mode),
+	m_missedTickPolicy(missedTickPolicy),
+	m_wpTimerWheel(spTimerWheel),
+	m_timerId(0),
+	m_cancelled(false)
+{
+
+}
+
+MsvPeriodicTask::~MsvPeriodicTask()
+{
+
+}
+
+
+/********************************************************************************************************************************
+*															MsvPeriodicTask public methods
+********************************************************************************************************************************/
+
+
+MsvErrorCode MsvPeriodicTask::Start(std::chrono::steady_clock::time_point firstTime)
+{
+	m_nextTime = firstTime;
+
+	return Schedule() ? MSV_SUCCESS : MSV_ALLOCATION_ERROR;
+}
+
+bool MsvPeriodicTask::Cancel()
+{
+	if (m_cancelled.exchange(true))
+	{
+		return false;
+	}
+
+	//timer might be expired already (execution checks the flag)
+	std::shared_ptr<IMsvTimerWheel> spTimerWheel = m_wpTimerWheel.lock();
+	if (spTimerWheel)
+	{
+		spTimerWheel->CancelTimer(m_timerId.load());
+	}
+
+	return true;
+}
+
+
+/********************************************************************************************************************************
+*															IMsvTask protected methods
+********************************************************************************************************************************/
+
+
+void MsvPeriodicTask::Execute()
+{
+	if (m_cancelled.load())
+	{
+		return;
+	}
+
+	if (m_mode == MsvPeriodicMode::MSV_PERIODIC_FIXED_RATE)
+	{
+		//the next tick of the original schedule (it does not drift)
+		std::chrono::steady_clock::time_point now = std::chrono::steady_clock::now();
+		m_nextTime += m_period;
+
+		if (m_nextTime <= now)
+		{
+			//this execution is late -> some ticks have been missed
+			if (m_missedTickPolicy == MsvMissedTickPolicy::MSV_MISSED_TICK_SKIP)
+			{
+				m_nextTime += m_period * ((now - m_nextTime) / m_period + 1);
+			}
+			else if (m_missedTickPolicy == MsvMissedTickPolicy::MSV_MISSED_TICK_COALESCE)
+			{
+				m_nextTime = now + m_period;
+			}
+		}
+	}
+
+	m_spTask->Execute();
+
+	if (m_mode == MsvPeriodicMode::MSV_PERIODIC_FIXED_DELAY)
+	{
+		m_nextTime = std::chrono::steady_clock::now() + m_period;
+	}
+
+	//periodic task ends when it can't be scheduled (timer wheel has been released or allocation failed)
+	if (!m_cancelled.load())
+	{
+		Schedule();
+	}
+}
+
+
+/********************************************************************************************************************************
+*															MsvPeriodicTask protected methods
+********************************************************************************************************************************/
+
+
+bool MsvPeriodicTask::Schedule()
+{
+	std::shared_ptr<IMsvTimerWheel> spTimerWheel = m_wpTimerWheel.lock();
+	if (!spTimerWheel)
+	{
+		return false;
+	}
+
+	uint64_t timerId = 0;
+	if (!spTimerWheel->AddTimer(shared_from_this(), m_nextTime, timerId))
+	{
+		return false;
+	}
+
+	m_timerId.store(timerId);
+
+	//cancel could read previous timer identifier -> cancel the new timer here
+	if (m_cancelled.load())
+	{
+		spTimerWheel->CancelTimer(timerId);
+	}
+
+	return true;
+}
+
+/** @} */	//End of group MTHREADING.
@@ -0,0 +1,162 @@
+/**************************************************************************************************//**
+* @addtogroup	MTHREADING
+* @{
+******************************************************************************************************/
+
+/**************************************************************************************************//**
+* @file
+* @brief			MarsTech Periodic Task
+* @details		Contains declaration of @ref MsvPeriodicTask.
+* @author		Martin Svoboda
+* @date			16.10.2026
+* @copyright	GNU General Public License (GPLv3).
+******************************************************************************************************/
+
+
+/*
+This file is part of MarsTech Threading.
+
+MarsTech Dependency Injection is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+MarsTech Promise Like Syntax is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with Foobar. If not, see <https://www.gnu.org/licenses/>.
+*/
+
+
+#ifndef MARSTECH_PERIODICTASK_H
+#define MARSTECH_PERIODICTASK_H
+
+
+#include "IMsvTimerWheel.h"
+#include "MsvPeriodicPolicy.h"
+
+#include "merror/MsvError.h"
+
+MSV_DISABLE_ALL_WARNINGS
+
+#include <atomic>
+#include <memory>
+#include <chrono>
+
+MSV_ENABLE_WARNINGS
+
+
+/**************************************************************************************************//**
+* @brief		MarsTech Periodic Task.
+* @details	Wrapper of periodic job/task. It is inserted to timer wheel, and when its timer expires it is
+*				executed by thread pool worker (like any other task). It executes wrapped task, computes the next
+*				execution time (by periodic mode and missed tick policy) and inserts itself to timer wheel again.
+*				Executions of one periodic task never overlap (it is rescheduled after execution).
+* @note		Missed ticks which are caught up (see @ref MsvMissedTickPolicy::MSV_MISSED_TICK_CATCH_UP) are
+*				executed one per timer wheel tick.
+* @see		MsvThreadPool::AddPeriodicTask
+******************************************************************************************************/
+class MsvPeriodicTask:
+	public IMsvTask,
+	public std::enable_shared_from_this<MsvPeriodicTask>
+{
+public:
+	/**************************************************************************************************//**
+	* @brief			Constructor.
+	* @param[in]	spTask					Wrapped task.
+	* @param[in]	period					Period of the task (it must be positive).
+	* @param[in]	mode						Periodic mode.
+	* @param[in]	missedTickPolicy		Missed tick policy (only for fixed rate mode).
+	* @param[in]	spTimerWheel			Timer wheel which executes the task (it is referenced weakly).
+	******************************************************************************************************/
+	MsvPeriodicTask(std::shared_ptr<IMsvTask> spTask, std::chrono::microseconds period, MsvPeriodicMode mode, MsvMissedTickPolicy missedTickPolicy, std::shared_ptr<IMsvTimerWheel> spTimerWheel);
+
+	/**************************************************************************************************//**
+	* @brief		Virtual destructor.
+	******************************************************************************************************/
+	virtual ~MsvPeriodicTask();
+
+	/**************************************************************************************************//**
+	* @brief			Start periodic task.
+	* @details		Inserts the task to timer wheel (the first execution is at firstTime).
+	* @param[in]	firstTime		Time of the first execution.
+	* @returns		MsvErrorCode
+	* @retval		MSV_ALLOCATION_ERROR		When timer wheel does not exist or its allocation failed.
+	* @retval		MSV_SUCCESS					On success.
+	******************************************************************************************************/
+	MsvErrorCode Start(std::chrono::steady_clock::time_point firstTime);
+
+	/**************************************************************************************************//**
+	* @brief			Cancel periodic task.
+	* @details		The task will not be executed anymore (execution which is running is finished).
+	* @returns		bool
+	* @retval		true		When task has been cancelled.
+	* @retval		false		When task has been already cancelled.
+	******************************************************************************************************/
+	bool Cancel();
+
+protected:
+	/**************************************************************************************************//**
+	* @copydoc IMsvTask::Execute()
+	******************************************************************************************************/
+	virtual void Execute() override;
+
+	/**************************************************************************************************//**
+	* @brief			Insert task to timer wheel (with the next execution time).
+	* @returns		bool
+	* @retval		true		On success.
+	* @retval		false		When timer wheel does not exist or its allocation failed.
+	******************************************************************************************************/
+	bool Schedule();
+
+protected:
+	/**************************************************************************************************//**
+	* @brief		Wrapped task.
+	******************************************************************************************************/
+	std::shared_ptr<IMsvTask> m_spTask;
+
+	/**************************************************************************************************//**
+	* @brief		Period of the task.
+	******************************************************************************************************/
+	std::chrono::microseconds m_period;
+
+	/**************************************************************************************************//**
+	* @brief		Periodic mode.
+	******************************************************************************************************/
+	MsvPeriodicMode m_mode;
+
+	/**************************************************************************************************//**
+	* @brief		Missed tick policy.
+	******************************************************************************************************/
+	MsvMissedTickPolicy m_missedTickPolicy;
+
+	/**************************************************************************************************//**
+	* @brief		Timer wheel.
+	* @details	It is weak reference, because timer wheel owns the task when it is scheduled.
+	******************************************************************************************************/
+	std::weak_ptr<IMsvTimerWheel> m_wpTimerWheel;
+
+	/**************************************************************************************************//**
+	* @brief		The next execution time.
+	* @details	It is changed only by execution (executions do not overlap).
+	******************************************************************************************************/
+	std::chrono::steady_clock::time_point m_nextTime;
+
+	/**************************************************************************************************//**
+	* @brief		Identifier of current timer.
+	******************************************************************************************************/
+	std::atomic<uint64_t> m_timerId;
+
+	/**************************************************************************************************//**
+	* @brief		Flag if task has been cancelled (true) or not (false).
+	******************************************************************************************************/
+	std::atomic<bool> m_cancelled;
+};
+
+
+#endif // MARSTECH_PERIODICTASK_H
+
+/** @} */	//End of group MTHREADING.
@@ -0,0 +1,263 @@
+/**************************************************************************************************//**
+* @addtogroup	MTHREADING
+* @{
+******************************************************************************************************/
+
+/**************************************************************************************************//**
+* @file
+* @brief			MarsTech Priority Task Queue
+* @details		Contains implementation of @ref MsvPriorityTaskQueue.
+* @author		Martin Svoboda
+* @date			16.10.2026
+* @copyright	GNU General Public License (GPLv3).
+******************************************************************************************************/
+
+
+/*
+This file is part of MarsTech Threading.
+
+MarsTech Dependency Injection is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+MarsTech Promise Like Syntax is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with Foobar. If not, see <https://www.gnu.org/licenses/>.
+*/
+
+
+#include "MsvPriorityTaskQueue.h"
+
+#include "merror/MsvErrorCodes.h"
+
+
+/********************************************************************************************************************************
+*															Static members
+********************************************************************************************************************************/
+
+
+const uint32_t MsvPriorityTaskQueue::MSV_MAX_PRIORITY_SCHEDULE_SIZE;
+const uint32_t MsvPriorityTaskQueue::MSV_DEFAULT_PRIORITY_AGING;
+
+
+/********************************************************************************************************************************
+*															Constructors and destructors
+********************************************************************************************************************************/
+
+
+MsvPriorityTaskQueue::MsvPriorityTaskQueue(size_t capacity):
+	m_capacity(capacity),
+	m_policy(MsvPriorityPolicy::MSV_PRIORITY_STRICT),
+	m_scheduleSize(0),
+	m_agingThreshold(MSV_DEFAULT_PRIORITY_AGING)
+{
+	m_popSequence.value.store(0, std::memory_order_relaxed);
+
+	for (size_t band = 0; band < MSV_TASK_PRIORITY_COUNT; ++band)
+	{
+		m_bands[band].reset(new (std::nothrow) MsvTaskQueue(capacity));
+		m_lastServed[band].store(0, std::memory_order_relaxed);
+	}
+
+	SetPriorityWeights(4, 2, 1);
+}
+
+MsvPriorityTaskQueue::~MsvPriorityTaskQueue()
+{
+
+}
+
+
+/********************************************************************************************************************************
+*															IMsvTaskQueue public methods
+********************************************************************************************************************************/
+
+
+bool MsvPriorityTaskQueue::Push(std::shared_ptr<IMsvTask> spTask)
+{
+	return Push(spTask, MsvTaskPriority::MSV_TASK_PRIORITY_NORMAL);
+}
+
+std::shared_ptr<IMsvTask> MsvPriorityTaskQueue::Pop()
+{
+	std::shared_ptr<IMsvTask> spTask;
+	PopBatch(&spTask, 1);
+
+	return spTask;
+}
+
+size_t MsvPriorityTaskQueue::PopBatch(std::shared_ptr<IMsvTask>* pTasks, size_t maxCount)
+{
+	if (!maxCount)
+	{
+		return 0;
+	}
+
+	size_t sequence = m_popSequence.value.fetch_add(1, std::memory_order_relaxed);
+
+	//aging -> band which has not been served for long time goes first (the lowest priority first)
+	uint32_t agingThreshold = m_agingThreshold.load(std::memory_order_relaxed);
+	if (agingThreshold)
+	{
+		for (size_t band = MSV_TASK_PRIORITY_COUNT - 1; band > 0; --band)
+		{
+			if (sequence - m_lastServed[band].load(std::memory_order_relaxed) >= agingThreshold)
+			{
+				//aged band gets one task only (higher priority tasks are not delayed more than necessary)
+				size_t count = PopBatchFromBand(band, sequence, pTasks, 1);
+				if (count)
+				{
+					return count;
+				}
+			}
+		}
+	}
+
+	//the first band by policy, then the others by priority (fixed count of bands -> O(1))
+	size_t firstBand = m_policy == MsvPriorityPolicy::MSV_PRIORITY_WEIGHTED ? m_schedule[sequence % m_scheduleSize] : 0;
+	size_t count = PopBatchFromBand(firstBand, sequence, pTasks, maxCount);
+
+	for (size_t band = 0; !count && band < MSV_TASK_PRIORITY_COUNT; ++band)
+	{
+		if (band != firstBand)
+		{
+			count = PopBatchFromBand(band, sequence, pTasks, maxCount);
+		}
+	}
+
+	return count;
+}
+
+size_t MsvPriorityTaskQueue::GetSize() const
+{
+	size_t size = 0;
+	for (size_t band = 0; band < MSV_TASK_PRIORITY_COUNT; ++band)
+	{
+		if (m_bands[band])
+		{
+			size += m_bands[band]->GetSize();
+		}
+	}
+
+	return size;
+}
+
+size_t MsvPriorityTaskQueue::GetCapacity() const
+{
+	return m_capacity;
+}
+
+
+/********************************************************************************************************************************
+*															IMsvPriorityTaskQueue public methods
+********************************************************************************************************************************/
+
+
+bool MsvPriorityTaskQueue::Push(std::shared_ptr<IMsvTask> spTask, MsvTaskPriority priority)
+{
+	size_t band = static_cast<size_t>(priority);
+	if (band >= MSV_TASK_PRIORITY_COUNT || !m_bands[band])
+	{
+		return false;
+	}
+
+	return m_bands[band]->Push(spTask);
+}
+
+std::shared_ptr<IMsvTask> MsvPriorityTaskQueue::Pop(MsvTaskPriority priority)
+{
+	size_t band = static_cast<size_t>(priority);
+	if (band >= MSV_TASK_PRIORITY_COUNT || !m_bands[band])
+	{
+		return nullptr;
+	}
+
+	return m_bands[band]->Pop();
+}
+
+MsvErrorCode MsvPriorityTaskQueue::SetPriorityPolicy(MsvPriorityPolicy policy)
+{
+	m_policy = policy;
+
+	return MSV_SUCCESS;
+}
+
+MsvErrorCode MsvPriorityTaskQueue::SetPriorityWeights(uint32_t highWeight, uint32_t normalWeight, uint32_t lowWeight)
+{
+	uint32_t weights[MSV_TASK_PRIORITY_COUNT] = { highWeight, normalWeight, lowWeight };
+	uint32_t scheduleSize = 0;
+
+	for (size_t band = 0; band < MSV_TASK_PRIORITY_COUNT; ++band)
+	{
+		if (!weights[band] || weights[band] > MSV_MAX_PRIORITY_SCHEDULE_SIZE)
+		{
+			return MSV_INVALID_DATA_ERROR;
+		}
+		scheduleSize += weights[band];
+	}
+
+	if (scheduleSize > MSV_MAX_PRIORITY_SCHEDULE_SIZE)
+	{
+		return MSV_INVALID_DATA_ERROR;
+	}
+
+	//smooth weighted round robin -> bands are interleaved (e.g. 4, 2, 1 -> H N H L H N H)
+	int64_t current[MSV_TASK_PRIORITY_COUNT] = { 0 };
+	for (uint32_t i = 0; i < scheduleSize; ++i)
+	{
+		size_t selected = 0;
+		for (size_t band = 0; band < MSV_TASK_PRIORITY_COUNT; ++band)
+		{
+			current[band] += weights[band];
+			if (current[band] > current[selected])
+			{
+				selected = band;
+			}
+		}
+
+		current[selected] -= scheduleSize;
+		m_schedule[i] = static_cast<uint8_t>(selected);
+	}
+
+	m_scheduleSize = scheduleSize;
+
+	return MSV_SUCCESS;
+}
+
+MsvErrorCode MsvPriorityTaskQueue::SetPriorityAging(uint32_t agingThreshold)
+{
+	m_agingThreshold.store(agingThreshold, std::memory_order_relaxed);
+
+	return MSV_SUCCESS;
+}
+
+
+/********************************************************************************************************************************
+*															MsvPriorityTaskQueue protected methods
+********************************************************************************************************************************/
+
+
+size_t MsvPriorityTaskQueue::PopBatchFromBand(size_t band, size_t sequence, std::shared_ptr<IMsvTask>* pTasks, size_t maxCount)
+{
+	if (!m_bands[band])
+	{
+		return 0;
+	}
+
+	size_t count = m_bands[band]->PopBatch(pTasks, maxCount);
+
+	//empty band is not waiting -> it is considered as served too (the highest band never ages)
+	if (band)
+	{
+		m_lastServed[band].store(sequence, std::memory_order_relaxed);
+	}
+
+	return count;
+}
+
+/** @} */	//End of group MTHREADING.
@@ -0,0 +1,201 @@
+/**************************************************************************************************//**
+* @addtogroup	MTHREADING
+* @{
+******************************************************************************************************/
+
+/**************************************************************************************************//**
+* @file
+* @brief			MarsTech Priority Task Queue
+* @details		Contains implementation of task queue with priority bands @ref MsvPriorityTaskQueue.
+* @author		Martin Svoboda
+* @date			16.10.2026
+* @copyright	GNU General Public License (GPLv3).
+******************************************************************************************************/
+
+
+/*
+This file is part of MarsTech Threading.
+
+MarsTech Dependency Injection is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+MarsTech Promise Like Syntax is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with Foobar. If not, see <https://www.gnu.org/licenses/>.
+*/
+
+
+#ifndef MARSTECH_PRIORITYTASKQUEUE_H
+#define MARSTECH_PRIORITYTASKQUEUE_H
+
+
+#include "IMsvPriorityTaskQueue.h"
+#include "MsvTaskQueue.h"
+
+MSV_DISABLE_ALL_WARNINGS
+
+#include <atomic>
+#include <memory>
+
+MSV_ENABLE_WARNINGS
+
+
+/**************************************************************************************************//**
+* @brief		MarsTech Priority Task Queue Implementation.
+* @details	Each priority band is lock-free @ref MsvTaskQueue. Pop checks fixed count of bands, so it is
+*				O(1). Bands are served strictly by priority or in weighted round robin (precomputed schedule
+*				indexed by pop sequence number). Aging serves lower priority band which has not been served
+*				for configured count of pops.
+* @see		IMsvPriorityTaskQueue
+* @see		MsvTaskQueue
+******************************************************************************************************/
+class MsvPriorityTaskQueue:
+	public IMsvPriorityTaskQueue
+{
+public:
+	/**************************************************************************************************//**
+	* @brief			Constructor.
+	* @param[in]	capacity		Maximal count of tasks in each priority band (zero means unbounded bands).
+	******************************************************************************************************/
+	MsvPriorityTaskQueue(size_t capacity = 0);
+
+	/**************************************************************************************************//**
+	* @brief		Virtual destructor.
+	* @warning	Queue must not be used by any other thread during destruction.
+	******************************************************************************************************/
+	virtual ~MsvPriorityTaskQueue();
+
+	/**************************************************************************************************//**
+	* @copydoc IMsvTaskQueue::Push(std::shared_ptr<IMsvTask> spTask)
+	******************************************************************************************************/
+	virtual bool Push(std::shared_ptr<IMsvTask> spTask) override;
+
+	/**************************************************************************************************//**
+	* @copydoc IMsvTaskQueue::Pop()
+	******************************************************************************************************/
+	virtual std::shared_ptr<IMsvTask> Pop() override;
+
+	/**************************************************************************************************//**
+	* @copydoc IMsvTaskQueue::PopBatch(std::shared_ptr<IMsvTask>* pTasks, size_t maxCount)
+	******************************************************************************************************/
+	virtual size_t PopBatch(std::shared_ptr<IMsvTask>* pTasks, size_t maxCount) override;
+
+	/**************************************************************************************************//**
+	* @copydoc IMsvTaskQueue::GetSize()
+	******************************************************************************************************/
+	virtual size_t GetSize() const override;
+
+	/**************************************************************************************************//**
+	* @brief			Get queue capacity.
+	* @details		Returns maximal count of tasks in each priority band (the whole queue can hold
+	*					@ref MSV_TASK_PRIORITY_COUNT times more tasks).
+	* @returns		size_t
+	* @retval		0		When queue is unbounded.
+	******************************************************************************************************/
+	virtual size_t GetCapacity() const override;
+
+	/**************************************************************************************************//**
+	* @copydoc IMsvPriorityTaskQueue::Push(std::shared_ptr<IMsvTask> spTask, MsvTaskPriority priority)
+	******************************************************************************************************/
+	virtual bool Push(std::shared_ptr<IMsvTask> spTask, MsvTaskPriority priority) override;
+
+	/**************************************************************************************************//**
+	* @copydoc IMsvPriorityTaskQueue::Pop(MsvTaskPriority priority)
+	******************************************************************************************************/
+	virtual std::shared_ptr<IMsvTask> Pop(MsvTaskPriority priority) override;
+
+	/**************************************************************************************************//**
+	* @copydoc IMsvPriorityTaskQueue::SetPriorityPolicy(MsvPriorityPolicy policy)
+	******************************************************************************************************/
+	virtual MsvErrorCode SetPriorityPolicy(MsvPriorityPolicy policy) override;
+
+	/**************************************************************************************************//**
+	* @copydoc IMsvPriorityTaskQueue::SetPriorityWeights(uint32_t highWeight, uint32_t normalWeight, uint32_t lowWeight)
+	******************************************************************************************************/
+	virtual MsvErrorCode SetPriorityWeights(uint32_t highWeight, uint32_t normalWeight, uint32_t lowWeight) override;
+
+	/**************************************************************************************************//**
+	* @copydoc IMsvPriorityTaskQueue::SetPriorityAging(uint32_t agingThreshold)
+	******************************************************************************************************/
+	virtual MsvErrorCode SetPriorityAging(uint32_t agingThreshold) override;
+
+public:
+	/**************************************************************************************************//**
+	* @brief		Maximal sum of priority weights (length of weighted round robin schedule).
+	******************************************************************************************************/
+	static const uint32_t MSV_MAX_PRIORITY_SCHEDULE_SIZE = 64;
+
+	/**************************************************************************************************//**
+	* @brief		Default aging threshold (count of pops).
+	******************************************************************************************************/
+	static const uint32_t MSV_DEFAULT_PRIORITY_AGING = 64;
+
+protected:
+	/**************************************************************************************************//**
+	* @brief			Pop tasks from band.
+	* @details		Pops tasks from the band and remembers when the band has been served (aging).
+	* @param[in]	band			Band index.
+	* @param[in]	sequence		Pop sequence number.
+	* @param[out]	pTasks		Array for popped tasks (it must have at least maxCount items).
+	* @param[in]	maxCount		Maximal count of popped tasks.
+	* @returns		size_t
+	* @retval		0		When band is empty.
+	******************************************************************************************************/
+	size_t PopBatchFromBand(size_t band, size_t sequence, std::shared_ptr<IMsvTask>* pTasks, size_t maxCount);
+
+protected:
+	/**************************************************************************************************//**
+	* @brief		Priority bands (index is @ref MsvTaskPriority).
+	******************************************************************************************************/
+	std::unique_ptr<MsvTaskQueue> m_bands[MSV_TASK_PRIORITY_COUNT];
+
+	/**************************************************************************************************//**
+	* @brief		Capacity of each band.
+	******************************************************************************************************/
+	size_t m_capacity;
+
+	/**************************************************************************************************//**
+	* @brief		Priority policy.
+	* @see		SetPriorityPolicy
+	******************************************************************************************************/
+	MsvPriorityPolicy m_policy;
+
+	/**************************************************************************************************//**
+	* @brief		Weighted round robin schedule (band indexes).
+	* @see		SetPriorityWeights
+	******************************************************************************************************/
+	uint8_t m_schedule[MSV_MAX_PRIORITY_SCHEDULE_SIZE];
+
+	/**************************************************************************************************//**
+	* @brief		Weighted round robin schedule size (sum of weights).
+	******************************************************************************************************/
+	uint32_t m_scheduleSize;
+
+	/**************************************************************************************************//**
+	* @brief		Aging threshold (count of pops, zero means no aging).
+	* @see		SetPriorityAging
+	******************************************************************************************************/
+	std::atomic<uint32_t> m_agingThreshold;
+
+	/**************************************************************************************************//**
+	* @brief		Pop sequence number.
+	* @details	It is incremented by each pop (it selects band of weighted round robin and measures age).
+	******************************************************************************************************/
+	MsvCacheLinePadded<std::atomic<size_t>> m_popSequence;
+
+	/**************************************************************************************************//**
+	* @brief		Pop sequence number of the last pop from band (or the last check of empty band).
+	******************************************************************************************************/
+	std::atomic<size_t> m_lastServed[MSV_TASK_PRIORITY_COUNT];
+};
+
+
+#endif // MARSTECH_PRIORITYTASKQUEUE_H
+
+/** @} */	//End of group MTHREADING.
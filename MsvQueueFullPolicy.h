@@ -0,0 +1,62 @@
+/**************************************************************************************************//**
+* @addtogroup	MTHREADING
+* @{
+******************************************************************************************************/
+
+/**************************************************************************************************//**
+* @file
+* @brief			MarsTech Queue Full Policy
+* @details		Contains policies @ref MsvQueueFullPolicy which say what to do when bounded task queue is full.
+* @author		Martin Svoboda
+* @date			16.10.2026
+* @copyright	GNU General Public License (GPLv3).
+******************************************************************************************************/
+
+
+/*
+This file is part of MarsTech Threading.
+
+MarsTech Dependency Injection is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+MarsTech Promise Like Syntax is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with Foobar. If not, see <https://www.gnu.org/licenses/>.
+*/
+
+
+#ifndef MARSTECH_QUEUEFULLPOLICY_H
+#define MARSTECH_QUEUEFULLPOLICY_H
+
+
+#include "MsvThreadingErrorCodes.h"
+
+MSV_DISABLE_ALL_WARNINGS
+
+#include <cstdint>
+
+MSV_ENABLE_WARNINGS
+
+
+/**************************************************************************************************//**
+* @brief		MarsTech Queue Full Policy.
+* @details	Backpressure policy which is applied when producer adds task to full bounded task queue.
+******************************************************************************************************/
+enum class MsvQueueFullPolicy: uint8_t
+{
+	MSV_QUEUE_FULL_BLOCK = 0,						///< Producer waits until there is free space (or until timeout).
+	MSV_QUEUE_FULL_REJECT = 1,						///< Task is not added and @ref MSV_QUEUE_FULL_ERROR is returned.
+	MSV_QUEUE_FULL_CALLER_RUNS = 2,				///< Task is executed by producer thread.
+	MSV_QUEUE_FULL_DROP_OLDEST = 3				///< The oldest queued task is dropped (it is never executed), the least urgent one in deadline queue.
+};
+
+
+#endif // MARSTECH_QUEUEFULLPOLICY_H
+
+/** @} */	//End of group MTHREADING.
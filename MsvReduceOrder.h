@@ -0,0 +1,62 @@
+/**************************************************************************************************//**
+* @addtogroup	MTHREADING
+* @{
+******************************************************************************************************/
+
+/**************************************************************************************************//**
+* @file
+* @brief			MarsTech Reduce Order
+* @details		Defines order in which partial results of parallel reduction are combined.
+* @author		Martin Svoboda
+* @date			16.10.2026
+* @copyright	GNU General Public License (GPLv3).
+******************************************************************************************************/
+
+
+/*
+This file is part of MarsTech Threading.
+
+MarsTech Dependency Injection is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+MarsTech Promise Like Syntax is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with Foobar. If not, see <https://www.gnu.org/licenses/>.
+*/
+
+
+#ifndef MARSTECH_REDUCEORDER_H
+#define MARSTECH_REDUCEORDER_H
+
+
+#include "mheaders/MsvCompiler.h"
+
+MSV_DISABLE_ALL_WARNINGS
+
+#include <cstdint>
+
+MSV_ENABLE_WARNINGS
+
+
+/**************************************************************************************************//**
+* @brief		MarsTech Reduce Order.
+* @details	Says how partial results of parallel reduction are combined.
+* @see		MsvParallelReduce
+* @see		MsvParallelTransformReduce
+******************************************************************************************************/
+enum class MsvReduceOrder: uint8_t
+{
+	MSV_REDUCE_ANY_ORDER = 0,					///< Partial results are accumulated per worker (reduce operation must be associative and commutative).
+	MSV_REDUCE_DETERMINISTIC = 1				///< Partial results are accumulated per block and combined in fixed order (reduce operation must be associative, result does not depend on scheduling).
+};
+
+
+#endif // MARSTECH_REDUCEORDER_H
+
+/** @} */	//End of group MTHREADING.
@@ -0,0 +1,161 @@
+/**************************************************************************************************//**
+* @addtogroup	MTHREADING
+* @{
+******************************************************************************************************/
+
+/**************************************************************************************************//**
+* @file
+* @brief			MarsTech Sleep Slot
+* @details		Contains implementation of @ref MsvSleepSlot.
+* @author		Martin Svoboda
+* @date			16.10.2026
+* @copyright	GNU General Public License (GPLv3).
+******************************************************************************************************/
+
+
+/*
+This file is part of MarsTech Threading.
+
+MarsTech Dependency Injection is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+MarsTech Promise Like Syntax is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with Foobar. If not, see <https://www.gnu.org/licenses/>.
+*/
+
+
+#include "MsvSleepSlot.h"
+#include "MsvFutex.h"
+
+MSV_DISABLE_ALL_WARNINGS
+
+#include <chrono>
+
+MSV_ENABLE_WARNINGS
+
+
+/********************************************************************************************************************************
+*															Constructors and destructors
+********************************************************************************************************************************/
+
+
+MsvSleepSlot::MsvSleepSlot():
+	idle(false),
+	pNext(nullptr),
+	m_state(0)
+{
+
+}
+
+
+/********************************************************************************************************************************
+*															MsvSleepSlot public methods
+********************************************************************************************************************************/
+
+
+bool MsvSleepSlot::Wait(int32_t timeout)
+{
+	std::chrono::steady_clock::time_point deadline = std::chrono::steady_clock::now() + std::chrono::microseconds(timeout);
+	uint32_t state = m_state.load(std::memory_order_acquire);
+
+	for (;;)
+	{
+		if (state & MSV_SLEEP_SLOT_STOPPED)
+		{
+			m_state.fetch_and(~MSV_SLEEP_SLOT_PARKED, std::memory_order_relaxed);
+			return false;
+		}
+
+		if (state & MSV_SLEEP_SLOT_SIGNALED)
+		{
+			//consume signal (stop set meanwhile stays for the next wait)
+			m_state.fetch_and(~(MSV_SLEEP_SLOT_SIGNALED | MSV_SLEEP_SLOT_PARKED), std::memory_order_acq_rel);
+			return true;
+		}
+
+		if (!(state & MSV_SLEEP_SLOT_PARKED))
+		{
+			//announce sleep first -> signal which sees parked flag calls futex wake
+			if (!m_state.compare_exchange_weak(state, state | MSV_SLEEP_SLOT_PARKED, std::memory_order_acq_rel, std::memory_order_acquire))
+			{
+				continue;
+			}
+			state |= MSV_SLEEP_SLOT_PARKED;
+		}
+
+		int64_t remaining = 0;
+		if (timeout > 0)
+		{
+			remaining = std::chrono::duration_cast<std::chrono::microseconds>(deadline - std::chrono::steady_clock::now()).count();
+			if (remaining <= 0)
+			{
+				//timeout
+				m_state.fetch_and(~MSV_SLEEP_SLOT_PARKED, std::memory_order_relaxed);
+				return true;
+			}
+		}
+
+		//returns immediately when state has been changed meanwhile
+		MsvFutexWait(m_state, state, remaining);
+		state = m_state.load(std::memory_order_acquire);
+	}
+}
+
+bool MsvSleepSlot::TryWait(bool& stopped)
+{
+	uint32_t state = m_state.load(std::memory_order_acquire);
+
+	stopped = (state & MSV_SLEEP_SLOT_STOPPED) != 0;
+	if (stopped)
+	{
+		return true;
+	}
+
+	if (state & MSV_SLEEP_SLOT_SIGNALED)
+	{
+		m_state.fetch_and(~MSV_SLEEP_SLOT_SIGNALED, std::memory_order_acq_rel);
+		return true;
+	}
+
+	return false;
+}
+
+void MsvSleepSlot::Signal()
+{
+	SetFlag(MSV_SLEEP_SLOT_SIGNALED);
+}
+
+void MsvSleepSlot::Stop()
+{
+	SetFlag(MSV_SLEEP_SLOT_STOPPED);
+}
+
+bool MsvSleepSlot::IsSignaled() const
+{
+	return (m_state.load(std::memory_order_acquire) & (MSV_SLEEP_SLOT_SIGNALED | MSV_SLEEP_SLOT_STOPPED)) != 0;
+}
+
+
+/********************************************************************************************************************************
+*															MsvSleepSlot protected methods
+********************************************************************************************************************************/
+
+
+void MsvSleepSlot::SetFlag(uint32_t flag)
+{
+	//awake owner -> just flag (no syscall)
+	if (m_state.fetch_or(flag, std::memory_order_acq_rel) & MSV_SLEEP_SLOT_PARKED)
+	{
+		//only owner waits on the slot (spurious wake up of released slot address is harmless)
+		MsvFutexWake(m_state, false);
+	}
+}
+
+/** @} */	//End of group MTHREADING.
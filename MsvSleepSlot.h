@@ -0,0 +1,150 @@
+/**************************************************************************************************//**
+* @addtogroup	MTHREADING
+* @{
+******************************************************************************************************/
+
+/**************************************************************************************************//**
+* @file
+* @brief			MarsTech Sleep Slot
+* @details		Defines sleep slot of one thread (futex based waiting without locks).
+* @author		Martin Svoboda
+* @date			16.10.2026
+* @copyright	GNU General Public License (GPLv3).
+******************************************************************************************************/
+
+
+/*
+This file is part of MarsTech Threading.
+
+MarsTech Dependency Injection is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+MarsTech Promise Like Syntax is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with Foobar. If not, see <https://www.gnu.org/licenses/>.
+*/
+
+
+#ifndef MARSTECH_SLEEPSLOT_H
+#define MARSTECH_SLEEPSLOT_H
+
+
+#include "mheaders/MsvCompiler.h"
+MSV_DISABLE_ALL_WARNINGS
+
+#include <atomic>
+#include <cstdint>
+
+MSV_ENABLE_WARNINGS
+
+
+/**************************************************************************************************//**
+* @brief		MarsTech Sleep Slot.
+* @details	Each thread sleeps in its own slot, so it is woken up only when it is signaled (there is no
+*				thundering herd on shared condition variable). Slot state is one futex word:
+*				- @ref Signal and @ref Stop only set flag when owner does not sleep (no syscall, no lock).
+*				- Owner which is going to sleep sets parked flag first, so only wake up of sleeping owner
+*					costs futex wake syscall.
+* @see		MsvIdleWorkerStack
+* @see		MsvFutexWait
+******************************************************************************************************/
+class MsvSleepSlot
+{
+public:
+	/**************************************************************************************************//**
+	* @brief		Slot has been signaled (the next wait returns immediately).
+	******************************************************************************************************/
+	static const uint32_t MSV_SLEEP_SLOT_SIGNALED = 0x1;
+
+	/**************************************************************************************************//**
+	* @brief		Slot has been stopped (all following waits return immediately).
+	******************************************************************************************************/
+	static const uint32_t MSV_SLEEP_SLOT_STOPPED = 0x2;
+
+	/**************************************************************************************************//**
+	* @brief		Owner of the slot sleeps (or it is going to sleep) on futex word.
+	******************************************************************************************************/
+	static const uint32_t MSV_SLEEP_SLOT_PARKED = 0x4;
+
+	/**************************************************************************************************//**
+	* @brief		Constructor.
+	******************************************************************************************************/
+	MsvSleepSlot();
+
+	/**************************************************************************************************//**
+	* @brief			Wait in the slot.
+	* @details		Returns immediately when slot has been signaled (signal is consumed). Otherwise calling
+	*					thread sleeps until it is signaled (or until timeout).
+	* @param[in]	timeout		Timeout in microseconds (zero or negative means infinite wait).
+	* @returns		bool
+	* @retval		true		When slot has been signaled (or timeout has expired).
+	* @retval		false		When slot has been stopped.
+	* @warning		Only owner of the slot can wait in it.
+	******************************************************************************************************/
+	bool Wait(int32_t timeout);
+
+	/**************************************************************************************************//**
+	* @brief			Try to consume signal without waiting.
+	* @param[out]	stopped		Flag if slot has been stopped.
+	* @returns		bool
+	* @retval		true		When slot has been signaled or stopped.
+	* @retval		false		When slot has not been signaled (owner would wait).
+	******************************************************************************************************/
+	bool TryWait(bool& stopped);
+
+	/**************************************************************************************************//**
+	* @brief			Signal the slot.
+	* @details		Wakes up owner of the slot (its next wait returns immediately when it does not wait now).
+	******************************************************************************************************/
+	void Signal();
+
+	/**************************************************************************************************//**
+	* @brief			Stop the slot.
+	* @details		Wakes up owner of the slot and all its following waits return false.
+	******************************************************************************************************/
+	void Stop();
+
+	/**************************************************************************************************//**
+	* @brief			Check if slot has been signaled or stopped.
+	* @details		Signal is not consumed.
+	* @returns		bool
+	******************************************************************************************************/
+	bool IsSignaled() const;
+
+public:
+	/**************************************************************************************************//**
+	* @brief		Flag if slot is in idle stack (it is locked by stack mutex).
+	* @see		MsvIdleWorkerStack
+	******************************************************************************************************/
+	bool idle;
+
+	/**************************************************************************************************//**
+	* @brief		Next slot in idle stack (it is locked by stack mutex).
+	* @see		MsvIdleWorkerStack
+	******************************************************************************************************/
+	MsvSleepSlot* pNext;
+
+protected:
+	/**************************************************************************************************//**
+	* @brief			Set slot flag and wake up its owner when it sleeps.
+	* @param[in]	flag		Flag to set (signaled or stopped).
+	******************************************************************************************************/
+	void SetFlag(uint32_t flag);
+
+protected:
+	/**************************************************************************************************//**
+	* @brief		Slot state (futex word with signaled, stopped and parked flags).
+	******************************************************************************************************/
+	std::atomic<uint32_t> m_state;
+};
+
+
+#endif // MARSTECH_SLEEPSLOT_H
+
+/** @} */	//End of group MTHREADING.
@@ -0,0 +1,228 @@
+/**************************************************************************************************//**
+* @addtogroup	MTHREADING
+* @{
+******************************************************************************************************/
+
+/**************************************************************************************************//**
+* @file
+* @brief			MarsTech Work Stealing Task Deque
+* @details		Contains implementation of @ref MsvTaskDeque and @ref MsvOwnedTask.
+* @author		Martin Svoboda
+* @date			16.10.2026
+* @copyright	GNU General Public License (GPLv3).
+******************************************************************************************************/
+
+
+/*
+This file is part of MarsTech Threading.
+
+MarsTech Dependency Injection is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+MarsTech Promise Like Syntax is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with Foobar. If not, see <https://www.gnu.org/licenses/>.
+*/
+
+
+#include "MsvTaskDeque.h"
+
+
+/********************************************************************************************************************************
+*															Constructors and destructors
+********************************************************************************************************************************/
+
+
+MsvOwnedTask::MsvOwnedTask(std::shared_ptr<IMsvTask> spTask):
+	m_spTask(spTask)
+{
+
+}
+
+MsvTaskDeque::MsvTaskDequeBuffer::MsvTaskDequeBuffer(int64_t bufferCapacity):
+	capacity(bufferCapacity),
+	tasks(new (std::nothrow) std::atomic<IMsvTask*>[static_cast<size_t>(bufferCapacity)])
+{
+
+}
+
+MsvTaskDeque::MsvTaskDeque(size_t capacity)
+{
+	m_top.value.store(0, std::memory_order_relaxed);
+	m_bottom.value.store(0, std::memory_order_relaxed);
+	m_pBuffer.store(nullptr, std::memory_order_relaxed);
+
+	//capacity must be power of two (index is masked)
+	int64_t bufferCapacity = 1;
+	while (bufferCapacity < static_cast<int64_t>(capacity))
+	{
+		bufferCapacity <<= 1;
+	}
+
+	std::unique_ptr<MsvTaskDequeBuffer> spBuffer(new (std::nothrow) MsvTaskDequeBuffer(bufferCapacity));
+	if (spBuffer && spBuffer->tasks)
+	{
+		m_pBuffer.store(spBuffer.get(), std::memory_order_relaxed);
+		m_buffers.push_back(std::move(spBuffer));
+	}
+}
+
+MsvTaskDeque::~MsvTaskDeque()
+{
+
+}
+
+
+/********************************************************************************************************************************
+*															MsvOwnedTask public methods
+********************************************************************************************************************************/
+
+
+void MsvOwnedTask::Execute()
+{
+	//delete itself first (task can throw an exception)
+	std::shared_ptr<IMsvTask> spTask = std::move(m_spTask);
+	delete this;
+
+	if (spTask)
+	{
+		spTask->Execute();
+	}
+}
+
+
+/********************************************************************************************************************************
+*															MsvTaskDeque public methods
+********************************************************************************************************************************/
+
+
+bool MsvTaskDeque::Push(IMsvTask* pTask)
+{
+	int64_t bottom = m_bottom.value.load(std::memory_order_relaxed);
+	int64_t top = m_top.value.load(std::memory_order_acquire);
+	MsvTaskDequeBuffer* pBuffer = m_pBuffer.load(std::memory_order_relaxed);
+
+	if (!pBuffer)
+	{
+		return false;
+	}
+
+	if (bottom - top > pBuffer->capacity - 1)
+	{
+		//deque is full -> grow
+		pBuffer = Grow(pBuffer, top, bottom);
+		if (!pBuffer)
+		{
+			return false;
+		}
+	}
+
+	//release -> thief which sees new bottom sees the task too
+	pBuffer->tasks[bottom & (pBuffer->capacity - 1)].store(pTask, std::memory_order_relaxed);
+	m_bottom.value.store(bottom + 1, std::memory_order_release);
+
+	return true;
+}
+
+IMsvTask* MsvTaskDeque::Pop()
+{
+	MsvTaskDequeBuffer* pBuffer = m_pBuffer.load(std::memory_order_relaxed);
+	if (!pBuffer)
+	{
+		return nullptr;
+	}
+
+	//reserve the bottom task first (thieves must see it before top is read)
+	int64_t bottom = m_bottom.value.load(std::memory_order_relaxed) - 1;
+	m_bottom.value.store(bottom, std::memory_order_relaxed);
+	std::atomic_thread_fence(std::memory_order_seq_cst);
+	int64_t top = m_top.value.load(std::memory_order_relaxed);
+
+	if (top > bottom)
+	{
+		//deque is empty
+		m_bottom.value.store(bottom + 1, std::memory_order_relaxed);
+		return nullptr;
+	}
+
+	IMsvTask* pTask = pBuffer->tasks[bottom & (pBuffer->capacity - 1)].load(std::memory_order_relaxed);
+	if (top == bottom)
+	{
+		//the last task -> race with thieves
+		if (!m_top.value.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed))
+		{
+			pTask = nullptr;
+		}
+		m_bottom.value.store(bottom + 1, std::memory_order_relaxed);
+	}
+
+	return pTask;
+}
+
+IMsvTask* MsvTaskDeque::Steal()
+{
+	for (;;)
+	{
+		int64_t top = m_top.value.load(std::memory_order_acquire);
+		std::atomic_thread_fence(std::memory_order_seq_cst);
+		int64_t bottom = m_bottom.value.load(std::memory_order_acquire);
+
+		if (top >= bottom)
+		{
+			return nullptr;
+		}
+
+		MsvTaskDequeBuffer* pBuffer = m_pBuffer.load(std::memory_order_acquire);
+		IMsvTask* pTask = pBuffer->tasks[top & (pBuffer->capacity - 1)].load(std::memory_order_relaxed);
+		if (m_top.value.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed))
+		{
+			return pTask;
+		}
+
+		//another thread took the task -> try again
+	}
+}
+
+size_t MsvTaskDeque::GetSize() const
+{
+	int64_t top = m_top.value.load();
+	int64_t bottom = m_bottom.value.load();
+
+	return bottom > top ? static_cast<size_t>(bottom - top) : 0;
+}
+
+
+/********************************************************************************************************************************
+*															MsvTaskDeque protected methods
+********************************************************************************************************************************/
+
+
+MsvTaskDeque::MsvTaskDequeBuffer* MsvTaskDeque::Grow(MsvTaskDequeBuffer* pBuffer, int64_t top, int64_t bottom)
+{
+	std::unique_ptr<MsvTaskDequeBuffer> spBuffer(new (std::nothrow) MsvTaskDequeBuffer(pBuffer->capacity * 2));
+	if (!spBuffer || !spBuffer->tasks)
+	{
+		return nullptr;
+	}
+
+	for (int64_t i = top; i < bottom; ++i)
+	{
+		spBuffer->tasks[i & (spBuffer->capacity - 1)].store(pBuffer->tasks[i & (pBuffer->capacity - 1)].load(std::memory_order_relaxed), std::memory_order_relaxed);
+	}
+
+	//old buffer is kept (thieves can still read it)
+	MsvTaskDequeBuffer* pNewBuffer = spBuffer.get();
+	m_buffers.push_back(std::move(spBuffer));
+	m_pBuffer.store(pNewBuffer, std::memory_order_release);
+
+	return pNewBuffer;
+}
+
+
+/** @} */	//End of group MTHREADING.
@@ -0,0 +1,190 @@
+/**************************************************************************************************//**
+* @addtogroup	MTHREADING
+* @{
+******************************************************************************************************/
+
+/**************************************************************************************************//**
+* @file
+* @brief			MarsTech Work Stealing Task Deque
+* @details		Contains implementation of work stealing deque @ref MsvTaskDeque and @ref MsvOwnedTask.
+* @author		Martin Svoboda
+* @date			16.10.2026
+* @copyright	GNU General Public License (GPLv3).
+******************************************************************************************************/
+
+
+/*
+This file is part of MarsTech Threading.
+
+MarsTech Dependency Injection is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+MarsTech Promise Like Syntax is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with Foobar. If not, see <https://www.gnu.org/licenses/>.
+*/
+
+
+#ifndef MARSTECH_TASKDEQUE_H
+#define MARSTECH_TASKDEQUE_H
+
+
+#include "IMsvTask.h"
+#include "MsvCacheLine.h"
+
+MSV_DISABLE_ALL_WARNINGS
+
+#include <atomic>
+#include <memory>
+#include <vector>
+#include <cstdint>
+
+MSV_ENABLE_WARNINGS
+
+
+/**************************************************************************************************//**
+* @brief		MarsTech Owned Task.
+* @details	Heap allocated task which owns shared task. It executes shared task and deletes itself. It is
+*				used to store shared tasks to @ref MsvTaskDeque (deque stores raw pointers only). Tasks without
+*				owner (their lifetime is guaranteed by caller) are stored without it.
+* @see		MsvTaskDeque
+******************************************************************************************************/
+class MsvOwnedTask:
+	public IMsvTask
+{
+public:
+	/**************************************************************************************************//**
+	* @brief			Constructor.
+	* @param[in]	spTask		Shared pointer to owned task.
+	******************************************************************************************************/
+	MsvOwnedTask(std::shared_ptr<IMsvTask> spTask);
+
+	/**************************************************************************************************//**
+	* @brief		Execute task.
+	* @details	Deletes itself and executes owned task.
+	* @warning	Object is deleted after this call.
+	******************************************************************************************************/
+	virtual void Execute() override;
+
+protected:
+	/**************************************************************************************************//**
+	* @brief		Owned task.
+	******************************************************************************************************/
+	std::shared_ptr<IMsvTask> m_spTask;
+};
+
+
+/**************************************************************************************************//**
+* @brief		MarsTech Work Stealing Task Deque.
+* @details	Lock-free Chase-Lev deque of tasks. The owner thread pushes and pops tasks at the bottom (last in
+*				first out -> good cache locality), other threads steal tasks from the top (first in first out).
+*				Buffer grows when it is full (old buffers are kept until destruction because thieves can
+*				still read them).
+* @warning	@ref Push and @ref Pop can be called only by the owner thread. @ref Steal can be called by any
+*				thread.
+* @note		Deque does not own the tasks (it stores raw pointers).
+******************************************************************************************************/
+class MsvTaskDeque
+{
+public:
+	/**************************************************************************************************//**
+	* @brief			Constructor.
+	* @param[in]	capacity		Initial capacity (it is rounded up to power of two).
+	******************************************************************************************************/
+	MsvTaskDeque(size_t capacity = 256);
+
+	/**************************************************************************************************//**
+	* @brief		Destructor.
+	* @warning	Tasks which are still in the deque are not deleted.
+	******************************************************************************************************/
+	~MsvTaskDeque();
+
+	/**************************************************************************************************//**
+	* @brief			Push task to the bottom.
+	* @param[in]	pTask		Pointer to task.
+	* @returns		bool
+	* @retval		true		When task has been pushed.
+	* @retval		false		When allocation of bigger buffer failed.
+	* @warning		Owner thread only.
+	******************************************************************************************************/
+	bool Push(IMsvTask* pTask);
+
+	/**************************************************************************************************//**
+	* @brief			Pop task from the bottom.
+	* @returns		IMsvTask*
+	* @retval		nullptr	When deque is empty.
+	* @warning		Owner thread only.
+	******************************************************************************************************/
+	IMsvTask* Pop();
+
+	/**************************************************************************************************//**
+	* @brief			Steal task from the top.
+	* @returns		IMsvTask*
+	* @retval		nullptr	When deque is empty.
+	******************************************************************************************************/
+	IMsvTask* Steal();
+
+	/**************************************************************************************************//**
+	* @brief			Get deque size.
+	* @returns		size_t
+	* @note			The value is only approximate when the deque is used by other threads.
+	******************************************************************************************************/
+	size_t GetSize() const;
+
+protected:
+	/**************************************************************************************************//**
+	* @brief		Deque buffer.
+	* @details	Circular buffer with power of two capacity.
+	******************************************************************************************************/
+	struct MsvTaskDequeBuffer
+	{
+		MsvTaskDequeBuffer(int64_t bufferCapacity);
+
+		int64_t capacity;
+		std::unique_ptr<std::atomic<IMsvTask*>[]> tasks;
+	};
+
+	/**************************************************************************************************//**
+	* @brief			Grow buffer.
+	* @details		Creates buffer with double capacity and copies tasks from top to bottom to it.
+	* @param[in]	pBuffer		Current buffer.
+	* @param[in]	top			Top index.
+	* @param[in]	bottom		Bottom index.
+	* @returns		MsvTaskDequeBuffer*
+	* @retval		nullptr		When allocation failed.
+	******************************************************************************************************/
+	MsvTaskDequeBuffer* Grow(MsvTaskDequeBuffer* pBuffer, int64_t top, int64_t bottom);
+
+protected:
+	/**************************************************************************************************//**
+	* @brief		Top index (thieves steal from it).
+	******************************************************************************************************/
+	MsvCacheLinePadded<std::atomic<int64_t>> m_top;
+
+	/**************************************************************************************************//**
+	* @brief		Bottom index (owner pushes and pops at it).
+	******************************************************************************************************/
+	MsvCacheLinePadded<std::atomic<int64_t>> m_bottom;
+
+	/**************************************************************************************************//**
+	* @brief		Current buffer.
+	******************************************************************************************************/
+	std::atomic<MsvTaskDequeBuffer*> m_pBuffer;
+
+	/**************************************************************************************************//**
+	* @brief		All buffers.
+	* @details	Contains current and all old buffers (they are released in destructor).
+	******************************************************************************************************/
+	std::vector<std::unique_ptr<MsvTaskDequeBuffer>> m_buffers;
+};
+
+
+#endif // MARSTECH_TASKDEQUE_H
+
+/** @} */	//End of group MTHREADING.
@@ -0,0 +1,377 @@
+/**************************************************************************************************//**
+* @addtogroup	MTHREADING
+* @{
+******************************************************************************************************/
+
+/**************************************************************************************************//**
+* @file
+* @brief			MarsTech Task Graph
+* @details		Contains implementation of @ref MsvTaskGraph.
+* @author		Martin Svoboda
+* @date			16.10.2026
+* @copyright	GNU General Public License (GPLv3).
+******************************************************************************************************/
+
+
+/*
+This file is part of MarsTech Threading.
+
+MarsTech Dependency Injection is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+MarsTech Promise Like Syntax is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with Foobar. If not, see <https://www.gnu.org/licenses/>.
+*/
+
+
+#include "MsvTaskGraph.h"
+
+#include "MsvThreadPool_Factory.h"
+
+
+/********************************************************************************************************************************
+*															Constructors and destructors
+********************************************************************************************************************************/
+
+
+MsvTaskGraph::MsvTaskGraph(std::shared_ptr<MsvThreadPool_Factory> spFactory):
+	m_spFactory(spFactory ? spFactory : MsvThreadPool_Factory::Get()),
+	m_compiled(false)
+{
+
+}
+
+MsvTaskGraph::~MsvTaskGraph()
+{
+	//node tasks reference this graph
+	m_waiter.Wait(m_spThreadPool);
+}
+
+MsvTaskGraph::MsvTaskGraphNodeTask::MsvTaskGraphNodeTask(MsvTaskGraph* pGraph, size_t nodeId):
+	m_pGraph(pGraph),
+	m_nodeId(nodeId)
+{
+
+}
+
+
+/********************************************************************************************************************************
+*															MsvTaskGraph public methods
+********************************************************************************************************************************/
+
+
+MsvErrorCode MsvTaskGraph::AddNode(std::shared_ptr<IMsvTask> spTask, size_t* pNodeId)
+{
+	if (!spTask)
+	{
+		return MSV_INVALID_DATA_ERROR;
+	}
+
+	if (IsRunning())
+	{
+		return MSV_ALREADY_RUNNING_INFO;
+	}
+
+	try
+	{
+		m_tasks.push_back(spTask);
+	}
+	catch (...)
+	{
+		//allocation failed
+		return MSV_ALLOCATION_ERROR;
+	}
+
+	m_compiled = false;
+	if (pNodeId)
+	{
+		*pNodeId = m_tasks.size() - 1;
+	}
+
+	return MSV_SUCCESS;
+}
+
+MsvErrorCode MsvTaskGraph::AddNode(std::function<void()>& task, size_t* pNodeId)
+{
+	//create task
+	std::shared_ptr<IMsvTask> spTask;
+	if (m_spFactory)
+	{
+		spTask = m_spFactory->GetIMsvTask(task);
+	}
+
+	if (!spTask)
+	{
+		return MSV_ALLOCATION_ERROR;
+	}
+
+	return AddNode(spTask, pNodeId);
+}
+
+MsvErrorCode MsvTaskGraph::AddEdge(size_t fromNodeId, size_t toNodeId)
+{
+	if (fromNodeId >= m_tasks.size() || toNodeId >= m_tasks.size() || fromNodeId == toNodeId)
+	{
+		return MSV_INVALID_DATA_ERROR;
+	}
+
+	if (IsRunning())
+	{
+		return MSV_ALREADY_RUNNING_INFO;
+	}
+
+	try
+	{
+		m_edges.push_back(std::make_pair(fromNodeId, toNodeId));
+	}
+	catch (...)
+	{
+		//allocation failed
+		return MSV_ALLOCATION_ERROR;
+	}
+
+	m_compiled = false;
+
+	return MSV_SUCCESS;
+}
+
+MsvErrorCode MsvTaskGraph::Run(std::shared_ptr<IMsvThreadPool> spThreadPool)
+{
+	if (!spThreadPool)
+	{
+		return MSV_NOT_INITIALIZED_ERROR;
+	}
+
+	if (IsRunning())
+	{
+		return MSV_ALREADY_RUNNING_INFO;
+	}
+
+	if (!m_waiter.IsInitialized())
+	{
+		return MSV_ALLOCATION_ERROR;
+	}
+
+	if (!m_compiled)
+	{
+		MSV_RETURN_FAILED(Compile());
+	}
+
+	//reset counters (graph is not running -> nobody else uses them)
+	for (size_t i = 0; i < m_tasks.size(); ++i)
+	{
+		m_pendingPredecessors[i].store(m_predecessorCounts[i], std::memory_order_relaxed);
+	}
+	m_spThreadPool = spThreadPool;
+	m_waiter.Add(m_tasks.size());
+
+	std::vector<size_t>::const_iterator endIt = m_roots.end();
+	for (std::vector<size_t>::const_iterator it = m_roots.begin(); it != endIt; ++it)
+	{
+		if (MSV_FAILED(AddNodeTask(*it)))
+		{
+			//graph has been started -> root can't be skipped
+			ExecuteNode(*it);
+		}
+	}
+
+	return MSV_SUCCESS;
+}
+
+void MsvTaskGraph::Wait()
+{
+	m_waiter.Wait(m_spThreadPool);
+
+	std::exception_ptr pException;
+	{
+		std::lock_guard<std::mutex> lock(m_exceptionLock);
+		pException = m_exception;
+		m_exception = nullptr;
+	}
+
+	if (pException)
+	{
+		std::rethrow_exception(pException);
+	}
+}
+
+bool MsvTaskGraph::IsRunning() const
+{
+	return m_waiter.GetPendingCount() != 0;
+}
+
+size_t MsvTaskGraph::GetNodeCount() const
+{
+	return m_tasks.size();
+}
+
+
+/********************************************************************************************************************************
+*															MsvTaskGraph protected methods
+********************************************************************************************************************************/
+
+
+MsvErrorCode MsvTaskGraph::Compile()
+{
+	size_t nodeCount = m_tasks.size();
+
+	try
+	{
+		//successors of each node are stored in one array (counting sort of edges by predecessor)
+		m_successorOffsets.assign(nodeCount + 1, 0);
+		m_predecessorCounts.assign(nodeCount, 0);
+		m_successors.resize(m_edges.size());
+
+		std::vector<std::pair<size_t, size_t>>::const_iterator endIt = m_edges.end();
+		for (std::vector<std::pair<size_t, size_t>>::const_iterator it = m_edges.begin(); it != endIt; ++it)
+		{
+			++m_successorOffsets[it->first + 1];
+			++m_predecessorCounts[it->second];
+		}
+		for (size_t i = 0; i < nodeCount; ++i)
+		{
+			m_successorOffsets[i + 1] += m_successorOffsets[i];
+		}
+
+		std::vector<size_t> positions(m_successorOffsets.begin(), m_successorOffsets.end() - 1);
+		for (std::vector<std::pair<size_t, size_t>>::const_iterator it = m_edges.begin(); it != endIt; ++it)
+		{
+			m_successors[positions[it->first]++] = it->second;
+		}
+
+		//roots and cycle check (topological sort -> every node must be reached)
+		m_roots.clear();
+		std::vector<size_t> predecessors(m_predecessorCounts);
+		std::vector<size_t> order;
+		order.reserve(nodeCount);
+		for (size_t i = 0; i < nodeCount; ++i)
+		{
+			if (!predecessors[i])
+			{
+				m_roots.push_back(i);
+				order.push_back(i);
+			}
+		}
+		for (size_t i = 0; i < order.size(); ++i)
+		{
+			for (size_t j = m_successorOffsets[order[i]]; j < m_successorOffsets[order[i] + 1]; ++j)
+			{
+				if (!--predecessors[m_successors[j]])
+				{
+					order.push_back(m_successors[j]);
+				}
+			}
+		}
+
+		if (order.size() != nodeCount)
+		{
+			return MSV_INVALID_DATA_ERROR;
+		}
+
+		//node tasks of already compiled nodes are kept
+		for (size_t i = m_nodeTasks.size(); i < nodeCount; ++i)
+		{
+			std::shared_ptr<IMsvTask> spNodeTask(new (std::nothrow) MsvTaskGraphNodeTask(this, i));
+			if (!spNodeTask)
+			{
+				return MSV_ALLOCATION_ERROR;
+			}
+
+			m_nodeTasks.push_back(spNodeTask);
+		}
+		m_nodeTasks.resize(nodeCount);
+	}
+	catch (...)
+	{
+		//allocation failed
+		return MSV_ALLOCATION_ERROR;
+	}
+
+	m_pendingPredecessors.reset(new (std::nothrow) std::atomic<size_t>[nodeCount]);
+	if (!m_pendingPredecessors && nodeCount)
+	{
+		return MSV_ALLOCATION_ERROR;
+	}
+
+	m_compiled = true;
+
+	return MSV_SUCCESS;
+}
+
+void MsvTaskGraph::ExecuteNode(size_t nodeId)
+{
+	const size_t noNode = m_tasks.size();
+
+	for (;;)
+	{
+		try
+		{
+			m_tasks[nodeId]->Execute();
+		}
+		catch (...)
+		{
+			//successors are executed anyway (graph must finish)
+			std::lock_guard<std::mutex> lock(m_exceptionLock);
+			if (!m_exception)
+			{
+				m_exception = std::current_exception();
+			}
+		}
+
+		//the first ready successor continues in this thread, the others are added to thread pool
+		size_t nextNodeId = noNode;
+		for (size_t i = m_successorOffsets[nodeId]; i < m_successorOffsets[nodeId + 1]; ++i)
+		{
+			size_t successorId = m_successors[i];
+			if (--m_pendingPredecessors[successorId])
+			{
+				continue;
+			}
+
+			if (nextNodeId == noNode)
+			{
+				nextNodeId = successorId;
+			}
+			else if (MSV_FAILED(AddNodeTask(successorId)))
+			{
+				//successor can't be lost
+				ExecuteNode(successorId);
+			}
+		}
+
+		//graph can be released by waiter right after the last node is counted down (waiter keeps its event)
+		m_waiter.Done();
+		if (nextNodeId == noNode)
+		{
+			return;
+		}
+
+		nodeId = nextNodeId;
+	}
+}
+
+MsvErrorCode MsvTaskGraph::AddNodeTask(size_t nodeId)
+{
+	//aliasing constructor without owner -> no control block (graph owns the node task)
+	return m_spThreadPool->AddTask(std::shared_ptr<IMsvTask>(std::shared_ptr<IMsvTask>(), m_nodeTasks[nodeId].get()));
+}
+
+
+/********************************************************************************************************************************
+*															MsvTaskGraphNodeTask protected methods
+********************************************************************************************************************************/
+
+
+void MsvTaskGraph::MsvTaskGraphNodeTask::Execute()
+{
+	m_pGraph->ExecuteNode(m_nodeId);
+}
+
+/** @} */	//End of group MTHREADING.
@@ -0,0 +1,273 @@
+/**************************************************************************************************//**
+* @addtogroup	MTHREADING
+* @{
+******************************************************************************************************/
+
+/**************************************************************************************************//**
+* @file
+* @brief			MarsTech Task Graph
+* @details		Contains declaration of @ref MsvTaskGraph.
+* @author		Martin Svoboda
+* @date			16.10.2026
+* @copyright	GNU General Public License (GPLv3).
+******************************************************************************************************/
+
+
+/*
+This file is part of MarsTech Threading.
+
+MarsTech Dependency Injection is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+MarsTech Promise Like Syntax is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with Foobar. If not, see <https://www.gnu.org/licenses/>.
+*/
+
+
+#ifndef MARSTECH_TASKGRAPH_H
+#define MARSTECH_TASKGRAPH_H
+
+
+#include "IMsvThreadPool.h"
+#include "MsvTaskWaiter.h"
+
+#include "merror/MsvError.h"
+
+MSV_DISABLE_ALL_WARNINGS
+
+#include <atomic>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+MSV_ENABLE_WARNINGS
+
+
+//forward declaration of MarsTech Thread Pool Dependency Injection Factory
+class MsvThreadPool_Factory;
+
+
+/**************************************************************************************************//**
+* @brief		MarsTech Task Graph.
+* @details	Dependency graph (DAG) of tasks which is built once and executed by thread pool repeatedly. Each
+*				node has atomic counter of pending predecessors. Node whose counter drops to zero is ready: the
+*				first ready successor is executed by the same worker (its predecessor's data are hot in cache)
+*				and the other ready successors are added to thread pool.
+* @note		Graph is compiled (successor arrays, counters and node tasks) by the first run after change. Next
+*				runs do not allocate anything (node tasks are added to thread pool without owner).
+* @warning	Graph can't be changed while it is running.
+******************************************************************************************************/
+class MsvTaskGraph
+{
+public:
+	/**************************************************************************************************//**
+	* @brief			Constructor.
+	* @param[in]	spFactory		Shared pointer to dependency injection factory.
+	* @see			MsvThreadPool_Factory
+	******************************************************************************************************/
+	MsvTaskGraph(std::shared_ptr<MsvThreadPool_Factory> spFactory = nullptr);
+
+	/**************************************************************************************************//**
+	* @brief		Virtual destructor.
+	* @details	Waits for running graph (node tasks reference the graph).
+	******************************************************************************************************/
+	virtual ~MsvTaskGraph();
+
+	/**************************************************************************************************//**
+	* @brief			Add node.
+	* @param[in]	spTask		Shared pointer to task of the node.
+	* @param[out]	pNodeId		Id of the node (nodes are numbered from zero in order of adding).
+	* @returns		MsvErrorCode
+	* @retval		MSV_INVALID_DATA_ERROR		When task is nullptr.
+	* @retval		MSV_ALREADY_RUNNING_INFO	When graph is running.
+	* @retval		MSV_ALLOCATION_ERROR			When allocation failed.
+	* @retval		MSV_SUCCESS						On success.
+	******************************************************************************************************/
+	virtual MsvErrorCode AddNode(std::shared_ptr<IMsvTask> spTask, size_t* pNodeId = nullptr);
+
+	/**************************************************************************************************//**
+	* @brief			Add node.
+	* @param[in]	task			Function of the node.
+	* @param[out]	pNodeId		Id of the node (nodes are numbered from zero in order of adding).
+	* @copydetails	AddNode(std::shared_ptr<IMsvTask> spTask, size_t* pNodeId)
+	******************************************************************************************************/
+	virtual MsvErrorCode AddNode(std::function<void()>& task, size_t* pNodeId = nullptr);
+
+	/**************************************************************************************************//**
+	* @brief			Add edge (dependency).
+	* @param[in]	fromNodeId		Id of predecessor.
+	* @param[in]	toNodeId			Id of successor (it is executed after predecessor).
+	* @returns		MsvErrorCode
+	* @retval		MSV_INVALID_DATA_ERROR		When any node does not exist or both nodes are the same.
+	* @retval		MSV_ALREADY_RUNNING_INFO	When graph is running.
+	* @retval		MSV_ALLOCATION_ERROR			When allocation failed.
+	* @retval		MSV_SUCCESS						On success.
+	* @note			Cycles are detected by @ref Run.
+	******************************************************************************************************/
+	virtual MsvErrorCode AddEdge(size_t fromNodeId, size_t toNodeId);
+
+	/**************************************************************************************************//**
+	* @brief			Run graph.
+	* @details		Adds nodes without predecessors to thread pool and returns (see @ref Wait).
+	* @param[in]	spThreadPool		Thread pool which executes the graph.
+	* @returns		MsvErrorCode
+	* @retval		MSV_NOT_INITIALIZED_ERROR	When thread pool is nullptr.
+	* @retval		MSV_ALREADY_RUNNING_INFO	When graph is running.
+	* @retval		MSV_INVALID_DATA_ERROR		When graph has cycle.
+	* @retval		MSV_ALLOCATION_ERROR			When allocation failed.
+	* @retval		MSV_SUCCESS						On success.
+	* @note			Root which could not be added to thread pool is executed by calling thread.
+	******************************************************************************************************/
+	virtual MsvErrorCode Run(std::shared_ptr<IMsvThreadPool> spThreadPool);
+
+	/**************************************************************************************************//**
+	* @brief			Wait until all nodes of the graph are executed.
+	* @details		Worker of the thread pool executes queued tasks while it waits. Other threads block.
+	* @throws		Exception of the first failed node.
+	******************************************************************************************************/
+	virtual void Wait();
+
+	/**************************************************************************************************//**
+	* @brief			Check if graph is running.
+	* @returns		bool
+	******************************************************************************************************/
+	virtual bool IsRunning() const;
+
+	/**************************************************************************************************//**
+	* @brief			Get count of nodes.
+	* @returns		size_t
+	******************************************************************************************************/
+	virtual size_t GetNodeCount() const;
+
+protected:
+	/**************************************************************************************************//**
+	* @brief		Task of the node.
+	* @details	It is added to thread pool when the node is ready.
+	******************************************************************************************************/
+	class MsvTaskGraphNodeTask:
+		public IMsvTask
+	{
+	public:
+		MsvTaskGraphNodeTask(MsvTaskGraph* pGraph, size_t nodeId);
+
+	protected:
+		virtual void Execute() override;
+
+		MsvTaskGraph* m_pGraph;
+		size_t m_nodeId;
+	};
+
+	/**************************************************************************************************//**
+	* @brief			Compile graph (successor arrays, predecessor counts and node tasks).
+	* @returns		MsvErrorCode
+	* @retval		MSV_INVALID_DATA_ERROR		When graph has cycle.
+	* @retval		MSV_ALLOCATION_ERROR			When allocation failed.
+	* @retval		MSV_SUCCESS						On success.
+	******************************************************************************************************/
+	MsvErrorCode Compile();
+
+	/**************************************************************************************************//**
+	* @brief			Execute node and its ready successors.
+	* @details		The first successor which becomes ready is executed by this thread, the others are added to
+	*					thread pool.
+	* @param[in]	nodeId		Id of the node.
+	******************************************************************************************************/
+	void ExecuteNode(size_t nodeId);
+
+	/**************************************************************************************************//**
+	* @brief			Add node task to thread pool.
+	* @details		Node task is added without owner (graph keeps it alive until the node is executed), so
+	*					worker pushes it to its deque without allocation.
+	* @param[in]	nodeId		Id of the node.
+	* @returns		MsvErrorCode
+	* @see			IMsvThreadPool::AddTask
+	******************************************************************************************************/
+	MsvErrorCode AddNodeTask(size_t nodeId);
+
+protected:
+	/**************************************************************************************************//**
+	* @brief		Shared pointer to dependency injection factory.
+	* @see		MsvThreadPool_Factory
+	******************************************************************************************************/
+	std::shared_ptr<MsvThreadPool_Factory> m_spFactory;
+
+	/**************************************************************************************************//**
+	* @brief		Tasks of the nodes.
+	******************************************************************************************************/
+	std::vector<std::shared_ptr<IMsvTask>> m_tasks;
+
+	/**************************************************************************************************//**
+	* @brief		Edges (predecessor, successor).
+	******************************************************************************************************/
+	std::vector<std::pair<size_t, size_t>> m_edges;
+
+	/**************************************************************************************************//**
+	* @brief		Flag if graph has been compiled (true) or it has been changed (false).
+	******************************************************************************************************/
+	bool m_compiled;
+
+	/**************************************************************************************************//**
+	* @brief		Offsets of node successors in @ref m_successors (node count + 1 items).
+	******************************************************************************************************/
+	std::vector<size_t> m_successorOffsets;
+
+	/**************************************************************************************************//**
+	* @brief		Successors of all nodes.
+	******************************************************************************************************/
+	std::vector<size_t> m_successors;
+
+	/**************************************************************************************************//**
+	* @brief		Predecessor counts of nodes.
+	******************************************************************************************************/
+	std::vector<size_t> m_predecessorCounts;
+
+	/**************************************************************************************************//**
+	* @brief		Nodes without predecessors.
+	******************************************************************************************************/
+	std::vector<size_t> m_roots;
+
+	/**************************************************************************************************//**
+	* @brief		Pending predecessors of nodes (they are reset by each run).
+	******************************************************************************************************/
+	std::unique_ptr<std::atomic<size_t>[]> m_pendingPredecessors;
+
+	/**************************************************************************************************//**
+	* @brief		Tasks of the nodes which are added to thread pool.
+	******************************************************************************************************/
+	std::vector<std::shared_ptr<IMsvTask>> m_nodeTasks;
+
+	/**************************************************************************************************//**
+	* @brief		Waiter of nodes which have not been executed yet.
+	******************************************************************************************************/
+	MsvTaskWaiter m_waiter;
+
+	/**************************************************************************************************//**
+	* @brief		Thread pool of the current run.
+	******************************************************************************************************/
+	std::shared_ptr<IMsvThreadPool> m_spThreadPool;
+
+	/**************************************************************************************************//**
+	* @brief		Exception of the first failed node.
+	******************************************************************************************************/
+	std::exception_ptr m_exception;
+
+	/**************************************************************************************************//**
+	* @brief		Lock of the exception.
+	******************************************************************************************************/
+	std::mutex m_exceptionLock;
+};
+
+
+#endif // MARSTECH_TASKGRAPH_H
+
+/** @} */	//End of group MTHREADING.
@@ -0,0 +1,183 @@
+/**************************************************************************************************//**
+* @addtogroup	MTHREADING
+* @{
+******************************************************************************************************/
+
+/**************************************************************************************************//**
+* @file
+* @brief			MarsTech Task Group
+* @details		Contains implementation of @ref MsvTaskGroup.
+* @author		Martin Svoboda
+* @date			16.10.2026
+* @copyright	GNU General Public License (GPLv3).
+******************************************************************************************************/
+
+
+/*
+This file is part of MarsTech Threading.
+
+MarsTech Dependency Injection is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+MarsTech Promise Like Syntax is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with Foobar. If not, see <https://www.gnu.org/licenses/>.
+*/
+
+
+#include "MsvTaskGroup.h"
+
+#include "MsvThreadPool_Factory.h"
+
+
+/********************************************************************************************************************************
+*															Constructors and destructors
+********************************************************************************************************************************/
+
+
+MsvTaskGroup::MsvTaskGroup(std::shared_ptr<IMsvThreadPool> spThreadPool, std::shared_ptr<MsvThreadPool_Factory> spFactory):
+	m_spFactory(spFactory ? spFactory : MsvThreadPool_Factory::Get()),
+	m_spThreadPool(spThreadPool)
+{
+
+}
+
+MsvTaskGroup::~MsvTaskGroup()
+{
+	//tasks reference this group
+	m_waiter.Wait(m_spThreadPool);
+}
+
+MsvTaskGroup::MsvTaskGroupTask::MsvTaskGroupTask(MsvTaskGroup* pGroup, std::shared_ptr<IMsvTask> spTask):
+	m_pGroup(pGroup),
+	m_spTask(spTask)
+{
+
+}
+
+
+/********************************************************************************************************************************
+*															MsvTaskGroup public methods
+********************************************************************************************************************************/
+
+
+MsvErrorCode MsvTaskGroup::AddTask(std::shared_ptr<IMsvTask> spTask)
+{
+	if (!spTask)
+	{
+		//nullptr task can't be executed -> skip it
+		return MSV_SUCCESS;
+	}
+
+	if (!m_spThreadPool)
+	{
+		return MSV_NOT_INITIALIZED_ERROR;
+	}
+
+	std::shared_ptr<IMsvTask> spGroupTask(new (std::nothrow) MsvTaskGroupTask(this, spTask));
+	if (!spGroupTask || !m_waiter.IsInitialized())
+	{
+		return MSV_ALLOCATION_ERROR;
+	}
+
+	//count the task before it can be executed
+	m_waiter.Add();
+
+	MsvErrorCode errorCode = m_spThreadPool->AddTask(spGroupTask);
+	if (MSV_FAILED(errorCode))
+	{
+		//waiter could wait for this task
+		m_waiter.Done();
+	}
+
+	return errorCode;
+}
+
+MsvErrorCode MsvTaskGroup::AddTask(std::function<void()>& task)
+{
+	//create task
+	std::shared_ptr<IMsvTask> spTask;
+	if (m_spFactory)
+	{
+		spTask = m_spFactory->GetIMsvTask(task);
+	}
+
+	if (!spTask)
+	{
+		return MSV_ALLOCATION_ERROR;
+	}
+
+	return AddTask(spTask);
+}
+
+void MsvTaskGroup::Wait()
+{
+	m_waiter.Wait(m_spThreadPool);
+
+	std::exception_ptr pException;
+	{
+		std::lock_guard<std::mutex> lock(m_exceptionLock);
+		pException = m_exception;
+		m_exception = nullptr;
+	}
+
+	if (pException)
+	{
+		std::rethrow_exception(pException);
+	}
+}
+
+size_t MsvTaskGroup::GetPendingTaskCount() const
+{
+	return m_waiter.GetPendingCount();
+}
+
+
+/********************************************************************************************************************************
+*															MsvTaskGroup protected methods
+********************************************************************************************************************************/
+
+
+void MsvTaskGroup::OnTaskDone(std::exception_ptr pException)
+{
+	if (pException)
+	{
+		std::lock_guard<std::mutex> lock(m_exceptionLock);
+		if (!m_exception)
+		{
+			m_exception = pException;
+		}
+	}
+
+	//group can be released by waiter right after the last task is counted down (waiter keeps its event)
+	m_waiter.Done();
+}
+
+
+/********************************************************************************************************************************
+*															MsvTaskGroupTask protected methods
+********************************************************************************************************************************/
+
+
+void MsvTaskGroup::MsvTaskGroupTask::Execute()
+{
+	std::exception_ptr pException;
+	try
+	{
+		m_spTask->Execute();
+	}
+	catch (...)
+	{
+		pException = std::current_exception();
+	}
+
+	m_pGroup->OnTaskDone(pException);
+}
+
+/** @} */	//End of group MTHREADING.
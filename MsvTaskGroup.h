@@ -0,0 +1,169 @@
+/**************************************************************************************************//**
+* @addtogroup	MTHREADING
+* @{
+******************************************************************************************************/
+
+/**************************************************************************************************//**
+* @file
+* @brief			MarsTech Task Group
+* @details		Contains declaration of @ref MsvTaskGroup.
+* @author		Martin Svoboda
+* @date			16.10.2026
+* @copyright	GNU General Public License (GPLv3).
+******************************************************************************************************/
+
+
+/*
+This file is part of MarsTech Threading.
+
+MarsTech Dependency Injection is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+MarsTech Promise Like Syntax is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with Foobar. If not, see <https://www.gnu.org/licenses/>.
+*/
+
+
+#ifndef MARSTECH_TASKGROUP_H
+#define MARSTECH_TASKGROUP_H
+
+
+#include "IMsvThreadPool.h"
+#include "MsvTaskWaiter.h"
+
+#include "merror/MsvError.h"
+
+MSV_DISABLE_ALL_WARNINGS
+
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+
+MSV_ENABLE_WARNINGS
+
+
+//forward declaration of MarsTech Thread Pool Dependency Injection Factory
+class MsvThreadPool_Factory;
+
+
+/**************************************************************************************************//**
+* @brief		MarsTech Task Group.
+* @details	Tracks tasks added to thread pool through the group and waits for them. Worker thread of the
+*				thread pool which waits for the group executes queued tasks instead of blocking (nested
+*				parallelism can't deadlock and the worker is not idle). Other threads wait for event.
+* @note		Exception thrown by any task is rethrown by @ref Wait (the first one only).
+* @see		IMsvThreadPool::TryExecuteTask
+* @see		MsvTaskWaiter
+******************************************************************************************************/
+class MsvTaskGroup
+{
+public:
+	/**************************************************************************************************//**
+	* @brief			Constructor.
+	* @param[in]	spThreadPool		Thread pool which executes tasks of the group.
+	* @param[in]	spFactory			Shared pointer to dependency injection factory.
+	* @see			MsvThreadPool_Factory
+	******************************************************************************************************/
+	MsvTaskGroup(std::shared_ptr<IMsvThreadPool> spThreadPool, std::shared_ptr<MsvThreadPool_Factory> spFactory = nullptr);
+
+	/**************************************************************************************************//**
+	* @brief		Virtual destructor.
+	* @details	Waits for all tasks of the group (they reference the group).
+	******************************************************************************************************/
+	virtual ~MsvTaskGroup();
+
+	/**************************************************************************************************//**
+	* @brief			Add task to the group (and to thread pool).
+	* @param[in]	spTask		Shared pointer to task.
+	* @returns		MsvErrorCode
+	* @retval		MSV_NOT_INITIALIZED_ERROR		When group has no thread pool.
+	* @retval		MSV_ALLOCATION_ERROR				When allocation failed.
+	* @retval		other error code					When adding task to thread pool failed.
+	* @retval		MSV_SUCCESS							On success (nullptr task is skipped).
+	******************************************************************************************************/
+	virtual MsvErrorCode AddTask(std::shared_ptr<IMsvTask> spTask);
+
+	/**************************************************************************************************//**
+	* @brief			Add function to the group (and to thread pool).
+	* @param[in]	task		Function to execute.
+	* @copydetails	AddTask(std::shared_ptr<IMsvTask> spTask)
+	******************************************************************************************************/
+	virtual MsvErrorCode AddTask(std::function<void()>& task);
+
+	/**************************************************************************************************//**
+	* @brief			Wait until all tasks of the group are executed.
+	* @details		Worker of the thread pool executes queued tasks while it waits. Other threads block.
+	* @throws		Exception of the first failed task.
+	******************************************************************************************************/
+	virtual void Wait();
+
+	/**************************************************************************************************//**
+	* @brief			Get count of tasks which have not been executed yet.
+	* @returns		size_t
+	******************************************************************************************************/
+	virtual size_t GetPendingTaskCount() const;
+
+protected:
+	/**************************************************************************************************//**
+	* @brief		Task of the group.
+	* @details	Executes task, stores its exception and counts it down.
+	******************************************************************************************************/
+	class MsvTaskGroupTask:
+		public IMsvTask
+	{
+	public:
+		MsvTaskGroupTask(MsvTaskGroup* pGroup, std::shared_ptr<IMsvTask> spTask);
+
+	protected:
+		virtual void Execute() override;
+
+		MsvTaskGroup* m_pGroup;
+		std::shared_ptr<IMsvTask> m_spTask;
+	};
+
+	/**************************************************************************************************//**
+	* @brief			Count down executed task.
+	* @param[in]	pException		Exception of the task (nullptr when succeeded).
+	******************************************************************************************************/
+	void OnTaskDone(std::exception_ptr pException);
+
+protected:
+	/**************************************************************************************************//**
+	* @brief		Shared pointer to dependency injection factory.
+	* @see		MsvThreadPool_Factory
+	******************************************************************************************************/
+	std::shared_ptr<MsvThreadPool_Factory> m_spFactory;
+
+	/**************************************************************************************************//**
+	* @brief		Thread pool which executes tasks of the group.
+	******************************************************************************************************/
+	std::shared_ptr<IMsvThreadPool> m_spThreadPool;
+
+	/**************************************************************************************************//**
+	* @brief		Waiter of tasks which have not been executed yet.
+	******************************************************************************************************/
+	MsvTaskWaiter m_waiter;
+
+	/**************************************************************************************************//**
+	* @brief		Exception of the first failed task.
+	******************************************************************************************************/
+	std::exception_ptr m_exception;
+
+	/**************************************************************************************************//**
+	* @brief		Lock of the exception.
+	******************************************************************************************************/
+	std::mutex m_exceptionLock;
+};
+
+
+#endif // MARSTECH_TASKGROUP_H
+
+/** @} */	//End of group MTHREADING.
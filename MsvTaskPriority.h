@@ -0,0 +1,79 @@
+/**************************************************************************************************//**
+* @addtogroup	MTHREADING
+* @{
+******************************************************************************************************/
+
+/**************************************************************************************************//**
+* @file
+* @brief			MarsTech Task Priority
+* @details		Contains task priorities @ref MsvTaskPriority and priority policies @ref MsvPriorityPolicy.
+* @author		Martin Svoboda
+* @date			16.10.2026
+* @copyright	GNU General Public License (GPLv3).
+******************************************************************************************************/
+
+
+/*
+This file is part of MarsTech Threading.
+
+MarsTech Dependency Injection is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+MarsTech Promise Like Syntax is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with Foobar. If not, see <https://www.gnu.org/licenses/>.
+*/
+
+
+#ifndef MARSTECH_TASKPRIORITY_H
+#define MARSTECH_TASKPRIORITY_H
+
+
+#include "mheaders/MsvCompiler.h"
+
+MSV_DISABLE_ALL_WARNINGS
+
+#include <cstddef>
+#include <cstdint>
+
+MSV_ENABLE_WARNINGS
+
+
+/**************************************************************************************************//**
+* @brief		MarsTech Task Priority.
+* @details	Priority band of task. Each band has its own first in first out queue.
+******************************************************************************************************/
+enum class MsvTaskPriority: uint8_t
+{
+	MSV_TASK_PRIORITY_HIGH = 0,					///< Latency critical tasks.
+	MSV_TASK_PRIORITY_NORMAL = 1,					///< Default priority.
+	MSV_TASK_PRIORITY_LOW = 2						///< Bulk (background) tasks.
+};
+
+/**************************************************************************************************//**
+* @brief		Count of task priority bands.
+* @see		MsvTaskPriority
+******************************************************************************************************/
+const size_t MSV_TASK_PRIORITY_COUNT = 3;
+
+
+/**************************************************************************************************//**
+* @brief		MarsTech Priority Policy.
+* @details	Says how priority bands are served.
+******************************************************************************************************/
+enum class MsvPriorityPolicy: uint8_t
+{
+	MSV_PRIORITY_STRICT = 0,						///< Task with higher priority is always popped first.
+	MSV_PRIORITY_WEIGHTED = 1						///< Bands are served in weighted round robin (see band weights).
+};
+
+
+#endif // MARSTECH_TASKPRIORITY_H
+
+/** @} */	//End of group MTHREADING.
@@ -0,0 +1,539 @@
+/**************************************************************************************************//**
+* @addtogroup	MTHREADING
+* @{
+******************************************************************************************************/
+
+/**************************************************************************************************//**
+* @file
+* @brief			MarsTech Task Queue Implementation
+* @details		Contains implementation of @ref MsvTaskQueue.
+* @author		Martin Svoboda
+* @date			16.10.2026
+* @copyright	GNU General Public License (GPLv3).
+******************************************************************************************************/
+
+
+/*
+This file is part of MarsTech Threading.
+
+MarsTech Dependency Injection is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+MarsTech Promise Like Syntax is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with Foobar. If not, see <https://www.gnu.org/licenses/>.
+*/
+
+
+#include "MsvTaskQueue.h"
+
+MSV_DISABLE_ALL_WARNINGS
+
+#include <algorithm>
+#include <cstdint>
+
+MSV_ENABLE_WARNINGS
+
+
+/********************************************************************************************************************************
+*															Hazard pointers
+********************************************************************************************************************************/
+
+
+namespace
+{
+	/**************************************************************************************************//**
+	* @brief		Hazard pointer record.
+	* @details	Each thread which uses unbounded queue owns one record (records are reused when threads end).
+	*				Segment stored in pHazard can not be released.
+	******************************************************************************************************/
+	struct MsvHazardRecord
+	{
+		std::atomic<void*> pHazard;
+		std::atomic<bool> active;
+		MsvHazardRecord* pNext;
+	};
+
+	/**************************************************************************************************//**
+	* @brief		List of all hazard pointer records (records are never released).
+	******************************************************************************************************/
+	std::atomic<MsvHazardRecord*> g_pHazardRecords(nullptr);
+
+	/**************************************************************************************************//**
+	* @brief		Thread hazard pointer record owner.
+	* @details	Acquires free (or new) record for current thread and releases it when thread ends.
+	******************************************************************************************************/
+	class MsvHazardRecordOwner
+	{
+	public:
+		MsvHazardRecordOwner():
+			m_pRecord(nullptr)
+		{
+			//try to reuse record of ended thread
+			for (MsvHazardRecord* pRecord = g_pHazardRecords.load(); pRecord; pRecord = pRecord->pNext)
+			{
+				bool active = false;
+				if (!pRecord->active.load(std::memory_order_relaxed) && pRecord->active.compare_exchange_strong(active, true))
+				{
+					m_pRecord = pRecord;
+					return;
+				}
+			}
+
+			//create new record and insert it to the list
+			m_pRecord = new (std::nothrow) MsvHazardRecord;
+			if (m_pRecord)
+			{
+				m_pRecord->pHazard.store(nullptr);
+				m_pRecord->active.store(true);
+				m_pRecord->pNext = g_pHazardRecords.load();
+				while (!g_pHazardRecords.compare_exchange_weak(m_pRecord->pNext, m_pRecord));
+			}
+		}
+
+		~MsvHazardRecordOwner()
+		{
+			if (m_pRecord)
+			{
+				m_pRecord->pHazard.store(nullptr);
+				m_pRecord->active.store(false);
+			}
+		}
+
+		MsvHazardRecord* m_pRecord;
+	};
+
+	/**************************************************************************************************//**
+	* @brief		Returns hazard pointer record of current thread (nullptr when allocation failed).
+	******************************************************************************************************/
+	MsvHazardRecord* GetHazardRecord()
+	{
+		static thread_local MsvHazardRecordOwner owner;
+		return owner.m_pRecord;
+	}
+
+	/**************************************************************************************************//**
+	* @brief		Loads segment and protects it by hazard pointer (it can't be released until hazard is cleared).
+	******************************************************************************************************/
+	template<typename T>
+	T* ProtectPointer(const std::atomic<T*>& pointer, MsvHazardRecord* pRecord)
+	{
+		T* pValue = pointer.load();
+		for (;;)
+		{
+			pRecord->pHazard.store(pValue);
+
+			//check the pointer once again (it could be retired before hazard has been stored)
+			T* pCurrent = pointer.load();
+			if (pCurrent == pValue)
+			{
+				return pValue;
+			}
+			pValue = pCurrent;
+		}
+	}
+}
+
+
+/********************************************************************************************************************************
+*															Static members
+********************************************************************************************************************************/
+
+
+const size_t MsvTaskQueue::MSV_TASK_SEGMENT_SIZE;
+const size_t MsvTaskQueue::MSV_TASK_SEGMENT_RETIRE_LIMIT;
+
+
+/********************************************************************************************************************************
+*															Constructors and destructors
+********************************************************************************************************************************/
+
+
+MsvTaskQueue::MsvTaskSegment::MsvTaskSegment(size_t segmentPosition):
+	position(segmentPosition)
+{
+	enqueuePos.value.store(0, std::memory_order_relaxed);
+	dequeuePos.value.store(0, std::memory_order_relaxed);
+	pNext.store(nullptr, std::memory_order_relaxed);
+	for (size_t i = 0; i < MSV_TASK_SEGMENT_SIZE; ++i)
+	{
+		cells[i].sequence.store(0, std::memory_order_relaxed);
+	}
+}
+
+MsvTaskQueue::MsvTaskQueue(size_t capacity):
+	m_capacity(capacity)
+{
+	m_enqueuePos.value.store(0, std::memory_order_relaxed);
+	m_dequeuePos.value.store(0, std::memory_order_relaxed);
+	m_pTailSegment.value.store(nullptr, std::memory_order_relaxed);
+	m_pHeadSegment.value.store(nullptr, std::memory_order_relaxed);
+
+	if (m_capacity)
+	{
+		//bounded queue -> ring buffer (cell sequence is its position)
+		m_cells.reset(new (std::nothrow) MsvTaskCell[m_capacity]);
+		if (m_cells)
+		{
+			for (size_t i = 0; i < m_capacity; ++i)
+			{
+				m_cells[i].sequence.store(i, std::memory_order_relaxed);
+			}
+		}
+	}
+	else
+	{
+		//unbounded queue -> the first segment
+		MsvTaskSegment* pSegment = new (std::nothrow) MsvTaskSegment(0);
+		m_pTailSegment.value.store(pSegment);
+		m_pHeadSegment.value.store(pSegment);
+	}
+}
+
+MsvTaskQueue::~MsvTaskQueue()
+{
+	//release all linked segments
+	MsvTaskSegment* pSegment = m_pHeadSegment.value.load();
+	while (pSegment)
+	{
+		MsvTaskSegment* pNext = pSegment->pNext.load();
+		delete pSegment;
+		pSegment = pNext;
+	}
+
+	//nobody uses queue -> all retired segments can be released
+	std::vector<MsvTaskSegment*>::iterator endIt = m_retiredSegments.end();
+	for (std::vector<MsvTaskSegment*>::iterator it = m_retiredSegments.begin(); it != endIt; ++it)
+	{
+		delete *it;
+	}
+}
+
+
+/********************************************************************************************************************************
+*															IMsvTaskQueue public methods
+********************************************************************************************************************************/
+
+
+bool MsvTaskQueue::Push(std::shared_ptr<IMsvTask> spTask)
+{
+	return m_capacity ? PushBounded(spTask) : PushUnbounded(spTask);
+}
+
+std::shared_ptr<IMsvTask> MsvTaskQueue::Pop()
+{
+	std::shared_ptr<IMsvTask> spTask;
+	PopBatch(&spTask, 1);
+
+	return spTask;
+}
+
+size_t MsvTaskQueue::PopBatch(std::shared_ptr<IMsvTask>* pTasks, size_t maxCount)
+{
+	return m_capacity ? PopBatchBounded(pTasks, maxCount) : PopBatchUnbounded(pTasks, maxCount);
+}
+
+size_t MsvTaskQueue::GetSize() const
+{
+	size_t dequeued = 0;
+	size_t enqueued = 0;
+
+	if (m_capacity)
+	{
+		//load dequeue position first (enqueue position can't be lower then)
+		dequeued = m_dequeuePos.value.load();
+		enqueued = m_enqueuePos.value.load();
+	}
+	else
+	{
+		MsvHazardRecord* pRecord = GetHazardRecord();
+		if (!pRecord)
+		{
+			return 0;
+		}
+
+		//positions are global (segment position + position in segment)
+		MsvTaskSegment* pSegment = ProtectPointer(m_pHeadSegment.value, pRecord);
+		dequeued = pSegment->position + (std::min)(pSegment->dequeuePos.value.load(), MSV_TASK_SEGMENT_SIZE);
+
+		pSegment = ProtectPointer(m_pTailSegment.value, pRecord);
+		enqueued = pSegment->position + (std::min)(pSegment->enqueuePos.value.load(), MSV_TASK_SEGMENT_SIZE);
+
+		pRecord->pHazard.store(nullptr, std::memory_order_release);
+	}
+
+	return enqueued > dequeued ? enqueued - dequeued : 0;
+}
+
+size_t MsvTaskQueue::GetCapacity() const
+{
+	return m_capacity;
+}
+
+
+/********************************************************************************************************************************
+*															MsvTaskQueue protected methods
+********************************************************************************************************************************/
+
+
+bool MsvTaskQueue::PushBounded(std::shared_ptr<IMsvTask>& spTask)
+{
+	if (!m_cells)
+	{
+		return false;
+	}
+
+	MsvTaskCell* pCell = nullptr;
+	size_t position = m_enqueuePos.value.load(std::memory_order_relaxed);
+	for (;;)
+	{
+		pCell = &m_cells[position % m_capacity];
+		size_t sequence = pCell->sequence.load(std::memory_order_acquire);
+		intptr_t difference = static_cast<intptr_t>(sequence) - static_cast<intptr_t>(position);
+
+		if (difference == 0)
+		{
+			//cell is free -> try to reserve it
+			if (m_enqueuePos.value.compare_exchange_weak(position, position + 1, std::memory_order_relaxed))
+			{
+				break;
+			}
+		}
+		else if (difference < 0)
+		{
+			//cell has not been popped yet (one lap ago) -> queue is full
+			return false;
+		}
+		else
+		{
+			//another producer has already reserved this cell
+			position = m_enqueuePos.value.load(std::memory_order_relaxed);
+		}
+	}
+
+	pCell->spTask = std::move(spTask);
+	pCell->sequence.store(position + 1, std::memory_order_release);
+
+	return true;
+}
+
+bool MsvTaskQueue::PushUnbounded(std::shared_ptr<IMsvTask>& spTask)
+{
+	MsvHazardRecord* pRecord = GetHazardRecord();
+	if (!pRecord || !m_pTailSegment.value.load(std::memory_order_relaxed))
+	{
+		return false;
+	}
+
+	for (;;)
+	{
+		MsvTaskSegment* pSegment = ProtectPointer(m_pTailSegment.value, pRecord);
+		size_t position = pSegment->enqueuePos.value.load(std::memory_order_relaxed);
+
+		if (position < MSV_TASK_SEGMENT_SIZE)
+		{
+			//segment is not full -> try to reserve cell
+			if (pSegment->enqueuePos.value.compare_exchange_weak(position, position + 1, std::memory_order_relaxed))
+			{
+				MsvTaskCell& cell = pSegment->cells[position];
+				cell.spTask = std::move(spTask);
+				cell.sequence.store(1, std::memory_order_release);
+
+				pRecord->pHazard.store(nullptr, std::memory_order_release);
+				return true;
+			}
+			continue;
+		}
+
+		//segment is full -> link next segment (or help who has already linked it)
+		MsvTaskSegment* pNext = pSegment->pNext.load(std::memory_order_acquire);
+		if (!pNext)
+		{
+			MsvTaskSegment* pNewSegment = new (std::nothrow) MsvTaskSegment(pSegment->position + MSV_TASK_SEGMENT_SIZE);
+			if (!pNewSegment)
+			{
+				pRecord->pHazard.store(nullptr, std::memory_order_release);
+				return false;
+			}
+
+			if (pSegment->pNext.compare_exchange_strong(pNext, pNewSegment))
+			{
+				pNext = pNewSegment;
+			}
+			else
+			{
+				//another producer was faster (pNext has been loaded by compare_exchange_strong)
+				delete pNewSegment;
+			}
+		}
+
+		m_pTailSegment.value.compare_exchange_strong(pSegment, pNext);
+	}
+}
+
+size_t MsvTaskQueue::PopBatchBounded(std::shared_ptr<IMsvTask>* pTasks, size_t maxCount)
+{
+	if (!m_cells || !maxCount)
+	{
+		return 0;
+	}
+
+	size_t count = 0;
+	size_t position = m_dequeuePos.value.load(std::memory_order_relaxed);
+	for (;;)
+	{
+		//count written cells (they can't be popped by anyone else until dequeue position moves)
+		for (count = 0; count < maxCount && count < m_capacity; ++count)
+		{
+			size_t sequence = m_cells[(position + count) % m_capacity].sequence.load(std::memory_order_acquire);
+			if (sequence != position + count + 1)
+			{
+				break;
+			}
+		}
+
+		if (count)
+		{
+			//cells are written -> try to reserve all of them at once
+			if (m_dequeuePos.value.compare_exchange_weak(position, position + count, std::memory_order_relaxed))
+			{
+				break;
+			}
+			continue;
+		}
+
+		size_t sequence = m_cells[position % m_capacity].sequence.load(std::memory_order_acquire);
+		intptr_t difference = static_cast<intptr_t>(sequence) - static_cast<intptr_t>(position + 1);
+
+		if (difference < 0)
+		{
+			//cell has not been written yet -> queue is empty
+			return 0;
+		}
+
+		//another consumer has already reserved this cell
+		position = m_dequeuePos.value.load(std::memory_order_relaxed);
+	}
+
+	for (size_t i = 0; i < count; ++i)
+	{
+		MsvTaskCell& cell = m_cells[(position + i) % m_capacity];
+		pTasks[i] = std::move(cell.spTask);
+		//cell will be free for the next lap
+		cell.sequence.store(position + i + m_capacity, std::memory_order_release);
+	}
+
+	return count;
+}
+
+size_t MsvTaskQueue::PopBatchUnbounded(std::shared_ptr<IMsvTask>* pTasks, size_t maxCount)
+{
+	MsvHazardRecord* pRecord = GetHazardRecord();
+	if (!pRecord || !maxCount || !m_pHeadSegment.value.load(std::memory_order_relaxed))
+	{
+		return 0;
+	}
+
+	for (;;)
+	{
+		MsvTaskSegment* pSegment = ProtectPointer(m_pHeadSegment.value, pRecord);
+		size_t position = pSegment->dequeuePos.value.load(std::memory_order_acquire);
+
+		if (position < MSV_TASK_SEGMENT_SIZE)
+		{
+			//count written cells (only in this segment)
+			size_t count = 0;
+			while (count < maxCount && position + count < MSV_TASK_SEGMENT_SIZE && pSegment->cells[position + count].sequence.load(std::memory_order_acquire) != 0)
+			{
+				++count;
+			}
+
+			if (!count)
+			{
+				//cell has not been written yet -> queue is empty (or producer is just writing and will notify)
+				pRecord->pHazard.store(nullptr, std::memory_order_release);
+				return 0;
+			}
+
+			if (pSegment->dequeuePos.value.compare_exchange_weak(position, position + count, std::memory_order_relaxed))
+			{
+				for (size_t i = 0; i < count; ++i)
+				{
+					pTasks[i] = std::move(pSegment->cells[position + i].spTask);
+				}
+
+				pRecord->pHazard.store(nullptr, std::memory_order_release);
+				return count;
+			}
+			continue;
+		}
+
+		//segment is drained -> move to next one (if exists)
+		MsvTaskSegment* pNext = pSegment->pNext.load(std::memory_order_acquire);
+		if (!pNext)
+		{
+			pRecord->pHazard.store(nullptr, std::memory_order_release);
+			return 0;
+		}
+
+		//tail must not point to retired segment -> help producers to move tail
+		MsvTaskSegment* pExpected = pSegment;
+		m_pTailSegment.value.compare_exchange_strong(pExpected, pNext);
+
+		pExpected = pSegment;
+		if (m_pHeadSegment.value.compare_exchange_strong(pExpected, pNext))
+		{
+			//segment is unreachable now -> retire it
+			pRecord->pHazard.store(nullptr, std::memory_order_release);
+			RetireSegment(pSegment);
+		}
+	}
+}
+
+void MsvTaskQueue::RetireSegment(MsvTaskSegment* pSegment)
+{
+	std::lock_guard<std::mutex> lock(m_retiredLock);
+
+	m_retiredSegments.push_back(pSegment);
+	if (m_retiredSegments.size() < MSV_TASK_SEGMENT_RETIRE_LIMIT)
+	{
+		return;
+	}
+
+	//collect all hazard pointers
+	std::vector<void*> hazards;
+	for (MsvHazardRecord* pRecord = g_pHazardRecords.load(); pRecord; pRecord = pRecord->pNext)
+	{
+		void* pHazard = pRecord->pHazard.load();
+		if (pHazard)
+		{
+			hazards.push_back(pHazard);
+		}
+	}
+	std::sort(hazards.begin(), hazards.end());
+
+	//release segments which are not protected by any hazard pointer
+	std::vector<MsvTaskSegment*>::iterator keepIt = m_retiredSegments.begin();
+	std::vector<MsvTaskSegment*>::iterator endIt = m_retiredSegments.end();
+	for (std::vector<MsvTaskSegment*>::iterator it = m_retiredSegments.begin(); it != endIt; ++it)
+	{
+		if (std::binary_search(hazards.begin(), hazards.end(), static_cast<void*>(*it)))
+		{
+			*keepIt++ = *it;
+		}
+		else
+		{
+			delete *it;
+		}
+	}
+	m_retiredSegments.erase(keepIt, endIt);
+}
+
+
+/** @} */	//End of group MTHREADING.
@@ -0,0 +1,220 @@
+/**************************************************************************************************//**
+* @addtogroup	MTHREADING
+* @{
+******************************************************************************************************/
+
+/**************************************************************************************************//**
+* @file
+* @brief			MarsTech Task Queue Implementation
+* @details		Contains implementation @ref MsvTaskQueue of @ref IMsvTaskQueue interface.
+* @author		Martin Svoboda
+* @date			16.10.2026
+* @copyright	GNU General Public License (GPLv3).
+******************************************************************************************************/
+
+
+/*
+This file is part of MarsTech Threading.
+
+MarsTech Dependency Injection is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+MarsTech Promise Like Syntax is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with Foobar. If not, see <https://www.gnu.org/licenses/>.
+*/
+
+
+#ifndef MARSTECH_TASKQUEUE_H
+#define MARSTECH_TASKQUEUE_H
+
+
+#include "IMsvTaskQueue.h"
+#include "MsvCacheLine.h"
+
+MSV_DISABLE_ALL_WARNINGS
+
+#include <atomic>
+#include <mutex>
+#include <vector>
+
+MSV_ENABLE_WARNINGS
+
+
+/**************************************************************************************************//**
+* @brief		MarsTech Task Queue Implementation.
+* @details	Lock-free multi-producer multi-consumer queue of tasks. Bounded queue is a ring buffer of cells
+*				with sequence numbers (Dmitry Vyukov's algorithm). Unbounded queue is a linked list of segments
+*				(each segment is used only once) and drained segments are released by hazard pointers.
+* @note		Push and pop never take any lock (except of rare segment reclamation of unbounded queue).
+* @see		IMsvTaskQueue
+******************************************************************************************************/
+class MsvTaskQueue:
+	public IMsvTaskQueue
+{
+public:
+	/**************************************************************************************************//**
+	* @brief			Constructor.
+	* @param[in]	capacity		Maximal count of tasks in the queue (zero means unbounded queue).
+	******************************************************************************************************/
+	MsvTaskQueue(size_t capacity = 0);
+
+	/**************************************************************************************************//**
+	* @brief		Virtual destructor.
+	* @warning	Queue must not be used by any other thread during destruction.
+	******************************************************************************************************/
+	virtual ~MsvTaskQueue();
+
+	/**************************************************************************************************//**
+	* @copydoc IMsvTaskQueue::Push(std::shared_ptr<IMsvTask> spTask)
+	******************************************************************************************************/
+	virtual bool Push(std::shared_ptr<IMsvTask> spTask) override;
+
+	/**************************************************************************************************//**
+	* @copydoc IMsvTaskQueue::Pop()
+	******************************************************************************************************/
+	virtual std::shared_ptr<IMsvTask> Pop() override;
+
+	/**************************************************************************************************//**
+	* @copydoc IMsvTaskQueue::PopBatch(std::shared_ptr<IMsvTask>* pTasks, size_t maxCount)
+	******************************************************************************************************/
+	virtual size_t PopBatch(std::shared_ptr<IMsvTask>* pTasks, size_t maxCount) override;
+
+	/**************************************************************************************************//**
+	* @copydoc IMsvTaskQueue::GetSize()
+	******************************************************************************************************/
+	virtual size_t GetSize() const override;
+
+	/**************************************************************************************************//**
+	* @copydoc IMsvTaskQueue::GetCapacity()
+	******************************************************************************************************/
+	virtual size_t GetCapacity() const override;
+
+protected:
+	/**************************************************************************************************//**
+	* @brief		Count of cells in one segment of unbounded queue.
+	******************************************************************************************************/
+	static const size_t MSV_TASK_SEGMENT_SIZE = 256;
+
+	/**************************************************************************************************//**
+	* @brief		Count of retired segments which triggers their release.
+	******************************************************************************************************/
+	static const size_t MSV_TASK_SEGMENT_RETIRE_LIMIT = 8;
+
+	/**************************************************************************************************//**
+	* @brief		Queue cell.
+	* @details	Sequence number says if the cell is ready for push or for pop. Bounded queue uses positions
+	*				(see Dmitry Vyukov's bounded MPMC queue), unbounded queue uses 0 (empty) and 1 (written).
+	******************************************************************************************************/
+	struct MsvTaskCell
+	{
+		std::atomic<size_t> sequence;
+		std::shared_ptr<IMsvTask> spTask;
+	};
+
+	/**************************************************************************************************//**
+	* @brief		Unbounded queue segment.
+	* @details	Segment is filled from the first to the last cell and it is never reused. Full segment links
+	*				next one, drained segment is retired (and released when no thread protects it).
+	******************************************************************************************************/
+	struct MsvTaskSegment
+	{
+		MsvTaskSegment(size_t segmentPosition);
+
+		MsvCacheLinePadded<std::atomic<size_t>> enqueuePos;
+		MsvCacheLinePadded<std::atomic<size_t>> dequeuePos;
+		std::atomic<MsvTaskSegment*> pNext;
+		size_t position;
+		MsvTaskCell cells[MSV_TASK_SEGMENT_SIZE];
+	};
+
+	/**************************************************************************************************//**
+	* @brief			Push task to bounded queue.
+	* @copydetails	Push
+	******************************************************************************************************/
+	bool PushBounded(std::shared_ptr<IMsvTask>& spTask);
+
+	/**************************************************************************************************//**
+	* @brief			Push task to unbounded queue.
+	* @copydetails	Push
+	******************************************************************************************************/
+	bool PushUnbounded(std::shared_ptr<IMsvTask>& spTask);
+
+	/**************************************************************************************************//**
+	* @brief			Pop tasks from bounded queue.
+	* @details		Reserves all written cells (at most maxCount) by one compare and exchange.
+	* @copydetails	PopBatch
+	******************************************************************************************************/
+	size_t PopBatchBounded(std::shared_ptr<IMsvTask>* pTasks, size_t maxCount);
+
+	/**************************************************************************************************//**
+	* @brief			Pop tasks from unbounded queue.
+	* @details		Reserves all written cells of head segment (at most maxCount) by one compare and exchange.
+	* @copydetails	PopBatch
+	******************************************************************************************************/
+	size_t PopBatchUnbounded(std::shared_ptr<IMsvTask>* pTasks, size_t maxCount);
+
+	/**************************************************************************************************//**
+	* @brief			Retire drained segment.
+	* @details		Segment is stored to @ref m_retiredSegments and released later (when it is not protected
+	*					by any hazard pointer).
+	* @param[in]	pSegment		Drained segment (it is not reachable from the queue anymore).
+	******************************************************************************************************/
+	void RetireSegment(MsvTaskSegment* pSegment);
+
+protected:
+	/**************************************************************************************************//**
+	* @brief		Queue capacity.
+	* @details	Zero means unbounded queue.
+	******************************************************************************************************/
+	size_t m_capacity;
+
+	/**************************************************************************************************//**
+	* @brief		Cells of bounded queue (ring buffer).
+	******************************************************************************************************/
+	std::unique_ptr<MsvTaskCell[]> m_cells;
+
+	/**************************************************************************************************//**
+	* @brief		Push position of bounded queue.
+	******************************************************************************************************/
+	MsvCacheLinePadded<std::atomic<size_t>> m_enqueuePos;
+
+	/**************************************************************************************************//**
+	* @brief		Pop position of bounded queue.
+	******************************************************************************************************/
+	MsvCacheLinePadded<std::atomic<size_t>> m_dequeuePos;
+
+	/**************************************************************************************************//**
+	* @brief		The last segment of unbounded queue (tasks are pushed to it).
+	******************************************************************************************************/
+	MsvCacheLinePadded<std::atomic<MsvTaskSegment*>> m_pTailSegment;
+
+	/**************************************************************************************************//**
+	* @brief		The first segment of unbounded queue (tasks are popped from it).
+	******************************************************************************************************/
+	MsvCacheLinePadded<std::atomic<MsvTaskSegment*>> m_pHeadSegment;
+
+	/**************************************************************************************************//**
+	* @brief		Retired segments lock.
+	* @details	Locks @ref m_retiredSegments (it is used only when segment is drained).
+	******************************************************************************************************/
+	std::mutex m_retiredLock;
+
+	/**************************************************************************************************//**
+	* @brief		Retired segments.
+	* @details	Drained segments waiting for release.
+	* @see		RetireSegment
+	******************************************************************************************************/
+	std::vector<MsvTaskSegment*> m_retiredSegments;
+};
+
+
+#endif // MARSTECH_TASKQUEUE_H
+
+/** @} */	//End of group MTHREADING.
@@ -0,0 +1,123 @@
+/**************************************************************************************************//**
+* @addtogroup	MTHREADING
+* @{
+******************************************************************************************************/
+
+/**************************************************************************************************//**
+* @file
+* @brief			MarsTech Task Waiter
+* @details		Contains implementation of @ref MsvTaskWaiter.
+* @author		Martin Svoboda
+* @date			17.10.2026
+* @copyright	GNU General Public License (GPLv3).
+******************************************************************************************************/
+
+
+/*
+This file is part of MarsTech Threading.
+
+MarsTech Dependency Injection is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+MarsTech Promise Like Syntax is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with Foobar. If not, see <https://www.gnu.org/licenses/>.
+*/
+
+
+#include "MsvTaskWaiter.h"
+
+#include "MsvEvent.h"
+
+MSV_DISABLE_ALL_WARNINGS
+
+#include <thread>
+
+MSV_ENABLE_WARNINGS
+
+
+/********************************************************************************************************************************
+*															Constructors and destructors
+********************************************************************************************************************************/
+
+
+MsvTaskWaiter::MsvTaskWaiter():
+	m_pending(0),
+	m_spDoneEvent(new (std::nothrow) MsvEvent())
+{
+
+}
+
+MsvTaskWaiter::~MsvTaskWaiter()
+{
+
+}
+
+
+/********************************************************************************************************************************
+*															MsvTaskWaiter public methods
+********************************************************************************************************************************/
+
+
+bool MsvTaskWaiter::IsInitialized() const
+{
+	return m_spDoneEvent != nullptr;
+}
+
+void MsvTaskWaiter::Add(size_t count)
+{
+	m_pending += count;
+}
+
+void MsvTaskWaiter::Done()
+{
+	//owner can be released by waiter right after the last task is counted down -> keep the event
+	std::shared_ptr<IMsvEvent> spDoneEvent(m_spDoneEvent);
+	if (!--m_pending)
+	{
+		spDoneEvent->SetEvent(true);
+	}
+}
+
+void MsvTaskWaiter::Wait(const std::shared_ptr<IMsvThreadPool>& spThreadPool)
+{
+	if (spThreadPool && spThreadPool->IsWorkerThread())
+	{
+		//worker must not block (pending tasks could be queued behind it) -> it helps instead
+		while (m_pending.load())
+		{
+			if (!spThreadPool->TryExecuteTask())
+			{
+				//pending tasks are executed by other workers
+				std::this_thread::yield();
+			}
+		}
+
+		return;
+	}
+
+	while (m_pending.load())
+	{
+		m_spDoneEvent->WaitForEvent();
+
+		//event could be set by the last task of the previous wait -> reset it and check tasks once again
+		if (m_pending.load())
+		{
+			m_spDoneEvent->ResetEvent();
+		}
+	}
+}
+
+size_t MsvTaskWaiter::GetPendingCount() const
+{
+	return m_pending.load();
+}
+
+
+/** @} */	//End of group MTHREADING.
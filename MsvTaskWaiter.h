@@ -0,0 +1,117 @@
+/**************************************************************************************************//**
+* @addtogroup	MTHREADING
+* @{
+******************************************************************************************************/
+
+/**************************************************************************************************//**
+* @file
+* @brief			MarsTech Task Waiter
+* @details		Contains declaration of @ref MsvTaskWaiter.
+* @author		Martin Svoboda
+* @date			17.10.2026
+* @copyright	GNU General Public License (GPLv3).
+******************************************************************************************************/
+
+
+/*
+This file is part of MarsTech Threading.
+
+MarsTech Dependency Injection is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+MarsTech Promise Like Syntax is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with Foobar. If not, see <https://www.gnu.org/licenses/>.
+*/
+
+
+#ifndef MARSTECH_TASKWAITER_H
+#define MARSTECH_TASKWAITER_H
+
+
+#include "IMsvThreadPool.h"
+#include "IMsvEvent.h"
+
+MSV_DISABLE_ALL_WARNINGS
+
+#include <atomic>
+#include <memory>
+
+MSV_ENABLE_WARNINGS
+
+
+/**************************************************************************************************//**
+* @brief		MarsTech Task Waiter.
+* @details	Counter of pending tasks with event which is set when the last task is done. Worker of the thread
+*				pool which waits executes queued tasks instead of blocking (nested parallelism can't deadlock).
+*				Other threads wait for event.
+* @see		MsvTaskGroup
+* @see		MsvTaskGraph
+******************************************************************************************************/
+class MsvTaskWaiter
+{
+public:
+	/**************************************************************************************************//**
+	* @brief		Constructor.
+	******************************************************************************************************/
+	MsvTaskWaiter();
+
+	/**************************************************************************************************//**
+	* @brief		Virtual destructor.
+	******************************************************************************************************/
+	virtual ~MsvTaskWaiter();
+
+	/**************************************************************************************************//**
+	* @brief			Check if waiter has been initialized (event has been allocated).
+	* @returns		bool
+	******************************************************************************************************/
+	virtual bool IsInitialized() const;
+
+	/**************************************************************************************************//**
+	* @brief			Add pending tasks.
+	* @param[in]	count		Count of tasks.
+	* @warning		Tasks must be counted before they can be executed.
+	******************************************************************************************************/
+	virtual void Add(size_t count = 1);
+
+	/**************************************************************************************************//**
+	* @brief			Count down done task.
+	* @details		Sets event when it was the last pending task. Owner of the waiter can be released by
+	*					waiter right after the last task is counted down (event is kept by this method).
+	******************************************************************************************************/
+	virtual void Done();
+
+	/**************************************************************************************************//**
+	* @brief			Wait until all pending tasks are done.
+	* @param[in]	spThreadPool		Thread pool which executes tasks (its worker helps instead of blocking).
+	******************************************************************************************************/
+	virtual void Wait(const std::shared_ptr<IMsvThreadPool>& spThreadPool);
+
+	/**************************************************************************************************//**
+	* @brief			Get count of pending tasks.
+	* @returns		size_t
+	******************************************************************************************************/
+	virtual size_t GetPendingCount() const;
+
+protected:
+	/**************************************************************************************************//**
+	* @brief		Count of pending tasks.
+	******************************************************************************************************/
+	std::atomic<size_t> m_pending;
+
+	/**************************************************************************************************//**
+	* @brief		Event which is set when the last pending task is done.
+	******************************************************************************************************/
+	std::shared_ptr<IMsvEvent> m_spDoneEvent;
+};
+
+
+#endif // MARSTECH_TASKWAITER_H
+
+/** @} */	//End of group MTHREADING.
@@ -51,6 +51,7 @@ MsvThread::MsvThread(std::shared_ptr<std::condition_variable> spConditionVariabl
 	m_spConditionVariable(spConditionVariable ? spConditionVariable : std::shared_ptr<std::condition_variable>(new (std::nothrow) std::condition_variable)),
 	m_spConditionVariableMutex(spConditionVariableMutex ? spConditionVariableMutex : std::shared_ptr<std::mutex>(new (std::nothrow) std::mutex)),
 	m_spConditionVariablePredicate(spConditionVariablePredicate),
+	m_ownSleepSlot(!spConditionVariable && !spConditionVariableMutex && !spConditionVariablePredicate),
 	m_stopRequested(false),
 	m_timeout(0),
 	m_dataReady(false),
@@ -58,6 +59,12 @@ MsvThread::MsvThread(std::shared_ptr<std::condition_variable> spConditionVariabl
 {
 }
 
+MsvThread::MsvThread(std::shared_ptr<MsvIdleWorkerStack> spIdleWorkers):
+	MsvThread(nullptr, nullptr, nullptr)
+{
+	m_spIdleWorkers = spIdleWorkers;
+}
+
 MsvThread::~MsvThread()
 {
 	//stop thread if still running
@@ -84,7 +91,17 @@ bool MsvThread::IsRunning() const
 
 void MsvThread::Notify() const
 {
-	if (m_spConditionVariable)
+	if (m_spIdleWorkers)
+	{
+		//wake up only this thread (other threads sleep in their own slots)
+		m_spIdleWorkers->Signal(m_sleepSlot);
+	}
+	else if (m_ownSleepSlot)
+	{
+		//awake thread -> just flag (no lock, no syscall)
+		m_sleepSlot.Signal();
+	}
+	else if (m_spConditionVariable)
 	{
 		std::unique_lock<std::mutex> conditionLock(*m_spConditionVariableMutex);
 		m_dataReady = true;
@@ -143,7 +160,19 @@ MsvErrorCode MsvThread::StopThread()
 	std::unique_lock<std::mutex> conditionLock(*m_spConditionVariableMutex);
 	m_stopRequested = true;
 	conditionLock.unlock();
-	Notify();
+	if (m_spIdleWorkers)
+	{
+		//thread stops even when it has been signaled meanwhile
+		m_spIdleWorkers->Stop(m_sleepSlot);
+	}
+	else if (m_ownSleepSlot)
+	{
+		m_sleepSlot.Stop();
+	}
+	else
+	{
+		Notify();
+	}
 
 	return MSV_SUCCESS;
 }
@@ -263,6 +292,16 @@ void MsvThread::ThreadMainInner()
 			//thread main method/function
 			ThreadMain();
 		}
+		else if (m_spIdleWorkers)
+		{
+			//thread main method/function -> synchronization by idle worker stack
+			ThreadMainInnerIdleWorkers();
+		}
+		else if (m_ownSleepSlot)
+		{
+			//thread main method/function -> synchronization by this thread sleep slot
+			ThreadMainInnerSleepSlot();
+		}
 		else if (m_spConditionVariablePredicate)
 		{
 			//thread main method/function -> synchronization by shared condition
@@ -283,16 +322,17 @@ void MsvThread::ThreadMainInner()
 		HandleCaughtException(std::current_exception());
 	}
 
+	//set stopped flag first (waiting thread which sees stopped thread joins it -> this object can't be released
+	//until the thread ends)
+	std::unique_lock<std::recursive_mutex> lock(m_lock);
+	m_isRunning = false;
+	lock.unlock();
+
 	//execution is stopped -> notify stop condition
 	std::unique_lock<std::mutex> stopConditionLock(m_stopConditionVariableMutex);
 	m_stopReady = true;
 	stopConditionLock.unlock();
 	m_stopConditionVariable.notify_one();
-
-	//set stopped flag
-	std::unique_lock<std::recursive_mutex> lock(m_lock);
-	m_isRunning = false;
-	lock.unlock();
 }
 
 void MsvThread::ThreadMainInnerDataReadyPredicate()
@@ -382,5 +422,27 @@ void MsvThread::ThreadMainInnerSharedPredicate()
 	//negative timeout means execute once -> do not wait for nothing -> loop ends (see StartThread method)
 }
 
+void MsvThread::ThreadMainInnerIdleWorkers()
+{
+	do
+	{
+		//thread main method/function
+		ThreadMain();
+
+		//zero timeout -> just wait for wake up, positive timeout -> waits for timeout period or wake up
+	} while (m_spIdleWorkers->Wait(m_sleepSlot, m_timeout));
+}
+
+void MsvThread::ThreadMainInnerSleepSlot()
+{
+	do
+	{
+		//thread main method/function
+		ThreadMain();
+
+		//zero timeout -> just wait for notify, positive timeout -> waits for timeout period or notify
+	} while (m_sleepSlot.Wait(m_timeout));
+}
+
 
 /** @} */	//End of group MTHREADING.
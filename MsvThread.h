@@ -36,6 +36,7 @@ along with Foobar. If not, see <https://www.gnu.org/licenses/>.
 
 
 #include "IMsvThread.h"
+#include "MsvIdleWorkerStack.h"
 
 MSV_DISABLE_ALL_WARNINGS
 
@@ -59,6 +60,8 @@ class MsvThread:
 public:
 	/**************************************************************************************************//**
 	* @brief			Constructor.
+	* @details		Thread waits in its own sleep slot @ref m_sleepSlot (@ref Notify of awake thread does not
+	*					lock anything and it does not call any syscall).
 	******************************************************************************************************/
 	MsvThread();
 
@@ -70,6 +73,8 @@ public:
 	* @param[in]	spConditionVariablePredicate	Shared condition variable predicate.
 	* @warning		Use this constructor only for threads with shared condition variable. In most cases
 	*					you will need default constructor @ref MsvThread().
+	* @note			Thread waits in its own sleep slot when all parameters are null (the same as default
+	*					constructor).
 	* @warning		@ref Notify will notify all threads with shared condition variable.
 	* @warning		If spConditionVariablePredicate is not null, notification must be done outside
 	*					of this class. Notify might not work properly.
@@ -77,6 +82,17 @@ public:
 	******************************************************************************************************/
 	MsvThread(std::shared_ptr<std::condition_variable> spConditionVariable, std::shared_ptr<std::mutex> spConditionVariableMutex, std::shared_ptr<uint64_t> spConditionVariablePredicate);
 
+	/**************************************************************************************************//**
+	* @brief			Constructor.
+	* @details		Constructs @ref MsvThread with shared idle worker stack. Thread waits in its own sleep slot
+	*					(it replaces shared condition variable with shared predicate), so each wake up of the stack
+	*					wakes exactly one idle thread.
+	* @param[in]	spIdleWorkers		Shared idle worker stack.
+	* @note			@ref Notify wakes up only this thread.
+	* @see			m_spIdleWorkers
+	******************************************************************************************************/
+	MsvThread(std::shared_ptr<MsvIdleWorkerStack> spIdleWorkers);
+
 	/**************************************************************************************************//**
 	* @brief		Virtual destructor.
 	******************************************************************************************************/
@@ -199,6 +215,26 @@ private:
 	******************************************************************************************************/
 	void ThreadMainInnerSharedPredicate();
 
+	/**************************************************************************************************//**
+	* @brief			Inner thread main for idle worker stack.
+	* @details		It is called from @ref ThreadMainInner when idle worker stack exists. Thread waits in its
+	*					sleep slot @ref m_sleepSlot.
+	* @warning		Do not change its implementation.
+	* @see			ThreadMainInner
+	* @see			m_spIdleWorkers
+	******************************************************************************************************/
+	void ThreadMainInnerIdleWorkers();
+
+	/**************************************************************************************************//**
+	* @brief			Inner thread main for own sleep slot.
+	* @details		It is called from @ref ThreadMainInner when thread has no shared condition variable. Thread
+	*					waits in its sleep slot @ref m_sleepSlot.
+	* @warning		Do not change its implementation.
+	* @see			ThreadMainInner
+	* @see			m_ownSleepSlot
+	******************************************************************************************************/
+	void ThreadMainInnerSleepSlot();
+
 protected:
 	/**************************************************************************************************//**
 	* @brief		Condition variable mutex.
@@ -253,6 +289,27 @@ protected:
 	******************************************************************************************************/
 	std::shared_ptr<uint64_t> m_spConditionVariablePredicate;
 
+	/**************************************************************************************************//**
+	* @brief		Shared idle worker stack.
+	* @details	Thread waits in @ref m_sleepSlot instead of condition variable when it exists.
+	* @see		MsvThread(std::shared_ptr<MsvIdleWorkerStack> spIdleWorkers)
+	******************************************************************************************************/
+	std::shared_ptr<MsvIdleWorkerStack> m_spIdleWorkers;
+
+	/**************************************************************************************************//**
+	* @brief		Sleep slot of this thread.
+	* @details	It is used with idle worker stack @ref m_spIdleWorkers or when thread has no shared
+	*				condition variable (@ref m_ownSleepSlot).
+	******************************************************************************************************/
+	mutable MsvSleepSlot m_sleepSlot;
+
+	/**************************************************************************************************//**
+	* @brief		Flag if thread waits in its own sleep slot (true) or in condition variable (false).
+	* @details	It is set when thread has been constructed without shared condition variable.
+	* @see		m_sleepSlot
+	******************************************************************************************************/
+	bool m_ownSleepSlot;
+
 	/**************************************************************************************************//**
 	* @brief		Stop condition variable.
 	* @details	It is used to wait for thread stop timeout waiting (@ref WaitForThreadStop).
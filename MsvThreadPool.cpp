@@ -34,28 +34,139 @@ along with Foobar. If not, see <https://www.gnu.org/licenses/>.
 #include "MsvThreadPool.h"
 #include "MsvThreadPool_Factory.h"
 
+#include "MsvCpuPause.h"
+#include "MsvThreadingErrorCodes.h"
 #include "merror/MsvErrorCodes.h"
 
+MSV_DISABLE_ALL_WARNINGS
+
+#include <thread>
+#include <chrono>
+#include <algorithm>
+
+MSV_ENABLE_WARNINGS
+
+
+/********************************************************************************************************************************
+*															Worker context
+********************************************************************************************************************************/
+
+
+namespace
+{
+	/**************************************************************************************************//**
+	* @brief		Worker context.
+	* @details	Identifies thread pool and worker which runs in current thread (tasks added by worker are
+	*				pushed to its deque in work stealing mode).
+	******************************************************************************************************/
+	struct MsvWorkerContext
+	{
+		const MsvThreadPool* pThreadPool;
+		size_t workerIndex;
+		uint32_t randomState;
+		size_t blockingDepth;
+	};
+
+	/**************************************************************************************************//**
+	* @brief		Worker context of current thread (pThreadPool is nullptr when thread is not worker).
+	******************************************************************************************************/
+	thread_local MsvWorkerContext g_workerContext = { nullptr, 0, 0, 0 };
+
+	/**************************************************************************************************//**
+	* @brief		Returns next pseudo-random number of current thread (xorshift).
+	******************************************************************************************************/
+	uint32_t GetNextRandom()
+	{
+		uint32_t value = g_workerContext.randomState;
+		value ^= value << 13;
+		value ^= value >> 17;
+		value ^= value << 5;
+		g_workerContext.randomState = value;
+
+		return value;
+	}
+
+	/**************************************************************************************************//**
+	* @brief		Returns current steady clock time in microseconds (never 0 - it means "not set").
+	******************************************************************************************************/
+	int64_t GetSteadyMicroseconds()
+	{
+		int64_t now = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+
+		return now ? now : 1;
+	}
+}
+
+
+/********************************************************************************************************************************
+*															Static members
+********************************************************************************************************************************/
+
+
+const size_t MsvThreadPool::MSV_MAX_DEQUEUE_BATCH_SIZE;
+const uint32_t MsvThreadPool::MSV_MAX_IDLE_SPIN_COUNT;
+const uint32_t MsvThreadPool::MSV_QUEUE_FULL_YIELD_COUNT;
+const int64_t MsvThreadPool::MSV_QUEUE_FULL_MAX_BACKOFF;
+const int32_t MsvThreadPool::MSV_TIMER_RESOLUTION;
+const uint32_t MsvThreadPool::MSV_HILL_CLIMBING_MARGIN;
+
 
 /********************************************************************************************************************************
 *                                              Constructors and destructors
 ********************************************************************************************************************************/
 
 
-MsvThreadPool::MsvThreadPool(std::shared_ptr<MsvThreadPool_Factory> spFactory):
+MsvThreadPool::MsvThreadPool(std::shared_ptr<MsvThreadPool_Factory> spFactory, size_t taskQueueCapacity):
 	m_isRunning(false),
-	m_spSharedCondition(new (std::nothrow) std::condition_variable),
-	m_spSharedConditionMutex(new (std::nothrow) std::mutex),
-	m_spSharedConditionPredicate(new (std::nothrow) uint64_t(0)),
+	m_spIdleWorkers(new (std::nothrow) MsvIdleWorkerStack()),
 	m_stopRequested(false),
-	m_spFactory(spFactory ? spFactory : MsvThreadPool_Factory::Get())
+	m_spFactory(spFactory ? spFactory : MsvThreadPool_Factory::Get()),
+	m_workStealing(false),
+	m_deadlineScheduling(false),
+	m_dropExpiredTasks(false),
+	m_expiredTaskCount(0),
+	m_activeWorkers(0),
+	m_wakingWorkers(0),
+	m_workerCount(0),
+	m_runningWorkers(0),
+	m_minWorkers(0),
+	m_maxWorkers(0),
+	m_keepAlive(60000000),
+	m_growThreshold(1000),
+	m_saturatedSince(0),
+	m_maxCompensatingWorkers(0),
+	m_blockedWorkers(0),
+	m_hillClimbing(false),
+	m_sampleInterval(100000),
+	m_targetWorkers(0),
+	m_lastSampleTime(0),
+	m_lastCompletedTasks(0),
+	m_lastThroughput(0.0),
+	m_climbDirection(1),
+	m_flatSamples(0),
+	m_dequeueBatchSize(1),
+	m_idleSpinCount(0),
+	m_idleYieldCount(0),
+	m_queueFullPolicy(MsvQueueFullPolicy::MSV_QUEUE_FULL_BLOCK),
+	m_queueFullTimeout(0),
+	m_queueFullCount(0),
+	m_timerThreadStarted(false),
+	m_nextPeriodicTaskId(1)
 {
+	if (m_spFactory)
+	{
+		m_spTaskQueue = m_spFactory->GetIMsvPriorityTaskQueue(taskQueueCapacity);
+		m_spDeadlineTaskQueue = m_spFactory->GetIMsvDeadlineTaskQueue(taskQueueCapacity);
+		m_spTimerWheel = m_spFactory->GetIMsvTimerWheel(MSV_TIMER_RESOLUTION);
+	}
 }
 
 MsvThreadPool::~MsvThreadPool()
 {
 	//it is called with default timeout (30s)
 	StopAndWaitForThreadPoolStop();
+
+	ReleaseTaskDeques();
 }
 
 
@@ -64,20 +175,40 @@ MsvThreadPool::~MsvThreadPool()
 ********************************************************************************************************************************/
 
 
-void MsvThreadPool::AddTask(std::shared_ptr<IMsvTask> task)
+MsvErrorCode MsvThreadPool::AddTask(std::shared_ptr<IMsvTask> task)
 {
-	std::lock_guard<std::recursive_mutex> lock(m_lock);
-	m_taskQueue.push(task);
+	return PushTasks(&task, 1, MsvTaskPriority::MSV_TASK_PRIORITY_NORMAL);
+}
+
+MsvErrorCode MsvThreadPool::AddTask(std::function<void()>& task)
+{
+	return AddTask(task, MsvTaskPriority::MSV_TASK_PRIORITY_NORMAL);
+}
+
+MsvErrorCode MsvThreadPool::AddTask(std::function<void(void*)>& task, void* pContext)
+{
+	//create task
+	std::shared_ptr<IMsvTask> spTask;
+	if (m_spFactory)
+	{
+		spTask = m_spFactory->GetIMsvTask(task, pContext);
+	}
+
+	//add task to queue
+	if (spTask)
+	{
+		return PushTasks(&spTask, 1, MsvTaskPriority::MSV_TASK_PRIORITY_NORMAL);
+	}
 
-	std::unique_lock<std::mutex> conditionLock(*m_spSharedConditionMutex);
-	//++ because of m_spSharedCondition->notify_one() -> one thread is woken up -> one thread will check task queue
-	(*m_spSharedConditionPredicate)++;
-	conditionLock.unlock();
+	return MSV_ALLOCATION_ERROR;
+}
 
-	m_spSharedCondition->notify_one();
+MsvErrorCode MsvThreadPool::AddTask(std::shared_ptr<IMsvTask> spTask, MsvTaskPriority priority)
+{
+	return PushTasks(&spTask, 1, priority);
 }
 
-MsvErrorCode MsvThreadPool::AddTask(std::function<void()>& task)
+MsvErrorCode MsvThreadPool::AddTask(std::function<void()>& task, MsvTaskPriority priority)
 {
 	//create task
 	std::shared_ptr<IMsvTask> spTask;
@@ -89,35 +220,197 @@ MsvErrorCode MsvThreadPool::AddTask(std::function<void()>& task)
 	//add task to queue
 	if (spTask)
 	{
-		AddTask(spTask);
+		return PushTasks(&spTask, 1, priority);
+	}
+
+	return MSV_ALLOCATION_ERROR;
+}
+
+MsvErrorCode MsvThreadPool::AddTask(std::shared_ptr<IMsvTask> spTask, std::chrono::steady_clock::time_point deadline)
+{
+	if (!m_deadlineScheduling)
+	{
+		//deadline is ignored
+		return PushTasks(&spTask, 1, MsvTaskPriority::MSV_TASK_PRIORITY_NORMAL);
 	}
-	else
+
+	if (!spTask)
+	{
+		//nullptr task can't be executed -> skip it
+		return MSV_SUCCESS;
+	}
+
+	if (!m_spDeadlineTaskQueue)
 	{
 		return MSV_ALLOCATION_ERROR;
 	}
 
+	if (!m_spDeadlineTaskQueue->Push(spTask, deadline))
+	{
+		//full queue -> the same queue full policy as tasks without deadline
+		bool queued = false;
+		MSV_RETURN_FAILED(PushDeadlineTaskToFullQueue(spTask, deadline, queued));
+
+		if (!queued)
+		{
+			//task has been executed by caller
+			return MSV_SUCCESS;
+		}
+	}
+
+	WakeIdleWorkers(1);
+
 	return MSV_SUCCESS;
 }
 
-MsvErrorCode MsvThreadPool::AddTask(std::function<void(void*)>& task, void* pContext)
+MsvErrorCode MsvThreadPool::AddTask(std::function<void()>& task, std::chrono::steady_clock::time_point deadline)
 {
 	//create task
 	std::shared_ptr<IMsvTask> spTask;
 	if (m_spFactory)
 	{
-		spTask = m_spFactory->GetIMsvTask(task, pContext);
+		spTask = m_spFactory->GetIMsvTask(task);
 	}
 
 	//add task to queue
 	if (spTask)
 	{
-		AddTask(spTask);
+		return AddTask(spTask, deadline);
+	}
+
+	return MSV_ALLOCATION_ERROR;
+}
+
+MsvErrorCode MsvThreadPool::AddTasks(const std::shared_ptr<IMsvTask>* pTasks, size_t count)
+{
+	return PushTasks(pTasks, count, MsvTaskPriority::MSV_TASK_PRIORITY_NORMAL);
+}
+
+MsvErrorCode MsvThreadPool::AddDelayedTask(std::shared_ptr<IMsvTask> spTask, std::chrono::microseconds delay, uint64_t* pTimerId)
+{
+	if (!spTask)
+	{
+		//nullptr task can't be executed -> skip it
+		return MSV_SUCCESS;
+	}
+
+	if (!m_spTimerWheel)
+	{
+		return MSV_ALLOCATION_ERROR;
+	}
+
+	uint64_t timerId = 0;
+	if (!m_spTimerWheel->AddTimer(spTask, std::chrono::steady_clock::now() + delay, timerId))
+	{
+		return MSV_ALLOCATION_ERROR;
+	}
+
+	if (pTimerId)
+	{
+		*pTimerId = timerId;
+	}
+
+	//timer thread is started with the first delayed task (timer is pending when it fails)
+	if (!m_timerThreadStarted.load(std::memory_order_acquire))
+	{
+		MSV_RETURN_FAILED(StartTimerThread());
+	}
+
+	return MSV_SUCCESS;
+}
+
+MsvErrorCode MsvThreadPool::CancelDelayedTask(uint64_t timerId)
+{
+	if (!m_spTimerWheel)
+	{
+		return MSV_NOT_INITIALIZED_ERROR;
+	}
+
+	return m_spTimerWheel->CancelTimer(timerId) ? MSV_SUCCESS : MSV_NOT_PENDING_INFO;
+}
+
+MsvErrorCode MsvThreadPool::AddPeriodicTask(std::shared_ptr<IMsvTask> spTask, std::chrono::microseconds period, MsvPeriodicMode mode, MsvMissedTickPolicy missedTickPolicy, uint64_t* pPeriodicTaskId)
+{
+	if (!spTask)
+	{
+		//nullptr task can't be executed -> skip it
+		return MSV_SUCCESS;
+	}
+
+	if (period.count() <= 0)
+	{
+		return MSV_INVALID_DATA_ERROR;
+	}
+
+	if (!m_spTimerWheel)
+	{
+		return MSV_ALLOCATION_ERROR;
 	}
-	else
+
+	std::shared_ptr<MsvPeriodicTask> spPeriodicTask(new (std::nothrow) MsvPeriodicTask(spTask, period, mode, missedTickPolicy, m_spTimerWheel));
+	if (!spPeriodicTask)
 	{
 		return MSV_ALLOCATION_ERROR;
 	}
 
+	uint64_t periodicTaskId = m_nextPeriodicTaskId++;
+
+	{
+		std::lock_guard<std::mutex> lock(m_periodicTaskLock);
+
+		try
+		{
+			m_periodicTasks[periodicTaskId] = spPeriodicTask;
+		}
+		catch (...)
+		{
+			//allocation failed
+			return MSV_ALLOCATION_ERROR;
+		}
+	}
+
+	MsvErrorCode errorCode = spPeriodicTask->Start(std::chrono::steady_clock::now() + period);
+	if (MSV_FAILED(errorCode))
+	{
+		std::lock_guard<std::mutex> lock(m_periodicTaskLock);
+		m_periodicTasks.erase(periodicTaskId);
+
+		return errorCode;
+	}
+
+	if (pPeriodicTaskId)
+	{
+		*pPeriodicTaskId = periodicTaskId;
+	}
+
+	//timer thread is started with the first delayed (or periodic) task
+	if (!m_timerThreadStarted.load(std::memory_order_acquire))
+	{
+		MSV_RETURN_FAILED(StartTimerThread());
+	}
+
+	return MSV_SUCCESS;
+}
+
+MsvErrorCode MsvThreadPool::CancelPeriodicTask(uint64_t periodicTaskId)
+{
+	std::shared_ptr<MsvPeriodicTask> spPeriodicTask;
+
+	{
+		std::lock_guard<std::mutex> lock(m_periodicTaskLock);
+
+		std::map<uint64_t, std::shared_ptr<MsvPeriodicTask>>::iterator it = m_periodicTasks.find(periodicTaskId);
+		if (it == m_periodicTasks.end())
+		{
+			return MSV_NOT_PENDING_INFO;
+		}
+
+		spPeriodicTask = it->second;
+		m_periodicTasks.erase(it);
+	}
+
+	spPeriodicTask->Cancel();
+
 	return MSV_SUCCESS;
 }
 
@@ -136,44 +429,118 @@ MsvErrorCode MsvThreadPool::StartThreadPool(uint16_t threadCount)
 		return MSV_ALREADY_RUNNING_INFO;
 	}
 
-	if (!m_spSharedCondition || !m_spSharedConditionMutex || !m_spSharedConditionPredicate)
+	if (!m_spIdleWorkers || !m_spTaskQueue)
 	{
 		return MSV_ALLOCATION_ERROR;
 	}
 
-	//create workers
-	for (int i = 0; i < threadCount; ++i)
+	//elastic thread pool has slots for maximal count of workers (started workers are clamped to bounds)
+	size_t workerCapacity = threadCount;
+	size_t initialWorkers = threadCount;
+	if (m_maxWorkers)
+	{
+		workerCapacity = m_maxWorkers;
+		initialWorkers = (std::min)((std::max)(threadCount, m_minWorkers), m_maxWorkers);
+	}
+
+	//compensating workers have their own slots (elastic thread pool starts them on demand, they wait otherwise)
+	size_t targetWorkers = m_hillClimbing ? (std::max)(initialWorkers, static_cast<size_t>(1)) : workerCapacity;
+	workerCapacity += m_maxCompensatingWorkers;
+	if (!m_maxWorkers)
+	{
+		initialWorkers += m_maxCompensatingWorkers;
+	}
+
+	if (m_maxWorkers)
 	{
-		std::shared_ptr<IMsvUniqueWorker> spWorkerThread(m_spFactory->GetIMsvUniqueWorker(m_spSharedCondition, m_spSharedConditionMutex, m_spSharedConditionPredicate));
-		if (!spWorkerThread)
+		m_workerIdleSince.reset(new (std::nothrow) MsvCacheLinePadded<std::atomic<int64_t>>[workerCapacity]());
+		if (!m_workerIdleSince)
+		{
+			return MSV_ALLOCATION_ERROR;
+		}
+	}
+
+	//hill climbing starts with all started workers (throughput of each worker is counted separately)
+	if (m_hillClimbing)
+	{
+		m_completedTasks.reset(new (std::nothrow) MsvCacheLinePadded<std::atomic<uint64_t>>[workerCapacity]());
+		if (!m_completedTasks)
 		{
-			m_workers.clear();
 			return MSV_ALLOCATION_ERROR;
 		}
+	}
+	m_targetWorkers.store(targetWorkers);
+	m_lastSampleTime = 0;
+	m_lastCompletedTasks = 0;
+	m_lastThroughput = 0.0;
+	m_climbDirection = 1;
+	m_flatSamples = 0;
+
+	//create worker deques (tasks which were not executed by previous run are released)
+	ReleaseTaskDeques();
+	if (m_workStealing)
+	{
+		for (size_t i = 0; i < workerCapacity; ++i)
+		{
+			std::unique_ptr<MsvTaskDeque> spTaskDeque(new (std::nothrow) MsvTaskDeque());
+			if (!spTaskDeque)
+			{
+				m_taskDeques.clear();
+				return MSV_ALLOCATION_ERROR;
+			}
 
-		m_workers.push_back(spWorkerThread);
+			m_taskDeques.push_back(std::move(spTaskDeque));
+		}
 	}
+	m_activeWorkers.store(0);
+	m_wakingWorkers.store(0);
+	m_saturatedSince.store(0);
+	m_blockedWorkers.store(0);
 
-	MsvErrorCode errorCode = MSV_SUCCESS;
+	//create workers (workers of previous run have been stopped)
+	m_workers.assign(workerCapacity, nullptr);
+	m_retiringWorkers.assign(workerCapacity, false);
+	for (size_t i = 0; i < initialWorkers; ++i)
+	{
+		m_workers[i] = m_spFactory->GetIMsvUniqueWorker(m_spIdleWorkers);
+		if (!m_workers[i])
+		{
+			m_workers.clear();
+			return MSV_ALLOCATION_ERROR;
+		}
+	}
 
-	//create callback for workers
-	std::function<void()> callback = std::bind(&MsvThreadPool::ExecuteTask, this);
+	//workers must be counted before start (tasks added during start wake them up)
+	m_workerCount.store(workerCapacity);
+	m_runningWorkers.store(initialWorkers);
+
+	MsvErrorCode errorCode = MSV_SUCCESS;
 
 	//start workers
-	std::vector<std::shared_ptr<IMsvUniqueWorker>>::iterator endIt = m_workers.end();
-	for (std::vector<std::shared_ptr<IMsvUniqueWorker>>::iterator it = m_workers.begin(); it != endIt; ++it)
+	for (size_t workerIndex = 0; workerIndex < initialWorkers; ++workerIndex)
 	{
+		//create callback for worker (worker index identifies its deque)
+		std::function<void()> callback = std::bind(&MsvThreadPool::ExecuteTask, this, workerIndex);
+
 		//execute and wait for notify thread mode
-		if (MSV_FAILED(errorCode = (*it)->SetTask(callback)) || MSV_FAILED(errorCode = (*it)->StartThread()))
+		if (MSV_FAILED(errorCode = m_workers[workerIndex]->SetTask(callback)) || MSV_FAILED(errorCode = m_workers[workerIndex]->StartThread()))
 		{
 			//stop all threads and return errorcode
 			m_workers.clear();
+			m_workerCount.store(0);
+			m_runningWorkers.store(0);
 			return errorCode;
 		}
 	}
 
 	m_isRunning = true;
 
+	//delayed tasks added before start (timer thread adjusts worker count in elastic mode and hill climbing)
+	if (m_maxWorkers || m_hillClimbing || (m_spTimerWheel && m_spTimerWheel->GetSize()))
+	{
+		errorCode = StartTimerThread();
+	}
+
 	return errorCode;
 }
 
@@ -193,10 +560,23 @@ MsvErrorCode MsvThreadPool::StopThreadPool()
 	m_stopRequested = true;
 
 	MsvErrorCode result = MSV_SUCCESS;
+
+	//stop timer thread first (it pushes tasks to workers)
+	if (m_spTimerWorker)
+	{
+		result = m_spTimerWorker->StopThread();
+	}
+
 	//stop workers
 	std::vector<std::shared_ptr<IMsvUniqueWorker>>::const_iterator endIt = m_workers.end();
 	for (std::vector<std::shared_ptr<IMsvUniqueWorker>>::const_iterator it = m_workers.begin(); it != endIt; ++it)
 	{
+		//slot of retired worker is empty
+		if (!*it)
+		{
+			continue;
+		}
+
 		MsvErrorCode errorCode = (*it)->StopThread();
 		if (MSV_FAILED(errorCode))
 		{
@@ -232,54 +612,1153 @@ MsvErrorCode MsvThreadPool::WaitForThreadPoolStop(int32_t timeout)
 	
 	MsvErrorCode result = MSV_SUCCESS;
 
+	//wait for timer thread to stop (pending delayed tasks stay in timer wheel)
+	if (m_spTimerWorker)
+	{
+		result = m_spTimerWorker->WaitForThreadStop(timeout);
+		m_spTimerWorker.reset();
+		m_timerThreadStarted.store(false, std::memory_order_release);
+	}
+
 	//wait for workers to stop
+	bool workersStopped = true;
 	std::vector<std::shared_ptr<IMsvUniqueWorker>>::iterator endIt = m_workers.end();
 	for (std::vector<std::shared_ptr<IMsvUniqueWorker>>::iterator it = m_workers.begin(); it != endIt; ++it)
 	{
+		if (!*it)
+		{
+			continue;
+		}
+
 		MsvErrorCode errorCode = (*it)->WaitForThreadStop(timeout);
 		if (MSV_FAILED(errorCode))
 		{
 			//only last error code of failed wait
 			result = errorCode;
+			workersStopped = false;
 		}
 	}
 
+	//tasks left in worker deques (children of fork join, nodes of task graph) are waited for -> this thread executes them
+	if (workersStopped)
+	{
+		ExecuteDequeTasks();
+	}
+
+	m_workerCount.store(0);
+	m_runningWorkers.store(0);
 	m_isRunning = false;
 
 	return result;
 }
 
+bool MsvThreadPool::IsWorkerThread() const
+{
+	return g_workerContext.pThreadPool == this;
+}
 
-/********************************************************************************************************************************
-*															MsvThread protected methods
-********************************************************************************************************************************/
+bool MsvThreadPool::TryExecuteTask()
+{
+	//the earliest deadline first
+	if (m_deadlineScheduling && ExecuteDeadlineTask())
+	{
+		return true;
+	}
 
+	//worker deques exist only when thread pool is running in work stealing mode
+	size_t workerIndex = 0;
+	bool localDeque = m_workStealing && GetCurrentWorkerIndex(workerIndex) && workerIndex < m_taskDeques.size();
 
-void MsvThreadPool::ExecuteTask()
+	//own deque first (the latest task is hot in cache)
+	IMsvTask* pTask = localDeque ? m_taskDeques[workerIndex]->Pop() : nullptr;
+	if (pTask)
+	{
+		pTask->Execute();
+		CountCompletedTasks(1);
+		return true;
+	}
+
+	//shared queue
+	std::shared_ptr<IMsvTask> spTask = GetTask();
+	if (spTask)
+	{
+		spTask->Execute();
+		CountCompletedTasks(1);
+		return true;
+	}
+
+	//steal task from other workers
+	pTask = localDeque ? StealTask(workerIndex) : nullptr;
+	if (pTask)
+	{
+		pTask->Execute();
+		CountCompletedTasks(1);
+		return true;
+	}
+
+	return false;
+}
+
+bool MsvThreadPool::HasLocalTask() const
 {
-	std::shared_ptr<IMsvTask> spTask;
+	size_t workerIndex = 0;
+	if (m_workStealing && GetCurrentWorkerIndex(workerIndex) && workerIndex < m_taskDeques.size())
+	{
+		return m_taskDeques[workerIndex]->GetSize() != 0;
+	}
 
-	//it might block thread pool stopping (because of many tasks or long time running tasks in the queue)
+	return m_spTaskQueue && m_spTaskQueue->GetSize() != 0;
+}
+
+size_t MsvThreadPool::GetWorkerCount() const
+{
+	return m_workerCount.load(std::memory_order_acquire);
+}
 
-	//execute tasks until exists any task in the queue
-	while ((spTask = GetTask()) != nullptr)
+bool MsvThreadPool::GetCurrentWorkerIndex(size_t& workerIndex) const
+{
+	if (g_workerContext.pThreadPool != this)
 	{
-		spTask->Execute();
+		return false;
 	}
+
+	workerIndex = g_workerContext.workerIndex;
+
+	return true;
 }
 
-std::shared_ptr<IMsvTask> MsvThreadPool::GetTask()
+bool MsvThreadPool::EnterBlockingRegion()
 {
-	std::lock_guard<std::recursive_mutex> lock(m_lock);
-	if (m_taskQueue.empty())
+	if (g_workerContext.pThreadPool != this || !m_maxCompensatingWorkers)
 	{
-		return nullptr;
+		return false;
+	}
+
+	//nested region -> worker is already blocked
+	if (g_workerContext.blockingDepth++)
+	{
+		return true;
+	}
+
+	//blocked worker is not active -> another worker can execute tasks instead of it
+	++m_blockedWorkers;
+	--m_activeWorkers;
+
+	//wake up compensating worker for queued tasks (tasks pushed later wake it up themselves)
+	if (HasQueuedTask())
+	{
+		WakeIdleWorkers(1);
+	}
+
+	return true;
+}
+
+void MsvThreadPool::LeaveBlockingRegion()
+{
+	if (g_workerContext.pThreadPool != this || !g_workerContext.blockingDepth || --g_workerContext.blockingDepth)
+	{
+		return;
 	}
 
-	std::shared_ptr<IMsvTask> spTmpTask = m_taskQueue.front();
-	m_taskQueue.pop();
+	//surplus worker parks itself when it finishes its current task
+	++m_activeWorkers;
+	--m_blockedWorkers;
+}
+
+
+/********************************************************************************************************************************
+*															MsvThreadPool public methods
+********************************************************************************************************************************/
+
 
-	return spTmpTask;
+MsvErrorCode MsvThreadPool::SetWorkStealing(bool workStealing)
+{
+	std::lock_guard<std::recursive_mutex> lock(m_lock);
+
+	if (IsRunning())
+	{
+		return MSV_ALREADY_RUNNING_INFO;
+	}
+
+	m_workStealing = workStealing;
+
+	return MSV_SUCCESS;
+}
+
+MsvErrorCode MsvThreadPool::SetDeadlineScheduling(bool deadlineScheduling)
+{
+	std::lock_guard<std::recursive_mutex> lock(m_lock);
+
+	if (IsRunning())
+	{
+		return MSV_ALREADY_RUNNING_INFO;
+	}
+
+	m_deadlineScheduling = deadlineScheduling;
+
+	return MSV_SUCCESS;
+}
+
+MsvErrorCode MsvThreadPool::SetDropExpiredTasks(bool dropExpiredTasks, std::function<void(std::shared_ptr<IMsvTask>)> expiredTaskCallback)
+{
+	std::lock_guard<std::recursive_mutex> lock(m_lock);
+
+	if (IsRunning())
+	{
+		return MSV_ALREADY_RUNNING_INFO;
+	}
+
+	m_dropExpiredTasks = dropExpiredTasks;
+	m_expiredTaskCallback = expiredTaskCallback;
+
+	return MSV_SUCCESS;
+}
+
+uint64_t MsvThreadPool::GetExpiredTaskCount() const
+{
+	return m_expiredTaskCount.load(std::memory_order_relaxed);
+}
+
+MsvErrorCode MsvThreadPool::SetQueueFullPolicy(MsvQueueFullPolicy policy, int32_t timeout)
+{
+	m_queueFullPolicy.store(policy, std::memory_order_relaxed);
+	m_queueFullTimeout.store(timeout, std::memory_order_relaxed);
+
+	return MSV_SUCCESS;
+}
+
+uint64_t MsvThreadPool::GetQueueFullCount() const
+{
+	return m_queueFullCount.load(std::memory_order_relaxed);
+}
+
+MsvErrorCode MsvThreadPool::SetPriorityPolicy(MsvPriorityPolicy policy)
+{
+	std::lock_guard<std::recursive_mutex> lock(m_lock);
+
+	if (IsRunning())
+	{
+		return MSV_ALREADY_RUNNING_INFO;
+	}
+
+	if (!m_spTaskQueue)
+	{
+		return MSV_NOT_INITIALIZED_ERROR;
+	}
+
+	return m_spTaskQueue->SetPriorityPolicy(policy);
+}
+
+MsvErrorCode MsvThreadPool::SetPriorityWeights(uint32_t highWeight, uint32_t normalWeight, uint32_t lowWeight)
+{
+	std::lock_guard<std::recursive_mutex> lock(m_lock);
+
+	if (IsRunning())
+	{
+		return MSV_ALREADY_RUNNING_INFO;
+	}
+
+	if (!m_spTaskQueue)
+	{
+		return MSV_NOT_INITIALIZED_ERROR;
+	}
+
+	return m_spTaskQueue->SetPriorityWeights(highWeight, normalWeight, lowWeight);
+}
+
+MsvErrorCode MsvThreadPool::SetPriorityAging(uint32_t agingThreshold)
+{
+	if (!m_spTaskQueue)
+	{
+		return MSV_NOT_INITIALIZED_ERROR;
+	}
+
+	return m_spTaskQueue->SetPriorityAging(agingThreshold);
+}
+
+size_t MsvThreadPool::GetDelayedTaskCount() const
+{
+	return m_spTimerWheel ? m_spTimerWheel->GetSize() : 0;
+}
+
+MsvErrorCode MsvThreadPool::SetElasticWorkers(uint16_t minWorkers, uint16_t maxWorkers, int32_t keepAlive, int32_t growThreshold)
+{
+	std::lock_guard<std::recursive_mutex> lock(m_lock);
+
+	if (IsRunning())
+	{
+		return MSV_ALREADY_RUNNING_INFO;
+	}
+
+	if (maxWorkers && minWorkers > maxWorkers)
+	{
+		return MSV_INVALID_DATA_ERROR;
+	}
+
+	m_minWorkers = minWorkers;
+	m_maxWorkers = maxWorkers;
+	m_keepAlive = keepAlive;
+	m_growThreshold = growThreshold;
+
+	return MSV_SUCCESS;
+}
+
+size_t MsvThreadPool::GetRunningWorkerCount() const
+{
+	return m_runningWorkers.load();
+}
+
+MsvErrorCode MsvThreadPool::SetHillClimbing(bool hillClimbing, int32_t sampleInterval)
+{
+	std::lock_guard<std::recursive_mutex> lock(m_lock);
+
+	if (IsRunning())
+	{
+		return MSV_ALREADY_RUNNING_INFO;
+	}
+
+	m_hillClimbing = hillClimbing;
+	m_sampleInterval = sampleInterval;
+
+	return MSV_SUCCESS;
+}
+
+size_t MsvThreadPool::GetTargetWorkerCount() const
+{
+	return m_targetWorkers.load();
+}
+
+MsvErrorCode MsvThreadPool::SetCompensatingWorkers(uint16_t maxCompensatingWorkers)
+{
+	std::lock_guard<std::recursive_mutex> lock(m_lock);
+
+	if (IsRunning())
+	{
+		return MSV_ALREADY_RUNNING_INFO;
+	}
+
+	m_maxCompensatingWorkers = maxCompensatingWorkers;
+
+	return MSV_SUCCESS;
+}
+
+MsvErrorCode MsvThreadPool::SetDequeueBatchSize(size_t batchSize)
+{
+	//workers read it without lock (it is only a hint)
+	m_dequeueBatchSize.store((std::max)(static_cast<size_t>(1), (std::min)(batchSize, MSV_MAX_DEQUEUE_BATCH_SIZE)), std::memory_order_relaxed);
+
+	return MSV_SUCCESS;
+}
+
+MsvErrorCode MsvThreadPool::SetIdleStrategy(uint32_t spinCount, uint32_t yieldCount)
+{
+	//workers read it without lock (it is only a hint)
+	m_idleSpinCount.store((std::min)(spinCount, MSV_MAX_IDLE_SPIN_COUNT), std::memory_order_relaxed);
+	m_idleYieldCount.store((std::min)(yieldCount, MSV_MAX_IDLE_SPIN_COUNT), std::memory_order_relaxed);
+
+	return MSV_SUCCESS;
+}
+
+
+/********************************************************************************************************************************
+*															MsvThread protected methods
+********************************************************************************************************************************/
+
+
+void MsvThreadPool::ExecuteTask(size_t workerIndex)
+{
+	if (g_workerContext.pThreadPool != this)
+	{
+		//the first execution in this thread -> set worker context (seed can't be zero)
+		g_workerContext.pThreadPool = this;
+		g_workerContext.workerIndex = workerIndex;
+		g_workerContext.randomState = static_cast<uint32_t>(workerIndex) * 2654435761u + 1;
+	}
+
+	//worker has been woken up (or started) -> it is not waking anymore
+	size_t wakingWorkers = m_wakingWorkers.load();
+	while (wakingWorkers && !m_wakingWorkers.compare_exchange_weak(wakingWorkers, wakingWorkers - 1));
+
+	++m_activeWorkers;
+
+	if (m_maxWorkers)
+	{
+		m_workerIdleSince[workerIndex].value.store(0, std::memory_order_relaxed);
+	}
+
+	for (;;)
+	{
+		//it might block thread pool stopping (because of many tasks or long time running tasks in the queue)
+		bool parked = false;
+		if (m_workStealing)
+		{
+			parked = ExecuteTaskWorkStealing(workerIndex);
+		}
+		else
+		{
+			//execute tasks until exists any task in the queue (or until the worker is parked)
+			while (!(parked = TryParkWorker()) && ExecuteTaskBatch());
+		}
+
+		if (parked)
+		{
+			//worker over target of hill climbing -> it waits like idle worker (but tasks still wait for workers)
+			if (m_maxWorkers)
+			{
+				m_workerIdleSince[workerIndex].value.store(GetSteadyMicroseconds(), std::memory_order_relaxed);
+			}
+
+			return;
+		}
+
+		//worker is still active while it spins -> task added meanwhile does not wake up anybody
+		if (SpinForTask())
+		{
+			continue;
+		}
+
+		//there is no task -> worker goes idle, but check queues once again (task could be pushed before the worker
+		//was counted as idle and nobody woke it up -> seq_cst decrement pairs with seq_cst fence in WakeIdleWorkers)
+		--m_activeWorkers;
+		if (!HasQueuedTask())
+		{
+			if (m_maxWorkers)
+			{
+				//idle worker -> tasks do not wait for workers (keep-alive of this worker starts)
+				m_workerIdleSince[workerIndex].value.store(GetSteadyMicroseconds(), std::memory_order_relaxed);
+				m_saturatedSince.store(0, std::memory_order_relaxed);
+			}
+
+			return;
+		}
+		++m_activeWorkers;
+	}
+}
+
+bool MsvThreadPool::ExecuteTaskWorkStealing(size_t workerIndex)
+{
+	MsvTaskDeque* pTaskDeque = m_taskDeques[workerIndex].get();
+
+	for (;;)
+	{
+		//tasks of parked worker deque are stolen by active workers
+		if (TryParkWorker())
+		{
+			return true;
+		}
+
+		//task with deadline can't wait for the whole deque
+		if (m_deadlineScheduling && ExecuteDeadlineTask())
+		{
+			continue;
+		}
+
+		//own deque first (the latest task is hot in cache)
+		IMsvTask* pTask = pTaskDeque->Pop();
+		if (pTask)
+		{
+			pTask->Execute();
+			CountCompletedTasks(1);
+			continue;
+		}
+
+		//shared queue (tasks added by other threads)
+		if (ExecuteTaskBatch())
+		{
+			continue;
+		}
+
+		//steal task from other workers
+		pTask = StealTask(workerIndex);
+		if (pTask)
+		{
+			pTask->Execute();
+			CountCompletedTasks(1);
+			continue;
+		}
+
+		return false;
+	}
+}
+
+bool MsvThreadPool::SpinForTask() const
+{
+	//spin -> the fastest reaction (CPU pause saves power and frees pipeline for the other hyper-thread)
+	uint32_t spinCount = m_idleSpinCount.load(std::memory_order_relaxed);
+	for (uint32_t i = 0; i < spinCount; ++i)
+	{
+		MsvCpuPause();
+		if (HasQueuedTask())
+		{
+			return true;
+		}
+	}
+
+	//yield -> other threads can run (but worker is not parked)
+	uint32_t yieldCount = m_idleYieldCount.load(std::memory_order_relaxed);
+	for (uint32_t i = 0; i < yieldCount; ++i)
+	{
+		std::this_thread::yield();
+		if (HasQueuedTask())
+		{
+			return true;
+		}
+	}
+
+	return false;
+}
+
+bool MsvThreadPool::TryParkWorker()
+{
+	if (!m_hillClimbing && !m_maxCompensatingWorkers)
+	{
+		return false;
+	}
+
+	//only one worker parks for each surplus worker (the rest of them continue), blocked workers are not active already
+	size_t activeWorkers = m_activeWorkers.load(std::memory_order_relaxed);
+	while (activeWorkers > m_targetWorkers.load(std::memory_order_relaxed))
+	{
+		if (m_activeWorkers.compare_exchange_weak(activeWorkers, activeWorkers - 1))
+		{
+			return true;
+		}
+	}
+
+	return false;
+}
+
+void MsvThreadPool::CountCompletedTasks(size_t count)
+{
+	size_t workerIndex = 0;
+	if (!m_completedTasks || !GetCurrentWorkerIndex(workerIndex))
+	{
+		return;
+	}
+
+	//only owner worker writes its counter -> no read-modify-write is needed
+	std::atomic<uint64_t>& completedTasks = m_completedTasks[workerIndex].value;
+	completedTasks.store(completedTasks.load(std::memory_order_relaxed) + count, std::memory_order_relaxed);
+}
+
+IMsvTask* MsvThreadPool::StealTask(size_t workerIndex)
+{
+	size_t count = m_taskDeques.size();
+	if (count < 2)
+	{
+		return nullptr;
+	}
+
+	//start from random victim (thieves do not fight for the same deque)
+	size_t victimIndex = GetNextRandom() % count;
+	for (size_t i = 0; i < count; ++i, victimIndex = (victimIndex + 1) % count)
+	{
+		if (victimIndex == workerIndex)
+		{
+			continue;
+		}
+
+		IMsvTask* pTask = m_taskDeques[victimIndex]->Steal();
+		if (pTask)
+		{
+			return pTask;
+		}
+	}
+
+	return nullptr;
+}
+
+bool MsvThreadPool::HasQueuedTask() const
+{
+	if (m_spTaskQueue && m_spTaskQueue->GetSize())
+	{
+		return true;
+	}
+
+	if (m_spDeadlineTaskQueue && m_spDeadlineTaskQueue->GetSize())
+	{
+		return true;
+	}
+
+	std::vector<std::unique_ptr<MsvTaskDeque>>::const_iterator endIt = m_taskDeques.end();
+	for (std::vector<std::unique_ptr<MsvTaskDeque>>::const_iterator it = m_taskDeques.begin(); it != endIt; ++it)
+	{
+		if ((*it)->GetSize())
+		{
+			return true;
+		}
+	}
+
+	return false;
+}
+
+size_t MsvThreadPool::GetTaskBatch(std::shared_ptr<IMsvTask>* pTasks, size_t maxCount)
+{
+	size_t batchSize = (std::min)(m_dequeueBatchSize.load(std::memory_order_relaxed), maxCount);
+
+	if (batchSize > 1 && m_spTaskQueue)
+	{
+		//fairness -> worker takes at most its share of queued tasks (other workers get the rest)
+		size_t fairShare = m_spTaskQueue->GetSize() / (std::max)(m_runningWorkers.load(std::memory_order_relaxed), static_cast<size_t>(1));
+		batchSize = (std::min)(batchSize, fairShare);
+	}
+
+	if (batchSize > 1)
+	{
+		return m_spTaskQueue->PopBatch(pTasks, batchSize);
+	}
+
+	pTasks[0] = GetTask();
+
+	return pTasks[0] ? 1 : 0;
+}
+
+bool MsvThreadPool::ExecuteDeadlineTask()
+{
+	if (!m_spDeadlineTaskQueue)
+	{
+		return false;
+	}
+
+	bool dropped = false;
+	std::chrono::steady_clock::time_point deadline;
+
+	for (std::shared_ptr<IMsvTask> spTask = m_spDeadlineTaskQueue->Pop(deadline); spTask; spTask = m_spDeadlineTaskQueue->Pop(deadline))
+	{
+		if (!m_dropExpiredTasks || deadline >= std::chrono::steady_clock::now())
+		{
+			spTask->Execute();
+			CountCompletedTasks(1);
+			return true;
+		}
+
+		//deadline has passed -> do not waste worker time (all expired tasks are at the top of the heap)
+		++m_expiredTaskCount;
+		dropped = true;
+		if (m_expiredTaskCallback)
+		{
+			m_expiredTaskCallback(spTask);
+		}
+	}
+
+	return dropped;
+}
+
+bool MsvThreadPool::ExecuteTaskBatch()
+{
+	//the earliest deadline first
+	if (m_deadlineScheduling && ExecuteDeadlineTask())
+	{
+		return true;
+	}
+
+	//worker local buffer
+	std::shared_ptr<IMsvTask> tasks[MSV_MAX_DEQUEUE_BATCH_SIZE];
+
+	size_t count = GetTaskBatch(tasks, MSV_MAX_DEQUEUE_BATCH_SIZE);
+	for (size_t i = 0; i < count; ++i)
+	{
+		//task is released right after its execution
+		std::shared_ptr<IMsvTask> spTask = std::move(tasks[i]);
+		spTask->Execute();
+	}
+	CountCompletedTasks(count);
+
+	return count != 0;
+}
+
+std::shared_ptr<IMsvTask> MsvThreadPool::GetTask()
+{
+	//lock-free queue -> thread pool lock is not needed
+	if (!m_spTaskQueue)
+	{
+		return nullptr;
+	}
+
+	return m_spTaskQueue->Pop();
+}
+
+MsvErrorCode MsvThreadPool::PushTasks(const std::shared_ptr<IMsvTask>* pTasks, size_t count, MsvTaskPriority priority)
+{
+	if (!m_spTaskQueue)
+	{
+		return MSV_ALLOCATION_ERROR;
+	}
+
+	//tasks added by worker -> push them to its deque (work stealing mode, prioritized tasks go to shared queue)
+	size_t workerIndex = 0;
+	bool localTasks = m_workStealing && priority == MsvTaskPriority::MSV_TASK_PRIORITY_NORMAL && GetCurrentWorkerIndex(workerIndex);
+
+	MsvErrorCode errorCode = MSV_SUCCESS;
+	size_t pushed = 0;
+
+	for (size_t i = 0; i < count; ++i)
+	{
+		if (!pTasks[i])
+		{
+			//nullptr task can't be executed -> skip it
+			continue;
+		}
+
+		if (localTasks)
+		{
+			if (MSV_FAILED(errorCode = PushLocalTask(workerIndex, pTasks[i])))
+			{
+				break;
+			}
+			++pushed;
+			continue;
+		}
+
+		if (m_spTaskQueue->Push(pTasks[i], priority))
+		{
+			++pushed;
+			continue;
+		}
+
+		//queue is full -> wake up workers for already pushed tasks first (they will make free space)
+		WakeIdleWorkers(pushed);
+		pushed = 0;
+
+		bool queued = false;
+		if (MSV_FAILED(errorCode = PushTaskToFullQueue(pTasks[i], priority, queued)))
+		{
+			break;
+		}
+
+		if (queued)
+		{
+			++pushed;
+		}
+	}
+
+	//one wake up for whole batch (even when some task failed -> pushed tasks must be executed)
+	WakeIdleWorkers(pushed);
+
+	return errorCode;
+}
+
+MsvErrorCode MsvThreadPool::PushTaskToFullQueue(const std::shared_ptr<IMsvTask>& spTask, MsvTaskPriority priority, bool& queued)
+{
+	queued = false;
+
+	if (!m_spTaskQueue->GetCapacity())
+	{
+		//unbounded queue fails only when segment allocation fails
+		return MSV_ALLOCATION_ERROR;
+	}
+
+	return ApplyQueueFullPolicy(spTask,
+		[this, &spTask, priority]() { return m_spTaskQueue->Push(spTask, priority); },
+		[this, &spTask, priority]()
+		{
+			//drop the oldest tasks until there is free space (workers can pop some tasks meanwhile)
+			do
+			{
+				m_spTaskQueue->Pop(priority);
+			} while (!m_spTaskQueue->Push(spTask, priority));
+
+			return true;
+		},
+		queued);
+}
+
+MsvErrorCode MsvThreadPool::PushDeadlineTaskToFullQueue(const std::shared_ptr<IMsvTask>& spTask, std::chrono::steady_clock::time_point deadline, bool& queued)
+{
+	queued = false;
+
+	if (!m_spDeadlineTaskQueue->GetCapacity() || m_spDeadlineTaskQueue->GetSize() < m_spDeadlineTaskQueue->GetCapacity())
+	{
+		//queue is not full -> allocation failed
+		return MSV_ALLOCATION_ERROR;
+	}
+
+	return ApplyQueueFullPolicy(spTask,
+		[this, &spTask, deadline]() { return m_spDeadlineTaskQueue->Push(spTask, deadline); },
+		[this, &spTask, deadline]()
+		{
+			//the least urgent task is dropped (the new one when its deadline is the latest) -> it is reported like expired task
+			std::shared_ptr<IMsvTask> spDroppedTask;
+			bool pushed = m_spDeadlineTaskQueue->PushOrDropLatest(spTask, deadline, spDroppedTask);
+			if (spDroppedTask && m_expiredTaskCallback)
+			{
+				m_expiredTaskCallback(spDroppedTask);
+			}
+
+			return pushed && spDroppedTask != spTask;
+		},
+		queued);
+}
+
+MsvErrorCode MsvThreadPool::ApplyQueueFullPolicy(const std::shared_ptr<IMsvTask>& spTask, const std::function<bool()>& push, const std::function<bool()>& drop, bool& queued)
+{
+	queued = false;
+
+	++m_queueFullCount;
+
+	size_t workerIndex = 0;
+	MsvQueueFullPolicy policy = m_queueFullPolicy.load(std::memory_order_relaxed);
+	if (policy == MsvQueueFullPolicy::MSV_QUEUE_FULL_BLOCK && GetCurrentWorkerIndex(workerIndex))
+	{
+		//worker can't wait for itself (all workers could wait for each other) -> it executes the task
+		policy = MsvQueueFullPolicy::MSV_QUEUE_FULL_CALLER_RUNS;
+	}
+
+	switch (policy)
+	{
+	case MsvQueueFullPolicy::MSV_QUEUE_FULL_REJECT:
+		return MSV_QUEUE_FULL_ERROR;
+
+	case MsvQueueFullPolicy::MSV_QUEUE_FULL_CALLER_RUNS:
+		spTask->Execute();
+		return MSV_SUCCESS;
+
+	case MsvQueueFullPolicy::MSV_QUEUE_FULL_DROP_OLDEST:
+		queued = drop();
+		return MSV_SUCCESS;
+
+	default:
+		break;
+	}
+
+	//block -> wait for free space (yield first, then sleep with exponential backoff)
+	int32_t timeout = m_queueFullTimeout.load(std::memory_order_relaxed);
+	std::chrono::steady_clock::time_point deadline = std::chrono::steady_clock::now() + std::chrono::microseconds(timeout);
+	std::chrono::microseconds backoff(1);
+
+	for (uint32_t attempt = 0; !push(); ++attempt)
+	{
+		if (timeout > 0 && std::chrono::steady_clock::now() >= deadline)
+		{
+			return MSV_QUEUE_FULL_ERROR;
+		}
+
+		if (attempt < MSV_QUEUE_FULL_YIELD_COUNT)
+		{
+			std::this_thread::yield();
+		}
+		else
+		{
+			std::this_thread::sleep_for(backoff);
+			backoff = (std::min)(backoff * 2, std::chrono::microseconds(MSV_QUEUE_FULL_MAX_BACKOFF));
+		}
+	}
+
+	queued = true;
+
+	return MSV_SUCCESS;
+}
+
+MsvErrorCode MsvThreadPool::PushLocalTask(size_t workerIndex, const std::shared_ptr<IMsvTask>& spTask)
+{
+	if (!spTask.use_count())
+	{
+		//task without owner (aliasing shared pointer) -> caller guarantees its lifetime, deque stores it as it is
+		return m_taskDeques[workerIndex]->Push(spTask.get()) ? MSV_SUCCESS : MSV_ALLOCATION_ERROR;
+	}
+
+	//deque stores raw pointers -> owned task deletes itself after execution
+	MsvOwnedTask* pTask = new (std::nothrow) MsvOwnedTask(spTask);
+	if (!pTask)
+	{
+		return MSV_ALLOCATION_ERROR;
+	}
+
+	if (!m_taskDeques[workerIndex]->Push(pTask))
+	{
+		delete pTask;
+		return MSV_ALLOCATION_ERROR;
+	}
+
+	return MSV_SUCCESS;
+}
+
+void MsvThreadPool::WakeIdleWorkers(size_t count)
+{
+	if (!count)
+	{
+		return;
+	}
+
+	//fence pairs with seq_cst decrement of active workers in ExecuteTask (active worker will find pushed tasks)
+	std::atomic_thread_fence(std::memory_order_seq_cst);
+
+	//waking workers will find pushed tasks too (blocked workers are busy, but others can work instead of them)
+	size_t blockedWorkers = m_blockedWorkers.load();
+	size_t busyWorkers = m_activeWorkers.load() + m_wakingWorkers.load() + blockedWorkers;
+	//parked workers (over target of hill climbing and over blocked workers) are not woken up
+	size_t workerCount = (std::min)(m_runningWorkers.load(), m_targetWorkers.load() + blockedWorkers);
+	size_t idleWorkers = workerCount > busyWorkers ? workerCount - busyWorkers : 0;
+
+	if (m_maxWorkers && count > idleWorkers && !m_saturatedSince.load(std::memory_order_relaxed))
+	{
+		//tasks wait for workers -> timer thread starts new worker when they wait too long
+		int64_t notSaturated = 0;
+		m_saturatedSince.compare_exchange_strong(notSaturated, GetSteadyMicroseconds(), std::memory_order_relaxed);
+	}
+
+	count = (std::min)(count, idleWorkers);
+	if (count)
+	{
+		m_wakingWorkers += count;
+		WakeWorkers(count);
+	}
+}
+
+void MsvThreadPool::WakeWorkers(size_t count)
+{
+	//exactly count workers are woken up (each of them will check task queue), the latest idle worker first
+	m_spIdleWorkers->Wake(count);
+}
+
+void MsvThreadPool::ExecuteDequeTasks()
+{
+	std::vector<std::unique_ptr<MsvTaskDeque>>::iterator endIt = m_taskDeques.end();
+	for (std::vector<std::unique_ptr<MsvTaskDeque>>::iterator it = m_taskDeques.begin(); it != endIt; ++it)
+	{
+		//workers do not run -> any thread can pop (owned task deletes itself, task without owner is waited for by its owner)
+		IMsvTask* pTask = nullptr;
+		while ((pTask = (*it)->Pop()) != nullptr)
+		{
+			pTask->Execute();
+		}
+	}
+}
+
+void MsvThreadPool::ReleaseTaskDeques()
+{
+	ExecuteDequeTasks();
+
+	m_taskDeques.clear();
+}
+
+MsvErrorCode MsvThreadPool::StartTimerThread()
+{
+	std::lock_guard<std::recursive_mutex> lock(m_lock);
+
+	//timer thread is started by thread pool start (or it is stopping)
+	if (!IsRunning() || m_stopRequested || m_spTimerWorker)
+	{
+		return MSV_SUCCESS;
+	}
+
+	//timer thread has its own condition (it is not woken up by added tasks)
+	std::shared_ptr<IMsvUniqueWorker> spTimerWorker(m_spFactory->GetIMsvUniqueWorker(nullptr, nullptr, nullptr));
+	if (!spTimerWorker)
+	{
+		return MSV_ALLOCATION_ERROR;
+	}
+
+	//execute periodically (each tick of timer wheel)
+	std::function<void()> callback = std::bind(&MsvThreadPool::ProcessTimers, this);
+	MSV_RETURN_FAILED(spTimerWorker->SetTask(callback));
+	MSV_RETURN_FAILED(spTimerWorker->StartThread(m_spTimerWheel->GetResolution()));
+
+	m_spTimerWorker = spTimerWorker;
+	m_timerThreadStarted.store(true, std::memory_order_release);
+
+	return MSV_SUCCESS;
+}
+
+void MsvThreadPool::ProcessTimers()
+{
+	if (m_spTimerWheel->Advance(std::chrono::steady_clock::now(), m_expiredTimerTasks))
+	{
+		//all expired tasks at once (one wake up)
+		PushTasks(m_expiredTimerTasks.data(), m_expiredTimerTasks.size(), MsvTaskPriority::MSV_TASK_PRIORITY_NORMAL);
+	}
+
+	//release tasks (capacity is kept)
+	m_expiredTimerTasks.clear();
+
+	AdjustWorkerCount();
+}
+
+MsvErrorCode MsvThreadPool::StartWorker(size_t workerIndex)
+{
+	std::shared_ptr<IMsvUniqueWorker> spWorkerThread(m_spFactory->GetIMsvUniqueWorker(m_spIdleWorkers));
+	if (!spWorkerThread)
+	{
+		return MSV_ALLOCATION_ERROR;
+	}
+
+	std::function<void()> callback = std::bind(&MsvThreadPool::ExecuteTask, this, workerIndex);
+	MSV_RETURN_FAILED(spWorkerThread->SetTask(callback));
+
+	//worker must be counted before start (tasks added during start wake it up)
+	m_workerIdleSince[workerIndex].value.store(0, std::memory_order_relaxed);
+	++m_runningWorkers;
+
+	MsvErrorCode errorCode = spWorkerThread->StartThread();
+	if (MSV_FAILED(errorCode))
+	{
+		--m_runningWorkers;
+		return errorCode;
+	}
+
+	m_workers[workerIndex] = spWorkerThread;
+
+	return MSV_SUCCESS;
+}
+
+void MsvThreadPool::AdjustWorkerCount()
+{
+	if (!m_maxWorkers && !m_hillClimbing)
+	{
+		return;
+	}
+
+	//timer thread must not wait for thread pool lock (stopping thread holds it while it waits for timer thread)
+	std::unique_lock<std::recursive_mutex> lock(m_lock, std::try_to_lock);
+	if (!lock.owns_lock() || !m_isRunning || m_stopRequested)
+	{
+		return;
+	}
+
+	//release retired workers which have already stopped (join does not block)
+	for (size_t i = 0; i < m_workers.size(); ++i)
+	{
+		if (m_retiringWorkers[i] && !m_workers[i]->IsRunning())
+		{
+			m_workers[i]->WaitForThreadStop(0);
+			m_workers[i].reset();
+			m_retiringWorkers[i] = false;
+		}
+	}
+
+	int64_t now = GetSteadyMicroseconds();
+	if (m_hillClimbing)
+	{
+		SampleThroughput(now);
+	}
+
+	if (!m_maxWorkers)
+	{
+		return;
+	}
+
+	size_t runningWorkers = m_runningWorkers.load();
+
+	//tasks have been waiting for idle worker too long -> start new worker (in the first free slot, up to target)
+	int64_t saturatedSince = m_saturatedSince.load(std::memory_order_relaxed);
+	size_t maxWorkers = (m_hillClimbing ? m_targetWorkers.load() : m_maxWorkers) + m_blockedWorkers.load();
+	if (saturatedSince && now - saturatedSince >= m_growThreshold && runningWorkers < maxWorkers && HasQueuedTask())
+	{
+		for (size_t i = 0; i < m_workers.size(); ++i)
+		{
+			if (!m_workers[i])
+			{
+				if (MSV_SUCCEEDED(StartWorker(i)))
+				{
+					//the next worker after another threshold (when tasks still wait)
+					m_saturatedSince.store(now, std::memory_order_relaxed);
+				}
+				break;
+			}
+		}
+
+		return;
+	}
+
+	if (runningWorkers <= m_minWorkers)
+	{
+		return;
+	}
+
+	//retire one worker which is idle longer than keep-alive (it finishes its tasks when it is woken up meanwhile)
+	for (size_t i = 0; i < m_workers.size(); ++i)
+	{
+		int64_t idleSince = m_workers[i] && !m_retiringWorkers[i] ? m_workerIdleSince[i].value.load(std::memory_order_relaxed) : 0;
+		if (idleSince && now - idleSince >= m_keepAlive)
+		{
+			m_retiringWorkers[i] = true;
+			--m_runningWorkers;
+			m_workers[i]->StopThread();
+			break;
+		}
+	}
+}
+
+void MsvThreadPool::SampleThroughput(int64_t now)
+{
+	if (!m_lastSampleTime)
+	{
+		//the first sample -> nothing to compare
+		m_lastSampleTime = now;
+		return;
+	}
+
+	int64_t elapsed = now - m_lastSampleTime;
+	if (elapsed < m_sampleInterval)
+	{
+		return;
+	}
+
+	uint64_t completedTasks = 0;
+	size_t workerCount = m_workerCount.load();
+	for (size_t i = 0; i < workerCount; ++i)
+	{
+		completedTasks += m_completedTasks[i].value.load(std::memory_order_relaxed);
+	}
+
+	double throughput = static_cast<double>(completedTasks - m_lastCompletedTasks) * 1000000.0 / static_cast<double>(elapsed);
+	m_lastSampleTime = now;
+	m_lastCompletedTasks = completedTasks;
+
+	//throughput is limited by workers only when tasks wait for them (otherwise it is limited by producers)
+	if (HasQueuedTask())
+	{
+		ClimbTargetWorkerCount(throughput);
+	}
+}
+
+void MsvThreadPool::ClimbTargetWorkerCount(double throughput)
+{
+	if (m_lastThroughput > 0.0)
+	{
+		double margin = m_lastThroughput * MSV_HILL_CLIMBING_MARGIN / 100.0;
+		if (throughput < m_lastThroughput - margin)
+		{
+			//the last step was wrong -> go back
+			m_climbDirection = -m_climbDirection;
+		}
+		else if (throughput <= m_lastThroughput + margin)
+		{
+			m_lastThroughput = throughput;
+
+			//no significant change -> hold target (steady load must not park and unpark workers each sample)
+			if (++m_flatSamples < MSV_HILL_CLIMBING_HOLD_SAMPLES)
+			{
+				return;
+			}
+
+			//flat for long time -> probe fewer workers (less context switches and contention)
+			m_climbDirection = -1;
+		}
+	}
+	m_lastThroughput = throughput;
+	m_flatSamples = 0;
+
+	//target is at its bound -> probe the other direction (it would be stuck there otherwise)
+	size_t targetWorkers = m_targetWorkers.load();
+	size_t maxTargetWorkers = m_workerCount.load() - m_maxCompensatingWorkers;
+	if ((m_climbDirection > 0 && targetWorkers >= maxTargetWorkers) || (m_climbDirection < 0 && targetWorkers <= 1))
+	{
+		m_climbDirection = -m_climbDirection;
+	}
+
+	if (m_climbDirection > 0 && targetWorkers < maxTargetWorkers)
+	{
+		m_targetWorkers.store(targetWorkers + 1);
+
+		//parked worker continues (queued tasks wait for it)
+		WakeIdleWorkers(1);
+	}
+	else if (m_climbDirection < 0 && targetWorkers > 1)
+	{
+		//surplus worker parks itself when it finishes its current task
+		m_targetWorkers.store(targetWorkers - 1);
+	}
 }
 
 
@@ -38,12 +38,20 @@ along with Foobar. If not, see <https://www.gnu.org/licenses/>.
 #include "IMsvThreadPool.h"
 
 #include "IMsvUniqueWorker.h"
+#include "IMsvPriorityTaskQueue.h"
+#include "IMsvDeadlineTaskQueue.h"
+#include "IMsvTimerWheel.h"
+#include "MsvTaskDeque.h"
+#include "MsvPeriodicTask.h"
+#include "MsvCacheLine.h"
+#include "MsvIdleWorkerStack.h"
 
 MSV_DISABLE_ALL_WARNINGS
 
+#include <atomic>
 #include <mutex>
 #include <vector>
-#include <queue>
+#include <map>
 
 MSV_ENABLE_WARNINGS
 
@@ -63,10 +71,16 @@ class MsvThreadPool:
 public:
 	/**************************************************************************************************//**
 	* @brief		Constructor.
-	* @param		spFactory		Shared pointer to dependency injection factory.
+	* @param		spFactory				Shared pointer to dependency injection factory.
+	* @param		taskQueueCapacity		Capacity of each priority band of task queue and capacity of deadline task
+	*											queue (zero means unbounded task queues).
+	* @note		Task queue is lock-free in both cases. Adding task to full bounded priority band applies queue
+	*				full policy (see @ref SetQueueFullPolicy). Task queue can hold up to three times taskQueueCapacity
+	*				tasks (one band for each @ref MsvTaskPriority).
 	* @see		MsvWorker_Factory
+	* @see		MsvTaskQueue
 	******************************************************************************************************/
-	MsvThreadPool(std::shared_ptr<MsvThreadPool_Factory> spFactory = nullptr);
+	MsvThreadPool(std::shared_ptr<MsvThreadPool_Factory> spFactory = nullptr, size_t taskQueueCapacity = 0);
 
 	/**************************************************************************************************//**
 	* @brief		Virtual destructor.
@@ -76,7 +90,7 @@ public:
 	/**************************************************************************************************//**
 	* @copydoc IMsvThreadPool::AddTask(std::shared_ptr<IMsvTask> spTask)
 	******************************************************************************************************/
-	virtual void AddTask(std::shared_ptr<IMsvTask> spTask) override;
+	virtual MsvErrorCode AddTask(std::shared_ptr<IMsvTask> spTask) override;
 
 	/**************************************************************************************************//**
 	* @copydoc IMsvThreadPool::AddTask(std::function<void()>& task)
@@ -88,6 +102,58 @@ public:
 	******************************************************************************************************/
 	virtual MsvErrorCode AddTask(std::function<void(void*)>& task, void* pContext) override;
 
+	/**************************************************************************************************//**
+	* @copydoc IMsvThreadPool::AddTask(std::shared_ptr<IMsvTask> spTask, MsvTaskPriority priority)
+	******************************************************************************************************/
+	virtual MsvErrorCode AddTask(std::shared_ptr<IMsvTask> spTask, MsvTaskPriority priority) override;
+
+	/**************************************************************************************************//**
+	* @copydoc IMsvThreadPool::AddTask(std::function<void()>& task, MsvTaskPriority priority)
+	******************************************************************************************************/
+	virtual MsvErrorCode AddTask(std::function<void()>& task, MsvTaskPriority priority) override;
+
+	/**************************************************************************************************//**
+	* @copydoc IMsvThreadPool::AddTask(std::shared_ptr<IMsvTask> spTask, std::chrono::steady_clock::time_point deadline)
+	******************************************************************************************************/
+	virtual MsvErrorCode AddTask(std::shared_ptr<IMsvTask> spTask, std::chrono::steady_clock::time_point deadline) override;
+
+	/**************************************************************************************************//**
+	* @copydoc IMsvThreadPool::AddTask(std::function<void()>& task, std::chrono::steady_clock::time_point deadline)
+	******************************************************************************************************/
+	virtual MsvErrorCode AddTask(std::function<void()>& task, std::chrono::steady_clock::time_point deadline) override;
+
+	/**************************************************************************************************//**
+	* @copydoc IMsvThreadPool::AddTasks(const std::shared_ptr<IMsvTask>* pTasks, size_t count)
+	******************************************************************************************************/
+	virtual MsvErrorCode AddTasks(const std::shared_ptr<IMsvTask>* pTasks, size_t count) override;
+
+	/**************************************************************************************************//**
+	* @copydoc IMsvThreadPool::AddDelayedTask(std::shared_ptr<IMsvTask> spTask, std::chrono::microseconds delay, uint64_t* pTimerId)
+	* @note		Timer thread is started with the first delayed task (thread pool without delayed tasks does not
+	*				have it). It advances timer wheel each @ref MSV_TIMER_RESOLUTION microseconds.
+	******************************************************************************************************/
+	virtual MsvErrorCode AddDelayedTask(std::shared_ptr<IMsvTask> spTask, std::chrono::microseconds delay, uint64_t* pTimerId = nullptr) override;
+
+	/**************************************************************************************************//**
+	* @copydoc IMsvThreadPool::CancelDelayedTask(uint64_t timerId)
+	******************************************************************************************************/
+	virtual MsvErrorCode CancelDelayedTask(uint64_t timerId) override;
+
+	/**************************************************************************************************//**
+	* @copydoc IMsvThreadPool::AddPeriodicTask(std::shared_ptr<IMsvTask> spTask, std::chrono::microseconds period, MsvPeriodicMode mode, MsvMissedTickPolicy missedTickPolicy, uint64_t* pPeriodicTaskId)
+	* @note		Periodic task is wrapped to @ref MsvPeriodicTask which is inserted to timer wheel (the same as
+	*				delayed tasks) and reschedules itself after each execution.
+	******************************************************************************************************/
+	virtual MsvErrorCode AddPeriodicTask(std::shared_ptr<IMsvTask> spTask, std::chrono::microseconds period, MsvPeriodicMode mode = MsvPeriodicMode::MSV_PERIODIC_FIXED_RATE, MsvMissedTickPolicy missedTickPolicy = MsvMissedTickPolicy::MSV_MISSED_TICK_SKIP, uint64_t* pPeriodicTaskId = nullptr) override;
+
+	/**************************************************************************************************//**
+	* @copydoc IMsvThreadPool::CancelPeriodicTask(uint64_t periodicTaskId)
+	******************************************************************************************************/
+	virtual MsvErrorCode CancelPeriodicTask(uint64_t periodicTaskId) override;
+
+	//batch overloads (range, iterators and initializer list) are hidden by override
+	using IMsvThreadPool::AddTasks;
+
 	/**************************************************************************************************//**
 	* @copydoc IMsvThreadPool::IsRunning()
 	******************************************************************************************************/
@@ -113,24 +179,603 @@ public:
 	******************************************************************************************************/
 	virtual MsvErrorCode WaitForThreadPoolStop(int32_t timeout = 30000000) override;
 
+	/**************************************************************************************************//**
+	* @copydoc IMsvThreadPool::IsWorkerThread()
+	******************************************************************************************************/
+	virtual bool IsWorkerThread() const override;
+
+	/**************************************************************************************************//**
+	* @copydoc IMsvThreadPool::TryExecuteTask()
+	* @note		Worker takes task from its own deque first (work stealing mode), then from shared queues and
+	*				finally it steals task from other workers. Other threads take tasks from shared queues only.
+	******************************************************************************************************/
+	virtual bool TryExecuteTask() override;
+
+	/**************************************************************************************************//**
+	* @copydoc IMsvThreadPool::HasLocalTask()
+	******************************************************************************************************/
+	virtual bool HasLocalTask() const override;
+
+	/**************************************************************************************************//**
+	* @copydoc IMsvThreadPool::GetWorkerCount()
+	******************************************************************************************************/
+	virtual size_t GetWorkerCount() const override;
+
+	/**************************************************************************************************//**
+	* @copydoc IMsvThreadPool::GetCurrentWorkerIndex(size_t& workerIndex)
+	******************************************************************************************************/
+	virtual bool GetCurrentWorkerIndex(size_t& workerIndex) const override;
+
+	/**************************************************************************************************//**
+	* @copydoc IMsvThreadPool::EnterBlockingRegion()
+	* @note		Worker is compensated only when compensating workers are allowed (nested regions of one worker
+	*				are counted once).
+	* @see		SetCompensatingWorkers
+	******************************************************************************************************/
+	virtual bool EnterBlockingRegion() override;
+
+	/**************************************************************************************************//**
+	* @copydoc IMsvThreadPool::LeaveBlockingRegion()
+	******************************************************************************************************/
+	virtual void LeaveBlockingRegion() override;
+
+	/**************************************************************************************************//**
+	* @brief			Set work stealing mode.
+	* @details		In work stealing mode each worker has its own deque @ref MsvTaskDeque. Tasks added by
+	*					worker thread (task which adds another tasks) are pushed to deque of the worker (without
+	*					any contention), tasks added by other threads are pushed to shared task queue. Worker
+	*					executes tasks from its own deque first (the latest task first), then from the shared
+	*					queue and then it steals the oldest tasks from deques of randomly chosen workers.
+	* @param[in]	workStealing		Flag if work stealing mode is enabled (true) or not (false).
+	* @returns		MsvErrorCode
+	* @retval		MSV_ALREADY_RUNNING_INFO	When thread pool is running (mode is not changed).
+	* @retval		MSV_SUCCESS						On success.
+	* @note			Work stealing mode is disabled by default. It can't be changed when thread pool is running.
+	******************************************************************************************************/
+	virtual MsvErrorCode SetWorkStealing(bool workStealing);
+
+	/**************************************************************************************************//**
+	* @brief			Set priority policy.
+	* @details		Sets how priority bands of task queue are served (see @ref IMsvPriorityTaskQueue).
+	* @param[in]	policy		Priority policy.
+	* @returns		MsvErrorCode
+	* @retval		MSV_NOT_INITIALIZED_ERROR	When task queue does not exist.
+	* @retval		MSV_ALREADY_RUNNING_INFO	When thread pool is running (policy is not changed).
+	* @retval		MSV_SUCCESS						On success.
+	* @note			Default policy is @ref MsvPriorityPolicy::MSV_PRIORITY_STRICT. It can't be changed when thread
+	*					pool is running.
+	******************************************************************************************************/
+	virtual MsvErrorCode SetPriorityPolicy(MsvPriorityPolicy policy);
+
+	/**************************************************************************************************//**
+	* @brief			Set priority weights.
+	* @details		Sets weights of priority bands for @ref MsvPriorityPolicy::MSV_PRIORITY_WEIGHTED policy.
+	* @param[in]	highWeight		Weight of high priority band.
+	* @param[in]	normalWeight	Weight of normal priority band.
+	* @param[in]	lowWeight		Weight of low priority band.
+	* @returns		MsvErrorCode
+	* @retval		MSV_NOT_INITIALIZED_ERROR	When task queue does not exist.
+	* @retval		MSV_INVALID_DATA_ERROR		When some weight is zero or sum of weights is too big.
+	* @retval		MSV_ALREADY_RUNNING_INFO	When thread pool is running (weights are not changed).
+	* @retval		MSV_SUCCESS						On success.
+	* @note			Default weights are 4, 2 and 1. They can't be changed when thread pool is running.
+	* @see			IMsvPriorityTaskQueue::SetPriorityWeights
+	******************************************************************************************************/
+	virtual MsvErrorCode SetPriorityWeights(uint32_t highWeight, uint32_t normalWeight, uint32_t lowWeight);
+
+	/**************************************************************************************************//**
+	* @brief			Set priority aging.
+	* @details		Lower priority band which has not been served for agingThreshold pops is served before
+	*					higher priority bands (lower priority tasks are never starved forever).
+	* @param[in]	agingThreshold		Count of pops (zero disables aging).
+	* @returns		MsvErrorCode
+	* @retval		MSV_NOT_INITIALIZED_ERROR	When task queue does not exist.
+	* @retval		MSV_SUCCESS						On success.
+	* @note			Default aging threshold is @ref MsvPriorityTaskQueue::MSV_DEFAULT_PRIORITY_AGING. It can be
+	*					changed when thread pool is running.
+	******************************************************************************************************/
+	virtual MsvErrorCode SetPriorityAging(uint32_t agingThreshold);
+
+	/**************************************************************************************************//**
+	* @brief			Set deadline scheduling.
+	* @details		Enables (or disables) earliest deadline first scheduling of tasks with deadline. Workers
+	*					execute task with the earliest deadline first (before tasks without deadline).
+	* @param[in]	deadlineScheduling		Flag if deadline scheduling is enabled (true) or not (false).
+	* @returns		MsvErrorCode
+	* @retval		MSV_ALREADY_RUNNING_INFO	When thread pool is running (mode is not changed).
+	* @retval		MSV_SUCCESS						On success.
+	* @note			Deadline scheduling is disabled by default. It can't be changed when thread pool is running.
+	* @see			SetDropExpiredTasks
+	******************************************************************************************************/
+	virtual MsvErrorCode SetDeadlineScheduling(bool deadlineScheduling);
+
+	/**************************************************************************************************//**
+	* @brief			Set drop expired tasks.
+	* @details		Task whose deadline has passed before its execution is dropped (it is not executed) and
+	*					expiredTaskCallback is called with it (in worker thread). The callback is called for tasks
+	*					dropped from full deadline queue too (in producer thread, see @ref SetQueueFullPolicy).
+	* @param[in]	dropExpiredTasks			Flag if expired tasks are dropped (true) or executed (false).
+	* @param[in]	expiredTaskCallback		Callback which is called for each dropped task (it can be empty).
+	* @returns		MsvErrorCode
+	* @retval		MSV_ALREADY_RUNNING_INFO	When thread pool is running (nothing is changed).
+	* @retval		MSV_SUCCESS						On success.
+	* @note			Expired tasks are executed by default. It can't be changed when thread pool is running.
+	* @see			SetDeadlineScheduling
+	* @see			GetExpiredTaskCount
+	******************************************************************************************************/
+	virtual MsvErrorCode SetDropExpiredTasks(bool dropExpiredTasks, std::function<void(std::shared_ptr<IMsvTask>)> expiredTaskCallback = nullptr);
+
+	/**************************************************************************************************//**
+	* @brief			Get expired task count.
+	* @details		Returns count of dropped expired tasks.
+	* @returns		uint64_t
+	* @see			SetDropExpiredTasks
+	******************************************************************************************************/
+	virtual uint64_t GetExpiredTaskCount() const;
+
+	/**************************************************************************************************//**
+	* @brief			Set queue full policy.
+	* @details		Sets backpressure policy which is applied when task is added to full bounded priority band of
+	*					task queue or to full deadline task queue (see taskQueueCapacity constructor parameter, it is
+	*					capacity of each priority band).
+	* @param[in]	policy		Queue full policy.
+	* @param[in]	timeout		Maximal time in microseconds for which producer waits for free space (only
+	*									@ref MsvQueueFullPolicy::MSV_QUEUE_FULL_BLOCK policy, zero means no timeout).
+	* @returns		MsvErrorCode
+	* @retval		MSV_SUCCESS		On success.
+	* @note			Default policy is @ref MsvQueueFullPolicy::MSV_QUEUE_FULL_BLOCK without timeout. Worker of
+	*					this thread pool never blocks (it executes the task itself). Policy is applied to shared task
+	*					queue and to deadline task queue (drop oldest policy drops task with the latest deadline
+	*					there and passes it to expired task callback). Worker deques in work stealing mode are unbounded. It can be changed when thread pool
+	*					is running.
+	* @see			GetQueueFullCount
+	******************************************************************************************************/
+	virtual MsvErrorCode SetQueueFullPolicy(MsvQueueFullPolicy policy, int32_t timeout = 0);
+
+	/**************************************************************************************************//**
+	* @brief			Get queue full count.
+	* @details		Returns how many times task has been added to full task queue (it can be used to tune task
+	*					queue capacity).
+	* @returns		uint64_t
+	* @see			SetQueueFullPolicy
+	******************************************************************************************************/
+	virtual uint64_t GetQueueFullCount() const;
+
+	/**************************************************************************************************//**
+	* @brief			Set dequeue batch size.
+	* @details		Worker pops up to batchSize tasks from shared task queue at once (one atomic reservation)
+	*					to its local buffer and executes them. It saves queue operations for short tasks.
+	* @param[in]	batchSize		Maximal count of tasks popped at once (it is clamped to range from 1 to
+	*										@ref MSV_MAX_DEQUEUE_BATCH_SIZE).
+	* @returns		MsvErrorCode
+	* @retval		MSV_SUCCESS		On success.
+	* @note			Default batch size is 1 (one task per pop). Worker never pops more than its fair share
+	*					of queued tasks (queue size divided by worker count), so other workers are not starved.
+	*					It can be changed when thread pool is running.
+	******************************************************************************************************/
+	virtual MsvErrorCode SetDequeueBatchSize(size_t batchSize);
+
+	/**************************************************************************************************//**
+	* @brief		Maximal dequeue batch size.
+	* @details	Size of worker local buffer for popped tasks.
+	* @see		SetDequeueBatchSize
+	******************************************************************************************************/
+	static const size_t MSV_MAX_DEQUEUE_BATCH_SIZE = 64;
+
+	/**************************************************************************************************//**
+	* @brief			Set idle strategy.
+	* @details		Worker which has no task spins (with CPU pause hint) and then yields before it parks (waits
+	*					for notification). It stays active meanwhile, so a task added during spinning is taken
+	*					without any wake up (no notification, no context switch). Spinning burns CPU time, so it
+	*					is meant for latency critical thread pools.
+	* @param[in]	spinCount		Count of spins (queue checks with CPU pause) before worker yields (it is clamped
+	*										to @ref MSV_MAX_IDLE_SPIN_COUNT).
+	* @param[in]	yieldCount		Count of yields (queue checks with thread yield) before worker parks (it is
+	*										clamped to @ref MSV_MAX_IDLE_SPIN_COUNT).
+	* @returns		MsvErrorCode
+	* @retval		MSV_SUCCESS		On success.
+	* @note			Default counts are 0 (worker parks immediately). It can be changed when thread pool is
+	*					running.
+	******************************************************************************************************/
+	virtual MsvErrorCode SetIdleStrategy(uint32_t spinCount, uint32_t yieldCount);
+
+	/**************************************************************************************************//**
+	* @brief		Maximal count of idle spins (and yields).
+	* @details	Spin budget is bounded, so idle worker always parks in the end.
+	* @see		SetIdleStrategy
+	******************************************************************************************************/
+	static const uint32_t MSV_MAX_IDLE_SPIN_COUNT = 1000000;
+
+	/**************************************************************************************************//**
+	* @brief			Get count of pending delayed tasks.
+	* @details		Scheduled periodic tasks are counted too (each has one pending timer).
+	* @returns		size_t
+	* @see			AddDelayedTask
+	******************************************************************************************************/
+	virtual size_t GetDelayedTaskCount() const;
+
+	/**************************************************************************************************//**
+	* @brief			Set elastic worker count.
+	* @details		Elastic thread pool starts with worker count given to @ref StartThreadPool (clamped to the
+	*					bounds) and the count is adjusted by timer thread when thread pool is running:
+	*					- New worker is started when queued tasks have been waiting for idle worker longer than grow
+	*						threshold (one worker per threshold).
+	*					- Worker which has been idle longer than keep-alive is retired (one worker per tick).
+	* @param[in]	minWorkers			Minimal count of workers.
+	* @param[in]	maxWorkers			Maximal count of workers (0 disables elastic worker count).
+	* @param[in]	keepAlive			Time in microseconds after which idle worker is retired.
+	* @param[in]	growThreshold		Time in microseconds which tasks can wait for idle worker before new worker is
+	*											started.
+	* @returns		MsvErrorCode
+	* @retval		MSV_ALREADY_RUNNING_INFO	When thread pool is running (bounds are not changed).
+	* @retval		MSV_INVALID_DATA_ERROR		When minimal count is greater than maximal count.
+	* @retval		MSV_SUCCESS						On success.
+	* @note			Elastic worker count is disabled by default. It can't be changed when thread pool is running.
+	*					@ref GetWorkerCount returns maximal count of workers (indexes of all workers are lower).
+	* @see			GetRunningWorkerCount
+	******************************************************************************************************/
+	virtual MsvErrorCode SetElasticWorkers(uint16_t minWorkers, uint16_t maxWorkers, int32_t keepAlive = 60000000, int32_t growThreshold = 1000);
+
+	/**************************************************************************************************//**
+	* @brief			Get count of running workers.
+	* @details		It is lower or equal to @ref GetWorkerCount (retiring workers are not counted).
+	* @returns		size_t
+	* @see			SetElasticWorkers
+	******************************************************************************************************/
+	virtual size_t GetRunningWorkerCount() const;
+
+	/**************************************************************************************************//**
+	* @brief			Set hill climbing concurrency control.
+	* @details		Timer thread samples throughput (completed tasks per second) and adjusts target count of
+	*					active workers by one each sample (hill climbing):
+	*					- Throughput has improved -> the same direction.
+	*					- Throughput has dropped -> opposite direction.
+	*					- Throughput has not changed significantly -> target is held. Fewer workers are probed after
+	*						@ref MSV_HILL_CLIMBING_HOLD_SAMPLES flat samples (the same throughput with less threads).
+	*
+	*					Workers over the target are parked (they wait like idle workers even when there are queued
+	*					tasks). Target is changed only when tasks wait in queues (otherwise throughput is limited by
+	*					producers). It is between 1 and @ref GetWorkerCount (elastic thread pool starts new workers
+	*					only up to the target).
+	* @param[in]	hillClimbing		Flag if hill climbing is enabled (true) or not (false).
+	* @param[in]	sampleInterval		Sample interval in microseconds.
+	* @returns		MsvErrorCode
+	* @retval		MSV_ALREADY_RUNNING_INFO	When thread pool is running (it is not changed).
+	* @retval		MSV_SUCCESS						On success.
+	* @note			Hill climbing is disabled by default. It can't be changed when thread pool is running.
+	* @see			GetTargetWorkerCount
+	******************************************************************************************************/
+	virtual MsvErrorCode SetHillClimbing(bool hillClimbing, int32_t sampleInterval = 100000);
+
+	/**************************************************************************************************//**
+	* @brief			Get target count of active workers.
+	* @details		It is count of workers when hill climbing is disabled.
+	* @returns		size_t
+	* @see			SetHillClimbing
+	******************************************************************************************************/
+	virtual size_t GetTargetWorkerCount() const;
+
+	/**************************************************************************************************//**
+	* @brief			Set maximal count of compensating workers.
+	* @details		Compensating workers execute tasks instead of workers which block in blocking region (there
+	*					are at most as many active workers as @ref GetTargetWorkerCount plus blocked workers). They
+	*					are started with thread pool and they wait until any worker blocks (elastic thread pool
+	*					starts them on demand). Worker over the count parks itself when blocked worker leaves its
+	*					region.
+	* @param[in]	maxCompensatingWorkers		Maximal count of compensating workers (0 disables compensation).
+	* @returns		MsvErrorCode
+	* @retval		MSV_ALREADY_RUNNING_INFO	When thread pool is running (it is not changed).
+	* @retval		MSV_SUCCESS						On success.
+	* @note			Compensating workers are counted by @ref GetWorkerCount (they have their own indexes).
+	* @see			EnterBlockingRegion
+	******************************************************************************************************/
+	virtual MsvErrorCode SetCompensatingWorkers(uint16_t maxCompensatingWorkers);
+
+	/**************************************************************************************************//**
+	* @brief		Hill climbing margin in percents.
+	* @details	Throughput change which is lower is not significant (it is noise).
+	* @see		SetHillClimbing
+	******************************************************************************************************/
+	static const uint32_t MSV_HILL_CLIMBING_MARGIN = 5;
+
+	/**************************************************************************************************//**
+	* @brief		Count of flat hill climbing samples before the next probe.
+	* @details	Target is not changed while throughput does not change significantly (steady load does not
+	*				park and unpark workers each sample).
+	* @see		SetHillClimbing
+	******************************************************************************************************/
+	static const uint32_t MSV_HILL_CLIMBING_HOLD_SAMPLES = 4;
+
+	/**************************************************************************************************//**
+	* @brief		Timer resolution in microseconds (tick of timer wheel).
+	* @see		AddDelayedTask
+	******************************************************************************************************/
+	static const int32_t MSV_TIMER_RESOLUTION = 1000;
+
+protected:
+	/**************************************************************************************************//**
+	* @brief		Count of yields before producer starts to sleep (when it waits for free space in the queue).
+	******************************************************************************************************/
+	static const uint32_t MSV_QUEUE_FULL_YIELD_COUNT = 64;
+
+	/**************************************************************************************************//**
+	* @brief		Maximal sleep time in microseconds of producer which waits for free space in the queue.
+	******************************************************************************************************/
+	static const int64_t MSV_QUEUE_FULL_MAX_BACKOFF = 1000;
+
 protected:
 	/**************************************************************************************************//**
 	* @brief			Task execution function.
 	* @details		This is callback inserted to each worker (instance of @ref IMsvUniqueWorker). It calls
 	*					execute function of tasks.
+	* @param[in]	workerIndex		Index of worker which executes tasks (index of its deque in work stealing
+	*										mode).
 	* @see			GetTask
 	******************************************************************************************************/
-	void ExecuteTask();
+	void ExecuteTask(size_t workerIndex);
+
+	/**************************************************************************************************//**
+	* @brief			Execute tasks in work stealing mode.
+	* @details		Executes tasks from worker deque, shared queue and deques of other workers until there is
+	*					any task (or until the worker is parked).
+	* @param[in]	workerIndex		Index of worker (and its deque) which executes tasks.
+	* @returns		bool
+	* @retval		true		When the worker has been parked.
+	* @retval		false		When there is no task.
+	* @see			SetWorkStealing
+	******************************************************************************************************/
+	bool ExecuteTaskWorkStealing(size_t workerIndex);
+
+	/**************************************************************************************************//**
+	* @brief			Try to park current worker.
+	* @details		Worker is parked (it is not counted as active anymore) when there are more active workers than
+	*					target of hill climbing (blocked workers are not counted as active).
+	* @returns		bool
+	* @retval		true		When the worker has been parked (it must stop executing tasks).
+	* @retval		false		When the worker can continue.
+	* @see			SetHillClimbing
+	******************************************************************************************************/
+	bool TryParkWorker();
+
+	/**************************************************************************************************//**
+	* @brief			Wait for task actively.
+	* @details		Idle worker spins and yields (see @ref SetIdleStrategy) until any task is queued.
+	* @returns		bool
+	* @retval		true		When a task has been queued (worker continues).
+	* @retval		false		When spin budget is exhausted (worker parks).
+	******************************************************************************************************/
+	bool SpinForTask() const;
+
+	/**************************************************************************************************//**
+	* @brief			Count completed tasks.
+	* @details		Adds count to counter of current worker (nothing is done when hill climbing is disabled or when
+	*					current thread is not worker).
+	* @param[in]	count		Count of completed tasks.
+	******************************************************************************************************/
+	void CountCompletedTasks(size_t count);
+
+	/**************************************************************************************************//**
+	* @brief			Steal task.
+	* @details		Tries to steal task from deques of other workers (it starts from randomly chosen one).
+	* @param[in]	workerIndex		Index of worker which steals (its own deque is skipped).
+	* @returns		IMsvTask*
+	* @retval		nullptr		When all deques are empty.
+	******************************************************************************************************/
+	IMsvTask* StealTask(size_t workerIndex);
+
+	/**************************************************************************************************//**
+	* @brief			Check if there is any queued task.
+	* @details		Checks shared task queue and deques of all workers.
+	* @returns		bool
+	* @retval		true		When there is any queued task.
+	* @retval		false		When there is no queued task.
+	******************************************************************************************************/
+	bool HasQueuedTask() const;
 
 	/**************************************************************************************************//**
 	* @brief			Get task to execute.
-	* @details		Returns current task in the queue @ref m_taskQueue which will be executed. The task
+	* @details		Returns current task in the queue @ref m_spTaskQueue which will be executed. The task
 	*					is removed from the queue.
 	* @returns		std::shared_ptr<IMsvTask>
-	* @see			m_taskQueue
+	* @see			m_spTaskQueue
 	******************************************************************************************************/
 	virtual std::shared_ptr<IMsvTask> GetTask();
 
+	/**************************************************************************************************//**
+	* @brief			Get batch of tasks to execute.
+	* @details		Pops up to dequeue batch size tasks from the queue @ref m_spTaskQueue (but at most fair share
+	*					of queued tasks).
+	* @param[out]	pTasks		Worker local buffer for popped tasks.
+	* @param[in]	maxCount		Size of the buffer.
+	* @returns		size_t
+	* @retval		0		When queue is empty.
+	* @see			SetDequeueBatchSize
+	******************************************************************************************************/
+	size_t GetTaskBatch(std::shared_ptr<IMsvTask>* pTasks, size_t maxCount);
+
+	/**************************************************************************************************//**
+	* @brief			Execute deadline task.
+	* @details		Pops task with the earliest deadline from @ref m_spDeadlineTaskQueue and executes it
+	*					(expired tasks are dropped when it is enabled).
+	* @returns		bool
+	* @retval		true		When any task has been executed or dropped.
+	* @retval		false		When deadline queue is empty.
+	* @see			SetDeadlineScheduling
+	******************************************************************************************************/
+	bool ExecuteDeadlineTask();
+
+	/**************************************************************************************************//**
+	* @brief			Execute batch of tasks.
+	* @details		Pops batch of tasks from the queue @ref m_spTaskQueue to worker local buffer and executes
+	*					them. Task with the earliest deadline is executed instead when deadline scheduling is enabled.
+	* @returns		bool
+	* @retval		true		When any task has been executed.
+	* @retval		false		When queue is empty.
+	* @see			GetTaskBatch
+	******************************************************************************************************/
+	bool ExecuteTaskBatch();
+
+	/**************************************************************************************************//**
+	* @brief			Push tasks.
+	* @details		Pushes tasks to the queue @ref m_spTaskQueue (or to deque of current worker in work stealing
+	*					mode) and wakes up only so many idle workers as needed (one wake up for whole batch).
+	* @param[in]	pTasks		Array of shared pointers to tasks (nullptr tasks are skipped).
+	* @param[in]	count			Count of tasks in pTasks array.
+	* @param[in]	priority		Priority of all tasks (only normal priority tasks are pushed to worker deque).
+	* @returns		MsvErrorCode
+	* @retval		MSV_ALLOCATION_ERROR		When task queue does not exist or its allocation failed.
+	* @retval		MSV_QUEUE_FULL_ERROR		When task has been rejected by queue full policy.
+	* @retval		MSV_SUCCESS					On success.
+	* @note			It never takes thread pool lock @ref m_lock.
+	* @see			m_spTaskQueue
+	******************************************************************************************************/
+	MsvErrorCode PushTasks(const std::shared_ptr<IMsvTask>* pTasks, size_t count, MsvTaskPriority priority);
+
+	/**************************************************************************************************//**
+	* @brief			Push task to full queue.
+	* @details		Applies queue full policy (task is pushed, executed or rejected) and counts queue full event.
+	* @param[in]	spTask		Shared pointer to task.
+	* @param[in]	priority		Task priority (drop oldest policy drops task with the same priority).
+	* @param[out]	queued		Flag if task has been pushed to the queue (true) or not (false).
+	* @returns		MsvErrorCode
+	* @retval		MSV_ALLOCATION_ERROR		When allocation of unbounded queue failed.
+	* @retval		MSV_QUEUE_FULL_ERROR		When task has been rejected (or wait for free space timed out).
+	* @retval		MSV_SUCCESS					On success (task has been pushed or executed).
+	* @see			SetQueueFullPolicy
+	******************************************************************************************************/
+	MsvErrorCode PushTaskToFullQueue(const std::shared_ptr<IMsvTask>& spTask, MsvTaskPriority priority, bool& queued);
+
+	/**************************************************************************************************//**
+	* @brief			Push task with deadline to full deadline queue.
+	* @details		Applies queue full policy (task is pushed, executed or rejected) and counts queue full event.
+	* @param[in]	spTask		Shared pointer to task.
+	* @param[in]	deadline		Absolute deadline of the task.
+	* @param[out]	queued		Flag if task has been pushed to the queue (true) or not (false).
+	* @returns		MsvErrorCode
+	* @retval		MSV_ALLOCATION_ERROR		When queue is not full (its allocation failed).
+	* @retval		MSV_QUEUE_FULL_ERROR		When task has been rejected (or wait for free space timed out).
+	* @retval		MSV_SUCCESS					On success (task has been pushed or executed).
+	* @note			Drop oldest policy drops the least urgent task (the one with the latest deadline, it can be
+	*					the new task too). Dropped task is passed to expired task callback (see @ref SetDropExpiredTasks).
+	* @see			SetQueueFullPolicy
+	******************************************************************************************************/
+	MsvErrorCode PushDeadlineTaskToFullQueue(const std::shared_ptr<IMsvTask>& spTask, std::chrono::steady_clock::time_point deadline, bool& queued);
+
+	/**************************************************************************************************//**
+	* @brief			Apply queue full policy.
+	* @details		Common part of @ref PushTaskToFullQueue and @ref PushDeadlineTaskToFullQueue.
+	* @param[in]	spTask		Shared pointer to task.
+	* @param[in]	push			Function which tries to push the task (it returns false when queue is full).
+	* @param[in]	drop			Function which drops task(s) and pushes the task (drop oldest policy). It returns
+	*								false when the task itself has been dropped.
+	* @param[out]	queued		Flag if task has been pushed to the queue (true) or not (false).
+	* @returns		MsvErrorCode
+	* @retval		MSV_QUEUE_FULL_ERROR		When task has been rejected (or wait for free space timed out).
+	* @retval		MSV_SUCCESS					On success (task has been pushed or executed).
+	* @see			SetQueueFullPolicy
+	******************************************************************************************************/
+	MsvErrorCode ApplyQueueFullPolicy(const std::shared_ptr<IMsvTask>& spTask, const std::function<bool()>& push, const std::function<bool()>& drop, bool& queued);
+
+	/**************************************************************************************************//**
+	* @brief			Push task to worker deque.
+	* @details		Pushes task to deque of the worker (work stealing mode). It does not wake up any worker.
+	*					Owned task is wrapped to @ref MsvOwnedTask (deque stores raw pointers), task without owner
+	*					(aliasing shared pointer) is pushed without any allocation.
+	* @param[in]	workerIndex		Index of worker which runs in current thread.
+	* @param[in]	spTask			Shared pointer to task.
+	* @returns		MsvErrorCode
+	* @retval		MSV_ALLOCATION_ERROR		When allocation failed.
+	* @retval		MSV_SUCCESS					On success.
+	* @warning		It must be called by the worker thread only (it owns the deque).
+	******************************************************************************************************/
+	MsvErrorCode PushLocalTask(size_t workerIndex, const std::shared_ptr<IMsvTask>& spTask);
+
+	/**************************************************************************************************//**
+	* @brief			Wake up idle workers.
+	* @details		Wakes up at most count workers, but only workers which are idle (active and waking workers
+	*					will find pushed tasks).
+	* @param[in]	count		Count of pushed tasks.
+	******************************************************************************************************/
+	void WakeIdleWorkers(size_t count);
+
+	/**************************************************************************************************//**
+	* @brief			Wake up workers.
+	* @details		Wakes up count idle workers (wake ups for workers which do not wait yet are kept).
+	* @param[in]	count		Count of workers to wake up.
+	******************************************************************************************************/
+	void WakeWorkers(size_t count);
+
+	/**************************************************************************************************//**
+	* @brief			Execute tasks which are still in worker deques.
+	* @details		Calling thread executes them (tasks without owner are waited for by their owners, e.g.
+	*					@ref MsvForkJoin or @ref MsvTaskGraph, so they can't be dropped).
+	* @warning		Workers must not run.
+	******************************************************************************************************/
+	void ExecuteDequeTasks();
+
+	/**************************************************************************************************//**
+	* @brief			Release worker deques.
+	* @details		Executes all tasks which are still in the deques and releases deques.
+	* @warning		Workers must not run.
+	******************************************************************************************************/
+	void ReleaseTaskDeques();
+
+	/**************************************************************************************************//**
+	* @brief			Start timer thread.
+	* @details		Creates and starts timer thread when thread pool is running and timer thread does not run.
+	* @returns		MsvErrorCode
+	* @retval		MSV_ALLOCATION_ERROR		When timer thread allocation failed.
+	* @retval		MSV_SUCCESS					On success (or when thread pool is not running).
+	* @see			ProcessTimers
+	******************************************************************************************************/
+	MsvErrorCode StartTimerThread();
+
+	/**************************************************************************************************//**
+	* @brief			Process timers.
+	* @details		This is callback of timer thread. It advances timer wheel to current time and pushes
+	*					expired delayed tasks to task queue (all at once).
+	* @see			AddDelayedTask
+	******************************************************************************************************/
+	void ProcessTimers();
+
+	/**************************************************************************************************//**
+	* @brief			Start worker.
+	* @details		Creates worker, counts it as running and starts it.
+	* @param[in]	workerIndex		Index of worker (its slot in @ref m_workers).
+	* @returns		MsvErrorCode
+	* @retval		MSV_ALLOCATION_ERROR		When worker allocation failed.
+	* @retval		other error code			When start of worker failed.
+	* @retval		MSV_SUCCESS					On success.
+	* @warning		It must be called with thread pool lock @ref m_lock.
+	******************************************************************************************************/
+	MsvErrorCode StartWorker(size_t workerIndex);
+
+	/**************************************************************************************************//**
+	* @brief			Adjust worker count.
+	* @details		It is called by timer thread (each tick) when elastic worker count is enabled. It releases
+	*					retired workers, starts new worker when tasks wait too long or retires worker which is idle too
+	*					long. Nothing is done when thread pool lock is held by other thread.
+	* @see			SetElasticWorkers
+	******************************************************************************************************/
+	void AdjustWorkerCount();
+
+	/**************************************************************************************************//**
+	* @brief			Sample throughput.
+	* @details		It is called by timer thread (with thread pool lock). It computes throughput since the last
+	*					sample and climbs target when sample interval has elapsed.
+	* @param[in]	now		Current steady clock time in microseconds.
+	* @see			ClimbTargetWorkerCount
+	******************************************************************************************************/
+	void SampleThroughput(int64_t now);
+
+	/**************************************************************************************************//**
+	* @brief			Climb target count of active workers.
+	* @details		One step of hill climbing (see @ref SetHillClimbing). Parked workers are woken up when target
+	*					is increased.
+	* @param[in]	throughput		Throughput of the last sample (completed tasks per second).
+	******************************************************************************************************/
+	void ClimbTargetWorkerCount(double throughput);
+
 protected:
 	/**************************************************************************************************//**
 	* @brief		Flag if thread pool is running (true) or not (false).
@@ -152,31 +797,13 @@ protected:
 	std::shared_ptr<MsvThreadPool_Factory> m_spFactory;
 
 	/**************************************************************************************************//**
-	* @brief		Shared condition variable.
-	* @details	It is used for worker thread synchronization (wake ups thread if new task is inserted).
-	* @see		AddTask
-	* @see		m_spSharedConditionMutex
-	* @see		m_spSharedConditionPredicate
-	******************************************************************************************************/
-	std::shared_ptr<std::condition_variable> m_spSharedCondition;
-
-	/**************************************************************************************************//**
-	* @brief		Shared condition variable mutex.
-	* @details	Shared mutex for shared condition variable @ref m_spSharedCondition.
-	* @see		AddTask
-	* @see		m_spSharedCondition
-	* @see		m_spSharedConditionPredicate
-	******************************************************************************************************/
-	std::shared_ptr<std::mutex> m_spSharedConditionMutex;
-
-	/**************************************************************************************************//**
-	* @brief		Shared condition variable predicate.
-	* @details	Shared predicate for shared condition variable @ref m_spSharedCondition.
+	* @brief		Idle worker stack.
+	* @details	It is used for worker thread synchronization (wakes up exactly one idle worker for each wake up
+	*				when new task is inserted).
 	* @see		AddTask
-	* @see		m_spSharedCondition
-	* @see		m_spSharedConditionMutex
+	* @see		WakeWorkers
 	******************************************************************************************************/
-	std::shared_ptr<uint64_t> m_spSharedConditionPredicate;
+	std::shared_ptr<MsvIdleWorkerStack> m_spIdleWorkers;
 
 	/**************************************************************************************************//**
 	* @brief		Flag if thread pool stop is requested (true) or not (false).
@@ -187,16 +814,278 @@ protected:
 
 	/**************************************************************************************************//**
 	* @brief		Task queue.
-	* @details	Contains all inserted tasks for execution.
+	* @details	Lock-free queue with priority bands which contains all inserted tasks for execution.
 	* @see		AddTask
+	* @see		GetTask
 	******************************************************************************************************/
-	std::queue<std::shared_ptr<IMsvTask>> m_taskQueue;
+	std::shared_ptr<IMsvPriorityTaskQueue> m_spTaskQueue;
 
 	/**************************************************************************************************//**
 	* @brief		Worker threads.
-	* @details	Contains all worker threads.
+	* @details	Contains all worker threads (index is worker index). Slots of retired workers are empty in elastic
+	*				mode.
 	******************************************************************************************************/
 	std::vector<std::shared_ptr<IMsvUniqueWorker>> m_workers;
+
+	/**************************************************************************************************//**
+	* @brief		Flag if work stealing mode is enabled (true) or not (false).
+	* @see		SetWorkStealing
+	******************************************************************************************************/
+	bool m_workStealing;
+
+	/**************************************************************************************************//**
+	* @brief		Deadline task queue.
+	* @details	Earliest deadline first queue which contains tasks with deadline.
+	* @see		SetDeadlineScheduling
+	******************************************************************************************************/
+	std::shared_ptr<IMsvDeadlineTaskQueue> m_spDeadlineTaskQueue;
+
+	/**************************************************************************************************//**
+	* @brief		Flag if deadline scheduling is enabled (true) or not (false).
+	* @see		SetDeadlineScheduling
+	******************************************************************************************************/
+	bool m_deadlineScheduling;
+
+	/**************************************************************************************************//**
+	* @brief		Flag if expired tasks are dropped (true) or executed (false).
+	* @see		SetDropExpiredTasks
+	******************************************************************************************************/
+	bool m_dropExpiredTasks;
+
+	/**************************************************************************************************//**
+	* @brief		Callback for dropped expired tasks.
+	* @see		SetDropExpiredTasks
+	******************************************************************************************************/
+	std::function<void(std::shared_ptr<IMsvTask>)> m_expiredTaskCallback;
+
+	/**************************************************************************************************//**
+	* @brief		Count of dropped expired tasks.
+	* @see		GetExpiredTaskCount
+	******************************************************************************************************/
+	std::atomic<uint64_t> m_expiredTaskCount;
+
+	/**************************************************************************************************//**
+	* @brief		Worker deques.
+	* @details	Each worker has its own deque in work stealing mode (index of deque is index of worker).
+	* @see		SetWorkStealing
+	******************************************************************************************************/
+	std::vector<std::unique_ptr<MsvTaskDeque>> m_taskDeques;
+
+	/**************************************************************************************************//**
+	* @brief		Count of active workers.
+	* @details	Count of workers which execute (or look for) tasks. Workers are woken up only when some worker
+	*				is idle.
+	******************************************************************************************************/
+	std::atomic<size_t> m_activeWorkers;
+
+	/**************************************************************************************************//**
+	* @brief		Count of waking workers.
+	* @details	Count of workers which have been woken up because of pushed tasks, but they have not started to
+	*				look for tasks yet (another wake up is not needed).
+	******************************************************************************************************/
+	std::atomic<size_t> m_wakingWorkers;
+
+	/**************************************************************************************************//**
+	* @brief		Count of workers (capacity).
+	* @details	Indexes of all workers are lower (it is maximal count of workers in elastic mode). It is zero
+	*				when thread pool is not running (tasks are executed when it starts).
+	* @see		GetWorkerCount
+	******************************************************************************************************/
+	std::atomic<size_t> m_workerCount;
+
+	/**************************************************************************************************//**
+	* @brief		Count of running workers.
+	* @details	Idle workers are counted from it (retiring workers are not counted).
+	* @see		GetRunningWorkerCount
+	******************************************************************************************************/
+	std::atomic<size_t> m_runningWorkers;
+
+	/**************************************************************************************************//**
+	* @brief		Minimal count of workers (elastic mode).
+	* @see		SetElasticWorkers
+	******************************************************************************************************/
+	uint16_t m_minWorkers;
+
+	/**************************************************************************************************//**
+	* @brief		Maximal count of workers (0 means that elastic mode is disabled).
+	* @see		SetElasticWorkers
+	******************************************************************************************************/
+	uint16_t m_maxWorkers;
+
+	/**************************************************************************************************//**
+	* @brief		Time in microseconds after which idle worker is retired.
+	* @see		SetElasticWorkers
+	******************************************************************************************************/
+	int32_t m_keepAlive;
+
+	/**************************************************************************************************//**
+	* @brief		Time in microseconds which tasks can wait for idle worker before new worker is started.
+	* @see		SetElasticWorkers
+	******************************************************************************************************/
+	int32_t m_growThreshold;
+
+	/**************************************************************************************************//**
+	* @brief		Time (steady clock microseconds) since pushed tasks wait for idle worker.
+	* @details	It is set when tasks are pushed and there is no idle worker, it is cleared (0) when any worker
+	*				goes idle.
+	******************************************************************************************************/
+	std::atomic<int64_t> m_saturatedSince;
+
+	/**************************************************************************************************//**
+	* @brief		Maximal count of compensating workers (0 disables compensation).
+	* @see		SetCompensatingWorkers
+	******************************************************************************************************/
+	uint16_t m_maxCompensatingWorkers;
+
+	/**************************************************************************************************//**
+	* @brief		Count of workers in blocking region.
+	* @details	Blocked workers are not active, the same count of other workers can execute tasks instead.
+	* @see		EnterBlockingRegion
+	******************************************************************************************************/
+	std::atomic<size_t> m_blockedWorkers;
+
+	/**************************************************************************************************//**
+	* @brief		Time (steady clock microseconds) since each worker is idle (0 when it executes tasks).
+	* @details	It exists in elastic mode only (each worker writes its own cache line).
+	******************************************************************************************************/
+	std::unique_ptr<MsvCacheLinePadded<std::atomic<int64_t>>[]> m_workerIdleSince;
+
+	/**************************************************************************************************//**
+	* @brief		Flags if worker is retiring (it has been requested to stop).
+	* @details	It is used with thread pool lock @ref m_lock only.
+	******************************************************************************************************/
+	std::vector<bool> m_retiringWorkers;
+
+	/**************************************************************************************************//**
+	* @brief		Flag if hill climbing is enabled (true) or not (false).
+	* @see		SetHillClimbing
+	******************************************************************************************************/
+	bool m_hillClimbing;
+
+	/**************************************************************************************************//**
+	* @brief		Hill climbing sample interval in microseconds.
+	* @see		SetHillClimbing
+	******************************************************************************************************/
+	int32_t m_sampleInterval;
+
+	/**************************************************************************************************//**
+	* @brief		Target count of active workers.
+	* @details	Workers over the target are parked (it is count of workers when hill climbing is disabled).
+	* @see		SetHillClimbing
+	******************************************************************************************************/
+	std::atomic<size_t> m_targetWorkers;
+
+	/**************************************************************************************************//**
+	* @brief		Completed tasks of each worker.
+	* @details	It exists when hill climbing is enabled only (each worker writes its own cache line).
+	******************************************************************************************************/
+	std::unique_ptr<MsvCacheLinePadded<std::atomic<uint64_t>>[]> m_completedTasks;
+
+	/**************************************************************************************************//**
+	* @brief		Time (steady clock microseconds) of the last throughput sample.
+	******************************************************************************************************/
+	int64_t m_lastSampleTime;
+
+	/**************************************************************************************************//**
+	* @brief		Count of completed tasks at the last throughput sample.
+	******************************************************************************************************/
+	uint64_t m_lastCompletedTasks;
+
+	/**************************************************************************************************//**
+	* @brief		Throughput of the last sample (completed tasks per second).
+	******************************************************************************************************/
+	double m_lastThroughput;
+
+	/**************************************************************************************************//**
+	* @brief		Direction of hill climbing (+1 more workers, -1 fewer workers).
+	******************************************************************************************************/
+	int32_t m_climbDirection;
+
+	/**************************************************************************************************//**
+	* @brief		Count of samples without significant throughput change since the last target change.
+	* @see		MSV_HILL_CLIMBING_HOLD_SAMPLES
+	******************************************************************************************************/
+	uint32_t m_flatSamples;
+
+	/**************************************************************************************************//**
+	* @brief		Dequeue batch size.
+	* @see		SetDequeueBatchSize
+	******************************************************************************************************/
+	std::atomic<size_t> m_dequeueBatchSize;
+
+	/**************************************************************************************************//**
+	* @brief		Count of idle spins before worker yields.
+	* @see		SetIdleStrategy
+	******************************************************************************************************/
+	std::atomic<uint32_t> m_idleSpinCount;
+
+	/**************************************************************************************************//**
+	* @brief		Count of idle yields before worker parks.
+	* @see		SetIdleStrategy
+	******************************************************************************************************/
+	std::atomic<uint32_t> m_idleYieldCount;
+
+	/**************************************************************************************************//**
+	* @brief		Queue full policy.
+	* @see		SetQueueFullPolicy
+	******************************************************************************************************/
+	std::atomic<MsvQueueFullPolicy> m_queueFullPolicy;
+
+	/**************************************************************************************************//**
+	* @brief		Queue full timeout (in microseconds).
+	* @see		SetQueueFullPolicy
+	******************************************************************************************************/
+	std::atomic<int32_t> m_queueFullTimeout;
+
+	/**************************************************************************************************//**
+	* @brief		Queue full count.
+	* @see		GetQueueFullCount
+	******************************************************************************************************/
+	std::atomic<uint64_t> m_queueFullCount;
+
+	/**************************************************************************************************//**
+	* @brief		Timer wheel.
+	* @details	Contains delayed tasks which have not expired yet.
+	* @see		AddDelayedTask
+	******************************************************************************************************/
+	std::shared_ptr<IMsvTimerWheel> m_spTimerWheel;
+
+	/**************************************************************************************************//**
+	* @brief		Timer thread.
+	* @details	It is created with the first delayed task (see @ref StartTimerThread).
+	******************************************************************************************************/
+	std::shared_ptr<IMsvUniqueWorker> m_spTimerWorker;
+
+	/**************************************************************************************************//**
+	* @brief		Flag if timer thread is running (true) or not (false).
+	* @details	It allows to add delayed tasks without thread pool lock.
+	******************************************************************************************************/
+	std::atomic<bool> m_timerThreadStarted;
+
+	/**************************************************************************************************//**
+	* @brief		Expired delayed tasks.
+	* @details	It is used only by timer thread (its capacity is reused).
+	* @see		ProcessTimers
+	******************************************************************************************************/
+	std::vector<std::shared_ptr<IMsvTask>> m_expiredTimerTasks;
+
+	/**************************************************************************************************//**
+	* @brief		Periodic tasks lock.
+	* @see		m_periodicTasks
+	******************************************************************************************************/
+	std::mutex m_periodicTaskLock;
+
+	/**************************************************************************************************//**
+	* @brief		Periodic tasks (identifier is key).
+	* @details	Periodic tasks are here until they are cancelled.
+	* @see		AddPeriodicTask
+	******************************************************************************************************/
+	std::map<uint64_t, std::shared_ptr<MsvPeriodicTask>> m_periodicTasks;
+
+	/**************************************************************************************************//**
+	* @brief		Identifier of the next periodic task.
+	******************************************************************************************************/
+	std::atomic<uint64_t> m_nextPeriodicTaskId;
 };
 
 
@@ -39,6 +39,10 @@ along with Foobar. If not, see <https://www.gnu.org/licenses/>.
 #include "mdi/MdiFactory.h"
 
 #include "MsvTask.h"
+#include "MsvTaskQueue.h"
+#include "MsvPriorityTaskQueue.h"
+#include "MsvDeadlineTaskQueue.h"
+#include "MsvTimerWheel.h"
 #include "MsvUniqueWorker.h"
 
 MSV_DISABLE_ALL_WARNINGS
@@ -56,7 +60,12 @@ MSV_ENABLE_WARNINGS
 MSV_FACTORY_START(MsvThreadPool_Factory)
 MSV_FACTORY_GET_1(IMsvTask, MsvTask, std::function<void()>&);
 MSV_FACTORY_GET_2(IMsvTask, MsvTask, std::function<void(void*)>&, void*);
+MSV_FACTORY_GET_1(IMsvTaskQueue, MsvTaskQueue, size_t);
+MSV_FACTORY_GET_1(IMsvPriorityTaskQueue, MsvPriorityTaskQueue, size_t);
+MSV_FACTORY_GET_1(IMsvDeadlineTaskQueue, MsvDeadlineTaskQueue, size_t);
+MSV_FACTORY_GET_1(IMsvTimerWheel, MsvTimerWheel, int32_t);
 MSV_FACTORY_GET_3(IMsvUniqueWorker, MsvUniqueWorker, std::shared_ptr<std::condition_variable>, std::shared_ptr<std::mutex>, std::shared_ptr<uint64_t>);
+MSV_FACTORY_GET_1(IMsvUniqueWorker, MsvUniqueWorker, std::shared_ptr<MsvIdleWorkerStack>);
 MSV_FACTORY_END
 
 
@@ -0,0 +1,60 @@
+/**************************************************************************************************//**
+* @addtogroup	MTHREADING
+* @{
+******************************************************************************************************/
+
+/**************************************************************************************************//**
+* @file
+* @brief			MarsTech Threading Error Codes
+* @details		Contains error codes specific to MarsTech Threading (common error codes are defined in
+*					MarsTech Error Handling library).
+* @author		Martin Svoboda
+* @date			16.10.2026
+* @copyright	GNU General Public License (GPLv3).
+******************************************************************************************************/
+
+
+/*
+This file is part of MarsTech Threading.
+
+MarsTech Dependency Injection is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+MarsTech Promise Like Syntax is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with Foobar. If not, see <https://www.gnu.org/licenses/>.
+*/
+
+
+#ifndef MARSTECH_THREADINGERRORCODES_H
+#define MARSTECH_THREADINGERRORCODES_H
+
+
+#include "merror/MsvErrorCodes.h"
+
+
+/**************************************************************************************************//**
+* @brief		Queue is full.
+* @details	Task has not been added, because task queue is full (or it has been full until timeout).
+* @see		MsvQueueFullPolicy
+******************************************************************************************************/
+#define MSV_QUEUE_FULL_ERROR ((MsvErrorCode)0x80100001)
+
+/**************************************************************************************************//**
+* @brief		Timer is not pending.
+* @details	Timer has not been cancelled, because it has been already executed (or cancelled) or it does not
+*				exist at all.
+* @see		MsvTimerWheel
+******************************************************************************************************/
+#define MSV_NOT_PENDING_INFO ((MsvErrorCode)0x00100001)
+
+
+#endif // MARSTECH_THREADINGERRORCODES_H
+
+/** @} */	//End of group MTHREADING.
@@ -0,0 +1,312 @@
+/**************************************************************************************************//**
+* @addtogroup	MTHREADING
+* @{
+******************************************************************************************************/
+
+/**************************************************************************************************//**
+* @file
+* @brief			MarsTech Timer Wheel
+* @details		Contains implementation of @ref MsvTimerWheel.
+* @author		Martin Svoboda
+* @date			16.10.2026
+* @copyright	GNU General Public License (GPLv3).
+******************************************************************************************************/
+
+
+/*
+This file is part of MarsTech Threading.
+
+MarsTech Dependency Injection is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+MarsTech Promise Like Syntax is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with Foobar. If not, see <https://www.gnu.org/licenses/>.
+*/
+
+
+#include "MsvTimerWheel.h"
+
+
+/********************************************************************************************************************************
+*															Static members
+********************************************************************************************************************************/
+
+
+const uint32_t MsvTimerWheel::MSV_TIMER_WHEEL_SLOT_BITS;
+const uint32_t MsvTimerWheel::MSV_TIMER_WHEEL_SLOTS;
+const uint32_t MsvTimerWheel::MSV_TIMER_WHEEL_LEVELS;
+const uint32_t MsvTimerWheel::MSV_TIMER_INVALID_INDEX;
+
+
+/********************************************************************************************************************************
+*															Constructors and destructors
+********************************************************************************************************************************/
+
+
+MsvTimerWheel::MsvTimerWheel(int32_t resolution, std::chrono::steady_clock::time_point startTime):
+	m_resolution(resolution > 0 ? resolution : 1),
+	m_startTime(startTime),
+	m_currentTick(0),
+	m_freeTimer(MSV_TIMER_INVALID_INDEX),
+	m_size(0)
+{
+	for (uint32_t slot = 0; slot < MSV_TIMER_WHEEL_LEVELS * MSV_TIMER_WHEEL_SLOTS; ++slot)
+	{
+		m_slots[slot] = MSV_TIMER_INVALID_INDEX;
+	}
+}
+
+MsvTimerWheel::~MsvTimerWheel()
+{
+
+}
+
+
+/********************************************************************************************************************************
+*															IMsvTimerWheel public methods
+********************************************************************************************************************************/
+
+
+bool MsvTimerWheel::AddTimer(std::shared_ptr<IMsvTask> spTask, std::chrono::steady_clock::time_point expiration, uint64_t& timerId)
+{
+	std::lock_guard<std::mutex> lock(m_lock);
+
+	//reuse free timer or create new one
+	uint32_t index = m_freeTimer;
+	if (index != MSV_TIMER_INVALID_INDEX)
+	{
+		m_freeTimer = m_timers[index].next;
+	}
+	else
+	{
+		if (m_timers.size() >= MSV_TIMER_INVALID_INDEX)
+		{
+			return false;
+		}
+
+		try
+		{
+			MsvTimer timer = { nullptr, 0, 1, MSV_TIMER_INVALID_INDEX, MSV_TIMER_INVALID_INDEX, MSV_TIMER_INVALID_INDEX };
+			m_timers.push_back(timer);
+		}
+		catch (...)
+		{
+			//allocation failed
+			return false;
+		}
+
+		index = static_cast<uint32_t>(m_timers.size() - 1);
+	}
+
+	//timer expires at the next tick at least
+	MsvTimer& timer = m_timers[index];
+	timer.spTask = spTask;
+	timer.expirationTick = (std::max)(GetTick(expiration), m_currentTick + 1);
+	InsertTimer(index);
+	++m_size;
+
+	timerId = (static_cast<uint64_t>(timer.generation) << 32) | index;
+
+	return true;
+}
+
+bool MsvTimerWheel::CancelTimer(uint64_t timerId)
+{
+	std::lock_guard<std::mutex> lock(m_lock);
+
+	uint32_t index = static_cast<uint32_t>(timerId & 0xFFFFFFFF);
+	uint32_t generation = static_cast<uint32_t>(timerId >> 32);
+
+	//released timer has different generation (or it is in free list)
+	if (index >= m_timers.size() || m_timers[index].generation != generation || m_timers[index].slot == MSV_TIMER_INVALID_INDEX)
+	{
+		return false;
+	}
+
+	RemoveTimer(index);
+	ReleaseTimer(index, nullptr);
+
+	return true;
+}
+
+size_t MsvTimerWheel::Advance(std::chrono::steady_clock::time_point now, std::vector<std::shared_ptr<IMsvTask>>& expiredTasks)
+{
+	std::lock_guard<std::mutex> lock(m_lock);
+
+	//current tick is rounded down (timer expires when whole tick elapsed)
+	uint64_t nowTick = now > m_startTime ? static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::microseconds>(now - m_startTime).count()) / m_resolution : 0;
+	size_t count = 0;
+
+	//empty wheel skips all ticks at once
+	while (m_currentTick < nowTick && m_size.load(std::memory_order_relaxed))
+	{
+		++m_currentTick;
+
+		//move timers from higher levels when wheel time reaches their slot
+		for (uint32_t level = MSV_TIMER_WHEEL_LEVELS - 1; level > 0; --level)
+		{
+			uint32_t shift = MSV_TIMER_WHEEL_SLOT_BITS * level;
+			if (!(m_currentTick & ((static_cast<uint64_t>(1) << shift) - 1)))
+			{
+				count += CascadeSlot(level * MSV_TIMER_WHEEL_SLOTS + static_cast<uint32_t>((m_currentTick >> shift) & (MSV_TIMER_WHEEL_SLOTS - 1)), expiredTasks);
+			}
+		}
+
+		//all timers in the lowest level slot expire now
+		uint32_t slot = static_cast<uint32_t>(m_currentTick & (MSV_TIMER_WHEEL_SLOTS - 1));
+		while (m_slots[slot] != MSV_TIMER_INVALID_INDEX)
+		{
+			uint32_t index = m_slots[slot];
+			RemoveTimer(index);
+			ReleaseTimer(index, &expiredTasks);
+			++count;
+		}
+	}
+
+	if (m_currentTick < nowTick)
+	{
+		m_currentTick = nowTick;
+	}
+
+	return count;
+}
+
+size_t MsvTimerWheel::GetSize() const
+{
+	return m_size.load();
+}
+
+int32_t MsvTimerWheel::GetResolution() const
+{
+	return m_resolution;
+}
+
+
+/********************************************************************************************************************************
+*															MsvTimerWheel protected methods
+********************************************************************************************************************************/
+
+
+uint64_t MsvTimerWheel::GetTick(std::chrono::steady_clock::time_point time) const
+{
+	if (time <= m_startTime)
+	{
+		return 0;
+	}
+
+	uint64_t elapsed = static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::microseconds>(time - m_startTime).count());
+
+	return (elapsed + m_resolution - 1) / m_resolution;
+}
+
+bool MsvTimerWheel::InsertTimer(uint32_t index)
+{
+	MsvTimer& timer = m_timers[index];
+	if (timer.expirationTick <= m_currentTick)
+	{
+		return false;
+	}
+
+	//the lowest level which covers the expiration
+	uint64_t delta = timer.expirationTick - m_currentTick;
+	uint64_t tick = timer.expirationTick;
+	uint32_t level = 0;
+	while (level < MSV_TIMER_WHEEL_LEVELS - 1 && delta >= (static_cast<uint64_t>(1) << (MSV_TIMER_WHEEL_SLOT_BITS * (level + 1))))
+	{
+		++level;
+	}
+
+	if (delta >= (static_cast<uint64_t>(1) << (MSV_TIMER_WHEEL_SLOT_BITS * MSV_TIMER_WHEEL_LEVELS)))
+	{
+		//too far -> the farthest slot of top level (it is cascaded and inserted again later)
+		tick = m_currentTick + (static_cast<uint64_t>(1) << (MSV_TIMER_WHEEL_SLOT_BITS * MSV_TIMER_WHEEL_LEVELS)) - 1;
+	}
+
+	uint32_t slot = level * MSV_TIMER_WHEEL_SLOTS + static_cast<uint32_t>((tick >> (MSV_TIMER_WHEEL_SLOT_BITS * level)) & (MSV_TIMER_WHEEL_SLOTS - 1));
+
+	//insert to the head of slot list
+	timer.slot = slot;
+	timer.prev = MSV_TIMER_INVALID_INDEX;
+	timer.next = m_slots[slot];
+	if (timer.next != MSV_TIMER_INVALID_INDEX)
+	{
+		m_timers[timer.next].prev = index;
+	}
+	m_slots[slot] = index;
+
+	return true;
+}
+
+void MsvTimerWheel::RemoveTimer(uint32_t index)
+{
+	MsvTimer& timer = m_timers[index];
+
+	if (timer.prev != MSV_TIMER_INVALID_INDEX)
+	{
+		m_timers[timer.prev].next = timer.next;
+	}
+	else
+	{
+		m_slots[timer.slot] = timer.next;
+	}
+
+	if (timer.next != MSV_TIMER_INVALID_INDEX)
+	{
+		m_timers[timer.next].prev = timer.prev;
+	}
+
+	timer.slot = MSV_TIMER_INVALID_INDEX;
+	timer.prev = MSV_TIMER_INVALID_INDEX;
+	timer.next = MSV_TIMER_INVALID_INDEX;
+}
+
+void MsvTimerWheel::ReleaseTimer(uint32_t index, std::vector<std::shared_ptr<IMsvTask>>* pExpiredTasks)
+{
+	MsvTimer& timer = m_timers[index];
+
+	if (pExpiredTasks)
+	{
+		pExpiredTasks->push_back(std::move(timer.spTask));
+	}
+	timer.spTask.reset();
+
+	//new generation -> old timer identifier is not valid anymore
+	++timer.generation;
+	timer.next = m_freeTimer;
+	m_freeTimer = index;
+	--m_size;
+}
+
+size_t MsvTimerWheel::CascadeSlot(uint32_t slot, std::vector<std::shared_ptr<IMsvTask>>& expiredTasks)
+{
+	size_t count = 0;
+
+	//detach whole slot list and insert its timers again
+	uint32_t index = m_slots[slot];
+	m_slots[slot] = MSV_TIMER_INVALID_INDEX;
+
+	while (index != MSV_TIMER_INVALID_INDEX)
+	{
+		uint32_t next = m_timers[index].next;
+
+		m_timers[index].slot = MSV_TIMER_INVALID_INDEX;
+		if (!InsertTimer(index))
+		{
+			ReleaseTimer(index, &expiredTasks);
+			++count;
+		}
+
+		index = next;
+	}
+
+	return count;
+}
+
+/** @} */	//End of group MTHREADING.
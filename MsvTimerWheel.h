@@ -0,0 +1,223 @@
+/**************************************************************************************************//**
+* @addtogroup	MTHREADING
+* @{
+******************************************************************************************************/
+
+/**************************************************************************************************//**
+* @file
+* @brief			MarsTech Timer Wheel
+* @details		Contains implementation of hierarchical timer wheel @ref MsvTimerWheel.
+* @author		Martin Svoboda
+* @date			16.10.2026
+* @copyright	GNU General Public License (GPLv3).
+******************************************************************************************************/
+
+
+/*
+This file is part of MarsTech Threading.
+
+MarsTech Dependency Injection is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+MarsTech Promise Like Syntax is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with Foobar. If not, see <https://www.gnu.org/licenses/>.
+*/
+
+
+#ifndef MARSTECH_TIMERWHEEL_H
+#define MARSTECH_TIMERWHEEL_H
+
+
+#include "IMsvTimerWheel.h"
+
+MSV_DISABLE_ALL_WARNINGS
+
+#include <atomic>
+#include <mutex>
+
+MSV_ENABLE_WARNINGS
+
+
+/**************************************************************************************************//**
+* @brief		MarsTech Timer Wheel Implementation.
+* @details	Hierarchical timing wheel with @ref MSV_TIMER_WHEEL_LEVELS levels of @ref MSV_TIMER_WHEEL_SLOTS
+*				slots. Timer is stored in the lowest level which covers its expiration and it is moved (cascaded)
+*				to lower levels when wheel time reaches its slot. Each slot is intrusive doubly linked list of
+*				timers, so add and cancel are O(1). Timers are stored in one vector (indexes are used instead
+*				of pointers) and timer identifier contains generation of the timer, so expired or cancelled
+*				timer can't be cancelled by mistake.
+* @note		Timers which expire later than the top level covers are cascaded repeatedly until they fit.
+* @see		IMsvTimerWheel
+******************************************************************************************************/
+class MsvTimerWheel:
+	public IMsvTimerWheel
+{
+public:
+	/**************************************************************************************************//**
+	* @brief			Constructor.
+	* @param[in]	resolution		Length of one tick in microseconds.
+	* @param[in]	startTime		Wheel start time (tick zero).
+	******************************************************************************************************/
+	MsvTimerWheel(int32_t resolution = 1000, std::chrono::steady_clock::time_point startTime = std::chrono::steady_clock::now());
+
+	/**************************************************************************************************//**
+	* @brief		Virtual destructor.
+	******************************************************************************************************/
+	virtual ~MsvTimerWheel();
+
+	/**************************************************************************************************//**
+	* @copydoc IMsvTimerWheel::AddTimer(std::shared_ptr<IMsvTask> spTask, std::chrono::steady_clock::time_point expiration, uint64_t& timerId)
+	******************************************************************************************************/
+	virtual bool AddTimer(std::shared_ptr<IMsvTask> spTask, std::chrono::steady_clock::time_point expiration, uint64_t& timerId) override;
+
+	/**************************************************************************************************//**
+	* @copydoc IMsvTimerWheel::CancelTimer(uint64_t timerId)
+	******************************************************************************************************/
+	virtual bool CancelTimer(uint64_t timerId) override;
+
+	/**************************************************************************************************//**
+	* @copydoc IMsvTimerWheel::Advance(std::chrono::steady_clock::time_point now, std::vector<std::shared_ptr<IMsvTask>>& expiredTasks)
+	******************************************************************************************************/
+	virtual size_t Advance(std::chrono::steady_clock::time_point now, std::vector<std::shared_ptr<IMsvTask>>& expiredTasks) override;
+
+	/**************************************************************************************************//**
+	* @copydoc IMsvTimerWheel::GetSize()
+	******************************************************************************************************/
+	virtual size_t GetSize() const override;
+
+	/**************************************************************************************************//**
+	* @copydoc IMsvTimerWheel::GetResolution()
+	******************************************************************************************************/
+	virtual int32_t GetResolution() const override;
+
+public:
+	/**************************************************************************************************//**
+	* @brief		Count of bits of slot index.
+	******************************************************************************************************/
+	static const uint32_t MSV_TIMER_WHEEL_SLOT_BITS = 6;
+
+	/**************************************************************************************************//**
+	* @brief		Count of slots in one level.
+	******************************************************************************************************/
+	static const uint32_t MSV_TIMER_WHEEL_SLOTS = 1 << MSV_TIMER_WHEEL_SLOT_BITS;
+
+	/**************************************************************************************************//**
+	* @brief		Count of levels (with 1 ms resolution the wheel covers more than 4 hours).
+	******************************************************************************************************/
+	static const uint32_t MSV_TIMER_WHEEL_LEVELS = 4;
+
+protected:
+	/**************************************************************************************************//**
+	* @brief		Invalid timer index (end of list).
+	******************************************************************************************************/
+	static const uint32_t MSV_TIMER_INVALID_INDEX = 0xFFFFFFFF;
+
+	/**************************************************************************************************//**
+	* @brief		Timer.
+	* @details	Timer is in slot list (slot is valid) or in free list (slot is invalid).
+	******************************************************************************************************/
+	struct MsvTimer
+	{
+		std::shared_ptr<IMsvTask> spTask;
+		uint64_t expirationTick;
+		uint32_t generation;
+		uint32_t slot;
+		uint32_t prev;
+		uint32_t next;
+	};
+
+	/**************************************************************************************************//**
+	* @brief			Convert time to tick (rounded up).
+	* @param[in]	time		Time.
+	* @returns		uint64_t
+	******************************************************************************************************/
+	uint64_t GetTick(std::chrono::steady_clock::time_point time) const;
+
+	/**************************************************************************************************//**
+	* @brief			Insert timer to slot.
+	* @details		Selects level and slot by expiration tick of the timer (relative to current tick).
+	* @param[in]	index		Timer index.
+	* @returns		bool
+	* @retval		true	When timer has been inserted.
+	* @retval		false	When timer has already expired (it is not inserted).
+	******************************************************************************************************/
+	bool InsertTimer(uint32_t index);
+
+	/**************************************************************************************************//**
+	* @brief			Remove timer from its slot.
+	* @param[in]	index		Timer index.
+	******************************************************************************************************/
+	void RemoveTimer(uint32_t index);
+
+	/**************************************************************************************************//**
+	* @brief			Release timer.
+	* @details		Moves task of the timer to expiredTasks (when it is not nullptr) and returns timer to free
+	*					list (generation is incremented).
+	* @param[in]	index				Timer index.
+	* @param[out]	pExpiredTasks	Vector for expired task (nullptr when timer is cancelled).
+	******************************************************************************************************/
+	void ReleaseTimer(uint32_t index, std::vector<std::shared_ptr<IMsvTask>>* pExpiredTasks);
+
+	/**************************************************************************************************//**
+	* @brief			Cascade slot.
+	* @details		Moves all timers from the slot to lower levels (or to expiredTasks when they expired).
+	* @param[in]	slot				Slot (level * @ref MSV_TIMER_WHEEL_SLOTS + slot index).
+	* @param[out]	expiredTasks	Vector for expired tasks.
+	* @returns		size_t
+	* @retval		count of expired timers.
+	******************************************************************************************************/
+	size_t CascadeSlot(uint32_t slot, std::vector<std::shared_ptr<IMsvTask>>& expiredTasks);
+
+protected:
+	/**************************************************************************************************//**
+	* @brief		Tick length in microseconds.
+	******************************************************************************************************/
+	int32_t m_resolution;
+
+	/**************************************************************************************************//**
+	* @brief		Wheel start time (tick zero).
+	******************************************************************************************************/
+	std::chrono::steady_clock::time_point m_startTime;
+
+	/**************************************************************************************************//**
+	* @brief		Wheel lock.
+	******************************************************************************************************/
+	std::mutex m_lock;
+
+	/**************************************************************************************************//**
+	* @brief		Current tick (all timers up to this tick have expired).
+	******************************************************************************************************/
+	uint64_t m_currentTick;
+
+	/**************************************************************************************************//**
+	* @brief		Slots (index of the first timer in slot list).
+	******************************************************************************************************/
+	uint32_t m_slots[MSV_TIMER_WHEEL_LEVELS * MSV_TIMER_WHEEL_SLOTS];
+
+	/**************************************************************************************************//**
+	* @brief		All timers (pending and free).
+	******************************************************************************************************/
+	std::vector<MsvTimer> m_timers;
+
+	/**************************************************************************************************//**
+	* @brief		The first free timer.
+	******************************************************************************************************/
+	uint32_t m_freeTimer;
+
+	/**************************************************************************************************//**
+	* @brief		Count of pending timers.
+	******************************************************************************************************/
+	std::atomic<size_t> m_size;
+};
+
+
+#endif // MARSTECH_TIMERWHEEL_H
+
+/** @} */	//End of group MTHREADING.
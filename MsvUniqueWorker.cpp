@@ -56,6 +56,13 @@ MsvUniqueWorker::MsvUniqueWorker(std::shared_ptr<std::condition_variable> spCond
 
 }
 
+MsvUniqueWorker::MsvUniqueWorker(std::shared_ptr<MsvIdleWorkerStack> spIdleWorkers, std::shared_ptr<MsvWorker_Factory> spFactory):
+	MsvThread(spIdleWorkers),
+	m_spFactory(spFactory ? spFactory : MsvWorker_Factory::Get())
+{
+
+}
+
 MsvUniqueWorker::~MsvUniqueWorker()
 {
 }
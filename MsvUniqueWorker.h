@@ -80,6 +80,16 @@ public:
 	******************************************************************************************************/
 	MsvUniqueWorker(std::shared_ptr<std::condition_variable> spConditionVariable, std::shared_ptr<std::mutex> spConditionVariableMutex, std::shared_ptr<uint64_t> spConditionVariablePredicate, std::shared_ptr<MsvWorker_Factory> spFactory = nullptr);
 
+	/**************************************************************************************************//**
+	* @brief			Constructor.
+	* @details		Constructs @ref MsvUniqueWorker with shared idle worker stack.
+	* @param[in]	spIdleWorkers		Shared idle worker stack.
+	* @param[in]	spFactory			Shared pointer to dependency injection factory.
+	* @note			@ref Notify wakes up only this worker.
+	* @see			MsvThread
+	******************************************************************************************************/
+	MsvUniqueWorker(std::shared_ptr<MsvIdleWorkerStack> spIdleWorkers, std::shared_ptr<MsvWorker_Factory> spFactory = nullptr);
+
 	/**************************************************************************************************//**
 	* @brief		Virtual destructor.
 	******************************************************************************************************/
@@ -0,0 +1,199 @@
+/**************************************************************************************************//**
+* @addtogroup	MTHREADING
+* @{
+******************************************************************************************************/
+
+/**************************************************************************************************//**
+* @file
+* @brief			MarsTech Future Combinators
+* @details		Contains implementation of @ref MsvWhenAllState and @ref MsvWhenAnyState.
+* @author		Martin Svoboda
+* @date			16.10.2026
+* @copyright	GNU General Public License (GPLv3).
+******************************************************************************************************/
+
+
+/*
+This file is part of MarsTech Threading.
+
+MarsTech Dependency Injection is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+MarsTech Promise Like Syntax is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with Foobar. If not, see <https://www.gnu.org/licenses/>.
+*/
+
+
+#include "MsvWhen.h"
+
+
+/********************************************************************************************************************************
+*															Constructors and destructors
+********************************************************************************************************************************/
+
+
+MsvWhenAllState::MsvWhenAllState():
+	m_pending(1)
+{
+
+}
+
+MsvWhenAnyState::MsvWhenAnyState():
+	m_pending(1),
+	m_done(false)
+{
+
+}
+
+
+/********************************************************************************************************************************
+*															MsvWhenAllState public methods
+********************************************************************************************************************************/
+
+
+MsvErrorCode MsvWhenAllState::Initialize(std::shared_ptr<MsvWhenAllState> spSelf, size_t count)
+{
+	try
+	{
+		m_callbacks.resize(count);
+	}
+	catch (...)
+	{
+		//allocation failed
+		return MSV_ALLOCATION_ERROR;
+	}
+
+	//one more until all antecedents are added
+	m_pending.store(count + 1);
+	m_spSelf = spSelf;
+
+	return MSV_SUCCESS;
+}
+
+void MsvWhenAllState::AddAntecedent(size_t index, MsvFutureStateBase* pAntecedent)
+{
+	m_callbacks[index].pOwner = this;
+
+	if (pAntecedent)
+	{
+		pAntecedent->AddCallback(&m_callbacks[index]);
+	}
+	else
+	{
+		OnAntecedentReady();
+	}
+}
+
+void MsvWhenAllState::Start()
+{
+	OnAntecedentReady();
+}
+
+
+/********************************************************************************************************************************
+*															MsvWhenAllState protected methods
+********************************************************************************************************************************/
+
+
+void MsvWhenAllState::Execute()
+{
+
+}
+
+void MsvWhenAllState::OnAntecedentReady()
+{
+	if (--m_pending)
+	{
+		return;
+	}
+
+	//the last antecedent -> state is ready (and it is not needed by antecedents anymore)
+	std::shared_ptr<MsvWhenAllState> spSelf(std::move(m_spSelf));
+	auto complete = []() {};
+	Run(complete);
+}
+
+
+/********************************************************************************************************************************
+*															MsvWhenAnyState public methods
+********************************************************************************************************************************/
+
+
+MsvErrorCode MsvWhenAnyState::Initialize(std::shared_ptr<MsvWhenAnyState> spSelf, size_t count)
+{
+	try
+	{
+		m_callbacks.resize(count);
+	}
+	catch (...)
+	{
+		//allocation failed
+		return MSV_ALLOCATION_ERROR;
+	}
+
+	m_pending.store(count + 1);
+	m_spSelf = spSelf;
+
+	return MSV_SUCCESS;
+}
+
+void MsvWhenAnyState::AddAntecedent(size_t index, MsvFutureStateBase* pAntecedent)
+{
+	m_callbacks[index].pOwner = this;
+	m_callbacks[index].index = index;
+
+	if (pAntecedent)
+	{
+		pAntecedent->AddCallback(&m_callbacks[index]);
+	}
+	else
+	{
+		//not valid antecedent is never ready
+		Release();
+	}
+}
+
+void MsvWhenAnyState::Start()
+{
+	Release();
+}
+
+
+/********************************************************************************************************************************
+*															MsvWhenAnyState protected methods
+********************************************************************************************************************************/
+
+
+void MsvWhenAnyState::Execute()
+{
+
+}
+
+void MsvWhenAnyState::OnAntecedentReady(size_t index)
+{
+	if (!m_done.exchange(true))
+	{
+		auto complete = [index]() { return index; };
+		Run(complete);
+	}
+
+	Release();
+}
+
+void MsvWhenAnyState::Release()
+{
+	if (!--m_pending)
+	{
+		//all callbacks have been called -> state is not referenced by antecedents
+		m_spSelf.reset();
+	}
+}
+
+/** @} */	//End of group MTHREADING.
@@ -0,0 +1,295 @@
+/**************************************************************************************************//**
+* @addtogroup	MTHREADING
+* @{
+******************************************************************************************************/
+
+/**************************************************************************************************//**
+* @file
+* @brief			MarsTech Future Combinators
+* @details		Contains declaration of @ref MsvWhenAll and @ref MsvWhenAny.
+* @author		Martin Svoboda
+* @date			16.10.2026
+* @copyright	GNU General Public License (GPLv3).
+******************************************************************************************************/
+
+
+/*
+This file is part of MarsTech Threading.
+
+MarsTech Dependency Injection is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+MarsTech Promise Like Syntax is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with Foobar. If not, see <https://www.gnu.org/licenses/>.
+*/
+
+
+#ifndef MARSTECH_WHEN_H
+#define MARSTECH_WHEN_H
+
+
+#include "MsvFuture.h"
+
+#include "merror/MsvError.h"
+
+MSV_DISABLE_ALL_WARNINGS
+
+#include <atomic>
+#include <memory>
+#include <vector>
+
+MSV_ENABLE_WARNINGS
+
+
+/**************************************************************************************************//**
+* @brief		MarsTech When All State.
+* @details	Future state which becomes ready when all antecedents are ready. It has one callback for each
+*				antecedent (all in one vector) and one atomic countdown. Nobody waits for antecedents (the last
+*				completed antecedent sets ready state).
+* @see		MsvWhenAll
+******************************************************************************************************/
+class MsvWhenAllState:
+	public MsvFutureState<void>
+{
+public:
+	/**************************************************************************************************//**
+	* @brief		Constructor.
+	******************************************************************************************************/
+	MsvWhenAllState();
+
+	/**************************************************************************************************//**
+	* @brief			Initialize state.
+	* @param[in]	spSelf		Shared pointer to this state (it is kept until all antecedents are ready).
+	* @param[in]	count			Count of antecedents.
+	* @returns		MsvErrorCode
+	* @retval		MSV_ALLOCATION_ERROR		When callbacks allocation failed.
+	* @retval		MSV_SUCCESS					On success.
+	******************************************************************************************************/
+	MsvErrorCode Initialize(std::shared_ptr<MsvWhenAllState> spSelf, size_t count);
+
+	/**************************************************************************************************//**
+	* @brief			Add antecedent.
+	* @param[in]	index				Index of antecedent (it must be lower than count).
+	* @param[in]	pAntecedent		Antecedent state (nullptr is counted as ready antecedent).
+	******************************************************************************************************/
+	void AddAntecedent(size_t index, MsvFutureStateBase* pAntecedent);
+
+	/**************************************************************************************************//**
+	* @brief			Start waiting (all antecedents have been added).
+	******************************************************************************************************/
+	void Start();
+
+protected:
+	/**************************************************************************************************//**
+	* @brief			Combined state is not executed as task (it does nothing).
+	******************************************************************************************************/
+	virtual void Execute() override;
+
+	/**************************************************************************************************//**
+	* @brief			Antecedent is ready (count down).
+	******************************************************************************************************/
+	void OnAntecedentReady();
+
+	/**************************************************************************************************//**
+	* @brief		Antecedent callback.
+	******************************************************************************************************/
+	struct MsvWhenAllCallback:
+		public MsvFutureCallback
+	{
+		MsvWhenAllState* pOwner;
+
+		virtual void OnFutureReady() override
+		{
+			pOwner->OnAntecedentReady();
+		}
+	};
+
+protected:
+	/**************************************************************************************************//**
+	* @brief		Antecedent callbacks.
+	******************************************************************************************************/
+	std::vector<MsvWhenAllCallback> m_callbacks;
+
+	/**************************************************************************************************//**
+	* @brief		Count of antecedents which are not ready (plus one until start).
+	******************************************************************************************************/
+	std::atomic<size_t> m_pending;
+
+	/**************************************************************************************************//**
+	* @brief		Reference to this state (it is released when all antecedents are ready).
+	******************************************************************************************************/
+	std::shared_ptr<MsvWhenAllState> m_spSelf;
+};
+
+
+/**************************************************************************************************//**
+* @brief		MarsTech When Any State.
+* @details	Future state which becomes ready when any antecedent is ready (its result is index of the
+*				antecedent). It has one callback for each antecedent (all in one vector) and one atomic countdown
+*				which keeps the state alive until all callbacks are called.
+* @see		MsvWhenAny
+******************************************************************************************************/
+class MsvWhenAnyState:
+	public MsvFutureState<size_t>
+{
+public:
+	/**************************************************************************************************//**
+	* @brief		Constructor.
+	******************************************************************************************************/
+	MsvWhenAnyState();
+
+	/**************************************************************************************************//**
+	* @copydoc MsvWhenAllState::Initialize(std::shared_ptr<MsvWhenAllState> spSelf, size_t count)
+	******************************************************************************************************/
+	MsvErrorCode Initialize(std::shared_ptr<MsvWhenAnyState> spSelf, size_t count);
+
+	/**************************************************************************************************//**
+	* @brief			Add antecedent.
+	* @param[in]	index				Index of antecedent (it must be lower than count).
+	* @param[in]	pAntecedent		Antecedent state (nullptr is never ready).
+	******************************************************************************************************/
+	void AddAntecedent(size_t index, MsvFutureStateBase* pAntecedent);
+
+	/**************************************************************************************************//**
+	* @copydoc MsvWhenAllState::Start()
+	******************************************************************************************************/
+	void Start();
+
+protected:
+	/**************************************************************************************************//**
+	* @copydoc MsvWhenAllState::Execute()
+	******************************************************************************************************/
+	virtual void Execute() override;
+
+	/**************************************************************************************************//**
+	* @brief			Antecedent is ready.
+	* @details		The first ready antecedent sets ready state.
+	* @param[in]	index		Index of antecedent.
+	******************************************************************************************************/
+	void OnAntecedentReady(size_t index);
+
+	/**************************************************************************************************//**
+	* @brief			Release one reference (the last one releases this state).
+	******************************************************************************************************/
+	void Release();
+
+	/**************************************************************************************************//**
+	* @brief		Antecedent callback.
+	******************************************************************************************************/
+	struct MsvWhenAnyCallback:
+		public MsvFutureCallback
+	{
+		MsvWhenAnyState* pOwner;
+		size_t index;
+
+		virtual void OnFutureReady() override
+		{
+			pOwner->OnAntecedentReady(index);
+		}
+	};
+
+protected:
+	/**************************************************************************************************//**
+	* @brief		Antecedent callbacks.
+	******************************************************************************************************/
+	std::vector<MsvWhenAnyCallback> m_callbacks;
+
+	/**************************************************************************************************//**
+	* @brief		Count of callbacks which have not been called (plus one until start).
+	******************************************************************************************************/
+	std::atomic<size_t> m_pending;
+
+	/**************************************************************************************************//**
+	* @brief		Flag if any antecedent is ready (true) or not (false).
+	******************************************************************************************************/
+	std::atomic<bool> m_done;
+
+	/**************************************************************************************************//**
+	* @brief		Reference to this state (it is released when all callbacks have been called).
+	******************************************************************************************************/
+	std::shared_ptr<MsvWhenAnyState> m_spSelf;
+};
+
+
+/**************************************************************************************************//**
+* @brief			Create future which is ready when all futures are ready.
+* @details		Joining does not block any thread and it needs one combined state (with one atomic countdown)
+*					for all futures. Results are taken from the original futures (they are ready then).
+* @param[in]	futures		Futures (not valid futures are treated as ready).
+* @returns		MsvFuture<void>
+* @retval		not valid future when allocation failed.
+* @note			Combined future has executor of the first future (for its continuations).
+******************************************************************************************************/
+template<typename T>
+MsvFuture<void> MsvWhenAll(const std::vector<MsvFuture<T>>& futures)
+{
+	std::shared_ptr<MsvWhenAllState> spState(new (std::nothrow) MsvWhenAllState());
+	if (!spState)
+	{
+		return MsvFuture<void>(MSV_ALLOCATION_ERROR);
+	}
+
+	MsvErrorCode errorCode = spState->Initialize(spState, futures.size());
+	if (MSV_FAILED(errorCode))
+	{
+		return MsvFuture<void>(errorCode);
+	}
+
+	for (size_t i = 0; i < futures.size(); ++i)
+	{
+		spState->AddAntecedent(i, futures[i].GetState().get());
+	}
+	spState->Start();
+
+	return MsvFuture<void>(spState, futures.empty() ? nullptr : futures.front().GetExecutor());
+}
+
+/**************************************************************************************************//**
+* @brief			Create future which is ready when any future is ready.
+* @details		Result of the combined future is index of the first ready future. It does not block any thread
+*					and it needs one combined state for all futures.
+* @param[in]	futures		Futures (not valid futures are never ready).
+* @returns		MsvFuture<size_t>
+* @retval		not valid future when futures are empty or allocation failed.
+* @note			Combined future has executor of the first future (for its continuations).
+******************************************************************************************************/
+template<typename T>
+MsvFuture<size_t> MsvWhenAny(const std::vector<MsvFuture<T>>& futures)
+{
+	if (futures.empty())
+	{
+		return MsvFuture<size_t>(MSV_INVALID_DATA_ERROR);
+	}
+
+	std::shared_ptr<MsvWhenAnyState> spState(new (std::nothrow) MsvWhenAnyState());
+	if (!spState)
+	{
+		return MsvFuture<size_t>(MSV_ALLOCATION_ERROR);
+	}
+
+	MsvErrorCode errorCode = spState->Initialize(spState, futures.size());
+	if (MSV_FAILED(errorCode))
+	{
+		return MsvFuture<size_t>(errorCode);
+	}
+
+	for (size_t i = 0; i < futures.size(); ++i)
+	{
+		spState->AddAntecedent(i, futures[i].GetState().get());
+	}
+	spState->Start();
+
+	return MsvFuture<size_t>(spState, futures.front().GetExecutor());
+}
+
+
+#endif // MARSTECH_WHEN_H
+
+/** @} */	//End of group MTHREADING.
@@ -36,8 +36,15 @@ along with Foobar. If not, see <https://www.gnu.org/licenses/>.
 
 #include "MsvTask.h"
 
+#include "MsvThreadingErrorCodes.h"
 #include "merror/MsvErrorCodes.h"
 
+MSV_DISABLE_ALL_WARNINGS
+
+#include <chrono>
+
+MSV_ENABLE_WARNINGS
+
 
 /********************************************************************************************************************************
 *                                              Constructors and destructors
@@ -52,7 +59,12 @@ MsvWorker::MsvWorker(std::shared_ptr<MsvWorker_Factory> spFactory):
 
 MsvWorker::MsvWorker(std::shared_ptr<std::condition_variable> spConditionVariable, std::shared_ptr<std::mutex> spConditionVariableMutex, std::shared_ptr<uint64_t> spSharedConditionPredicate, std::shared_ptr<MsvWorker_Factory> spFactory):
 	MsvThread(spConditionVariable, spConditionVariableMutex, spSharedConditionPredicate),
-	m_spFactory(spFactory ? spFactory : MsvWorker_Factory::Get())
+	m_spFactory(spFactory ? spFactory : MsvWorker_Factory::Get()),
+	m_taskCapacity(0),
+	m_queueFullPolicy(MsvQueueFullPolicy::MSV_QUEUE_FULL_BLOCK),
+	m_queueFullTimeout(0),
+	m_queueFullCount(0),
+	m_workerThreadId(std::thread::id())
 {
 	
 }
@@ -67,12 +79,9 @@ MsvWorker::~MsvWorker()
 ********************************************************************************************************************************/
 
 
-void MsvWorker::AddTask(std::shared_ptr<IMsvTask> spTask)
+MsvErrorCode MsvWorker::AddTask(std::shared_ptr<IMsvTask> spTask)
 {
-	std::lock_guard<std::recursive_mutex> lock(m_taskLock);
-	m_tasks.push(spTask);
-
-	Notify();
+	return AddTasks(&spTask, 1);
 }
 
 MsvErrorCode MsvWorker::AddTask(std::function<void()>& task)
@@ -85,16 +94,12 @@ MsvErrorCode MsvWorker::AddTask(std::function<void()>& task)
 	}
 
 	//add task to queue
-	if (spTask)
-	{
-		AddTask(spTask);
-	}
-	else
+	if (!spTask)
 	{
 		return MSV_ALLOCATION_ERROR;
 	}
 
-	return MSV_SUCCESS;
+	return AddTask(spTask);
 }
 
 MsvErrorCode MsvWorker::AddTask(std::function<void(void*)>& task, void* pContext)
@@ -107,18 +112,90 @@ MsvErrorCode MsvWorker::AddTask(std::function<void(void*)>& task, void* pContext
 	}
 
 	//add task to queue
-	if (spTask)
+	if (!spTask)
 	{
-		AddTask(spTask);
+		return MSV_ALLOCATION_ERROR;
 	}
-	else
+
+	return AddTask(spTask);
+}
+
+MsvErrorCode MsvWorker::AddTasks(const std::shared_ptr<IMsvTask>* pTasks, size_t count)
+{
+	if (!count)
 	{
-		return MSV_ALLOCATION_ERROR;
+		return MSV_SUCCESS;
+	}
+
+	MsvErrorCode errorCode = MSV_SUCCESS;
+	bool pushed = false;
+
+	//whole batch under one lock
+	std::unique_lock<std::recursive_mutex> lock(m_taskLock);
+	for (size_t i = 0; i < count; ++i)
+	{
+		if (!pTasks[i])
+		{
+			continue;
+		}
+
+		if (m_taskCapacity && m_tasks.size() >= m_taskCapacity)
+		{
+			bool queued = false;
+			errorCode = PushTaskToFullQueue(lock, pTasks[i], pushed, queued);
+			pushed = pushed || queued;
+			if (MSV_FAILED(errorCode))
+			{
+				break;
+			}
+			continue;
+		}
+
+		m_tasks.push(pTasks[i]);
+		pushed = true;
 	}
+	lock.unlock();
+
+	//one notify for whole batch (there is only one worker thread)
+	if (pushed)
+	{
+		Notify();
+	}
+
+	return errorCode;
+}
+
+
+/********************************************************************************************************************************
+*															MsvWorker public methods
+********************************************************************************************************************************/
+
+
+MsvErrorCode MsvWorker::SetTaskQueueCapacity(size_t capacity)
+{
+	std::lock_guard<std::recursive_mutex> lock(m_taskLock);
+	m_taskCapacity = capacity;
+
+	//waiting producers must check new capacity
+	m_taskSpaceCondition.notify_all();
+
+	return MSV_SUCCESS;
+}
+
+MsvErrorCode MsvWorker::SetQueueFullPolicy(MsvQueueFullPolicy policy, int32_t timeout)
+{
+	std::lock_guard<std::recursive_mutex> lock(m_taskLock);
+	m_queueFullPolicy = policy;
+	m_queueFullTimeout = timeout;
 
 	return MSV_SUCCESS;
 }
 
+uint64_t MsvWorker::GetQueueFullCount() const
+{
+	return m_queueFullCount.load(std::memory_order_relaxed);
+}
+
 
 /********************************************************************************************************************************
 *															IMsvThread public methods
@@ -163,6 +240,8 @@ MsvErrorCode MsvWorker::WaitForThreadStop(int32_t timeout)
 
 void MsvWorker::ThreadMain()
 {
+	m_workerThreadId.store(std::this_thread::get_id(), std::memory_order_relaxed);
+
 	std::unique_lock<std::recursive_mutex> lock(m_taskLock);
 
 	while (!m_tasks.empty())
@@ -171,6 +250,12 @@ void MsvWorker::ThreadMain()
 		std::shared_ptr<IMsvTask> spTask = m_tasks.front();
 		m_tasks.pop();
 
+		if (m_taskCapacity && m_tasks.size() + 1 == m_taskCapacity)
+		{
+			//queue is not full anymore -> wake up waiting producers
+			m_taskSpaceCondition.notify_all();
+		}
+
 		if (!spTask)
 		{
 			//task is not valid -> skip to next
@@ -187,4 +272,76 @@ void MsvWorker::ThreadMain()
 }
 
 
+/********************************************************************************************************************************
+*                                              MsvWorker protected methods
+********************************************************************************************************************************/
+
+
+MsvErrorCode MsvWorker::PushTaskToFullQueue(std::unique_lock<std::recursive_mutex>& lock, const std::shared_ptr<IMsvTask>& spTask, bool pushed, bool& queued)
+{
+	queued = false;
+	++m_queueFullCount;
+
+	MsvQueueFullPolicy policy = m_queueFullPolicy;
+	if (policy == MsvQueueFullPolicy::MSV_QUEUE_FULL_BLOCK && m_workerThreadId.load(std::memory_order_relaxed) == std::this_thread::get_id())
+	{
+		//worker can't wait for itself -> it executes the task
+		policy = MsvQueueFullPolicy::MSV_QUEUE_FULL_CALLER_RUNS;
+	}
+
+	switch (policy)
+	{
+	case MsvQueueFullPolicy::MSV_QUEUE_FULL_REJECT:
+		return MSV_QUEUE_FULL_ERROR;
+
+	case MsvQueueFullPolicy::MSV_QUEUE_FULL_DROP_OLDEST:
+		while (!m_tasks.empty() && m_tasks.size() >= m_taskCapacity)
+		{
+			m_tasks.pop();
+		}
+		m_tasks.push(spTask);
+		queued = true;
+		return MSV_SUCCESS;
+
+	case MsvQueueFullPolicy::MSV_QUEUE_FULL_CALLER_RUNS:
+		//execute task without lock (it can add another tasks)
+		lock.unlock();
+		if (pushed)
+		{
+			Notify();
+		}
+		spTask->Execute();
+		lock.lock();
+		return MSV_SUCCESS;
+
+	default:
+		break;
+	}
+
+	//block -> worker must run to make free space
+	if (pushed)
+	{
+		Notify();
+	}
+
+	auto predicate = [this]() { return !m_taskCapacity || m_tasks.size() < m_taskCapacity; };
+	if (m_queueFullTimeout > 0)
+	{
+		if (!m_taskSpaceCondition.wait_for(lock, std::chrono::microseconds(m_queueFullTimeout), predicate))
+		{
+			return MSV_QUEUE_FULL_ERROR;
+		}
+	}
+	else
+	{
+		m_taskSpaceCondition.wait(lock, predicate);
+	}
+
+	m_tasks.push(spTask);
+	queued = true;
+
+	return MSV_SUCCESS;
+}
+
+
 /** @} */	//End of group MTHREADING.
@@ -43,6 +43,9 @@ along with Foobar. If not, see <https://www.gnu.org/licenses/>.
 MSV_DISABLE_ALL_WARNINGS
 
 #include <queue>
+#include <atomic>
+#include <thread>
+#include <condition_variable>
 
 MSV_ENABLE_WARNINGS
 
@@ -98,7 +101,7 @@ public:
 	/**************************************************************************************************//**
 	* @copydoc IMsvWorker::AddTask(std::shared_ptr<IMsvTask> spTask)
 	******************************************************************************************************/
-	virtual void AddTask(std::shared_ptr<IMsvTask> spTask) override;
+	virtual MsvErrorCode AddTask(std::shared_ptr<IMsvTask> spTask) override;
 
 	/**************************************************************************************************//**
 	* @copydoc IMsvWorker::AddTask(std::function<void()>& task)
@@ -110,6 +113,53 @@ public:
 	******************************************************************************************************/
 	virtual MsvErrorCode AddTask(std::function<void(void*)>& task, void* pContext) override;
 
+	/**************************************************************************************************//**
+	* @copydoc IMsvWorker::AddTasks(const std::shared_ptr<IMsvTask>* pTasks, size_t count)
+	******************************************************************************************************/
+	virtual MsvErrorCode AddTasks(const std::shared_ptr<IMsvTask>* pTasks, size_t count) override;
+
+	//batch overloads (range, iterators and initializer list) are hidden by override
+	using IMsvWorker::AddTasks;
+
+	/*-----------------------------------------------------------------------------------------------------
+	**											MsvWorker public methods
+	**---------------------------------------------------------------------------------------------------*/
+public:
+	/**************************************************************************************************//**
+	* @brief			Set task queue capacity.
+	* @details		Bounds count of waiting tasks. Queue full policy is applied when task is added to full
+	*					task queue.
+	* @param[in]	capacity		Task queue capacity (zero means unbounded task queue).
+	* @returns		MsvErrorCode
+	* @retval		MSV_SUCCESS		On success.
+	* @note			Default task queue is unbounded.
+	* @see			SetQueueFullPolicy
+	******************************************************************************************************/
+	virtual MsvErrorCode SetTaskQueueCapacity(size_t capacity);
+
+	/**************************************************************************************************//**
+	* @brief			Set queue full policy.
+	* @details		Sets backpressure policy which is applied when task is added to full task queue.
+	* @param[in]	policy		Queue full policy.
+	* @param[in]	timeout		Maximal time in microseconds for which producer waits for free space (only
+	*									@ref MsvQueueFullPolicy::MSV_QUEUE_FULL_BLOCK policy, zero means no timeout).
+	* @returns		MsvErrorCode
+	* @retval		MSV_SUCCESS		On success.
+	* @note			Default policy is @ref MsvQueueFullPolicy::MSV_QUEUE_FULL_BLOCK without timeout. Worker thread
+	*					never blocks (it executes the task itself).
+	* @see			SetTaskQueueCapacity
+	* @see			GetQueueFullCount
+	******************************************************************************************************/
+	virtual MsvErrorCode SetQueueFullPolicy(MsvQueueFullPolicy policy, int32_t timeout = 0);
+
+	/**************************************************************************************************//**
+	* @brief			Get queue full count.
+	* @details		Returns how many times task has been added to full task queue.
+	* @returns		uint64_t
+	* @see			SetQueueFullPolicy
+	******************************************************************************************************/
+	virtual uint64_t GetQueueFullCount() const;
+
 	/*-----------------------------------------------------------------------------------------------------
 	**											IMsvThread public methods
 	**---------------------------------------------------------------------------------------------------*/
@@ -150,6 +200,26 @@ protected:
 	******************************************************************************************************/
 	virtual void ThreadMain() override;
 
+	/*-----------------------------------------------------------------------------------------------------
+	**											MsvWorker protected methods
+	**---------------------------------------------------------------------------------------------------*/
+protected:
+	/**************************************************************************************************//**
+	* @brief				Push task to full queue.
+	* @details			Applies queue full policy (task is pushed, executed or rejected) and counts queue full
+	*						event.
+	* @param[in,out]	lock		Locked task queue lock (it can be unlocked during waiting or task execution).
+	* @param[in]		spTask	Shared pointer to task.
+	* @param[in]		pushed	Flag if some task has been pushed by caller (worker must be notified before
+	*									waiting).
+	* @param[out]		queued	Flag if task has been pushed to the queue (true) or not (false).
+	* @returns			MsvErrorCode
+	* @retval			MSV_QUEUE_FULL_ERROR		When task has been rejected (or wait for free space timed out).
+	* @retval			MSV_SUCCESS					On success (task has been pushed or executed).
+	* @see				SetQueueFullPolicy
+	******************************************************************************************************/
+	MsvErrorCode PushTaskToFullQueue(std::unique_lock<std::recursive_mutex>& lock, const std::shared_ptr<IMsvTask>& spTask, bool pushed, bool& queued);
+
 protected:
 	/**************************************************************************************************//**
 	* @brief		Dependency injection factory.
@@ -169,6 +239,42 @@ protected:
 	* @details	Contains all jobs/tasks to execute. It is queue without priorities (first in first out).
 	******************************************************************************************************/
 	std::queue<std::shared_ptr<IMsvTask>> m_tasks;
+
+	/**************************************************************************************************//**
+	* @brief		Task queue capacity (zero means unbounded).
+	* @see		SetTaskQueueCapacity
+	******************************************************************************************************/
+	size_t m_taskCapacity;
+
+	/**************************************************************************************************//**
+	* @brief		Queue full policy.
+	* @see		SetQueueFullPolicy
+	******************************************************************************************************/
+	MsvQueueFullPolicy m_queueFullPolicy;
+
+	/**************************************************************************************************//**
+	* @brief		Queue full timeout (in microseconds).
+	* @see		SetQueueFullPolicy
+	******************************************************************************************************/
+	int32_t m_queueFullTimeout;
+
+	/**************************************************************************************************//**
+	* @brief		Queue full count.
+	* @see		GetQueueFullCount
+	******************************************************************************************************/
+	std::atomic<uint64_t> m_queueFullCount;
+
+	/**************************************************************************************************//**
+	* @brief		Task space condition.
+	* @details	Producers wait on it for free space in full task queue.
+	******************************************************************************************************/
+	std::condition_variable_any m_taskSpaceCondition;
+
+	/**************************************************************************************************//**
+	* @brief		Worker thread id.
+	* @details	It is used to detect tasks added by worker thread itself (they must not wait for free space).
+	******************************************************************************************************/
+	std::atomic<std::thread::id> m_workerThreadId;
 };
 
 
@@ -0,0 +1,55 @@
+#include "pch.h"
+
+
+#include "mthreading\MsvBlockingScope.h"
+
+#include "mthreading\Mocks\MsvThreadPool_Mock.h"
+
+
+using namespace ::testing;
+
+
+class MsvBlockingScopeTests:
+	public::testing::Test
+{
+public:
+	MsvBlockingScopeTests()
+	{
+
+	}
+
+	virtual void SetUp()
+	{
+		m_spThreadPool.reset(new (std::nothrow) MsvThreadPool_Mock());
+		EXPECT_NE(m_spThreadPool, nullptr);
+	}
+
+	virtual void TearDown()
+	{
+		m_spThreadPool.reset();
+	}
+
+	//mocks
+	std::shared_ptr<MsvThreadPool_Mock> m_spThreadPool;
+};
+
+TEST_F(MsvBlockingScopeTests, ItShouldLeaveEnteredBlockingRegion)
+{
+	InSequence sequence;
+	EXPECT_CALL(*m_spThreadPool, EnterBlockingRegion())
+		.WillOnce(Return(true));
+	EXPECT_CALL(*m_spThreadPool, LeaveBlockingRegion())
+		.Times(1);
+
+	MsvBlockingScope scope(*m_spThreadPool);
+}
+
+TEST_F(MsvBlockingScopeTests, ItShouldNotLeaveRegionWhichWasNotEntered)
+{
+	EXPECT_CALL(*m_spThreadPool, EnterBlockingRegion())
+		.WillOnce(Return(false));
+	EXPECT_CALL(*m_spThreadPool, LeaveBlockingRegion())
+		.Times(0);
+
+	MsvBlockingScope scope(*m_spThreadPool);
+}
@@ -0,0 +1,129 @@
+#include "pch.h"
+
+
+#include "mthreading\MsvDeadlineTaskQueue.h"
+
+#include "mthreading\Mocks\MsvTask_Mock.h"
+
+
+using namespace ::testing;
+
+
+class MsvDeadlineTaskQueueTests:
+	public::testing::Test
+{
+public:
+	MsvDeadlineTaskQueueTests()
+	{
+
+	}
+
+	virtual void SetUp()
+	{
+		m_spTask1.reset(new (std::nothrow) MsvTask_Mock());
+		m_spTask2.reset(new (std::nothrow) MsvTask_Mock());
+		m_spTask3.reset(new (std::nothrow) MsvTask_Mock());
+
+		EXPECT_NE(m_spTask1, nullptr);
+		EXPECT_NE(m_spTask2, nullptr);
+		EXPECT_NE(m_spTask3, nullptr);
+	}
+
+	virtual void TearDown()
+	{
+		m_spTask1.reset();
+		m_spTask2.reset();
+		m_spTask3.reset();
+	}
+
+	//mocks
+	std::shared_ptr<MsvTask_Mock> m_spTask1;
+	std::shared_ptr<MsvTask_Mock> m_spTask2;
+	std::shared_ptr<MsvTask_Mock> m_spTask3;
+
+	//deadlines
+	std::chrono::steady_clock::time_point m_now = std::chrono::steady_clock::now();
+};
+
+TEST_F(MsvDeadlineTaskQueueTests, ItShouldBeEmptyAfterCreate)
+{
+	MsvDeadlineTaskQueue queue;
+	std::chrono::steady_clock::time_point deadline;
+
+	EXPECT_EQ(queue.GetSize(), 0);
+	EXPECT_EQ(queue.GetCapacity(), 0);
+	EXPECT_EQ(queue.Pop(deadline), nullptr);
+}
+
+TEST_F(MsvDeadlineTaskQueueTests, ItShouldPopTheEarliestDeadlineFirst)
+{
+	MsvDeadlineTaskQueue queue;
+	std::chrono::steady_clock::time_point deadline;
+
+	EXPECT_TRUE(queue.Push(m_spTask1, m_now + std::chrono::milliseconds(30)));
+	EXPECT_TRUE(queue.Push(m_spTask2, m_now + std::chrono::milliseconds(10)));
+	EXPECT_TRUE(queue.Push(m_spTask3, m_now + std::chrono::milliseconds(20)));
+	EXPECT_EQ(queue.GetSize(), 3);
+
+	EXPECT_EQ(queue.Pop(deadline), m_spTask2);
+	EXPECT_EQ(deadline, m_now + std::chrono::milliseconds(10));
+	EXPECT_EQ(queue.Pop(deadline), m_spTask3);
+	EXPECT_EQ(deadline, m_now + std::chrono::milliseconds(20));
+	EXPECT_EQ(queue.Pop(deadline), m_spTask1);
+	EXPECT_EQ(deadline, m_now + std::chrono::milliseconds(30));
+	EXPECT_EQ(queue.Pop(deadline), nullptr);
+	EXPECT_EQ(queue.GetSize(), 0);
+}
+
+TEST_F(MsvDeadlineTaskQueueTests, TasksWithTheSameDeadlineShouldBeFirstInFirstOut)
+{
+	MsvDeadlineTaskQueue queue;
+	std::chrono::steady_clock::time_point deadline;
+
+	EXPECT_TRUE(queue.Push(m_spTask1, m_now));
+	EXPECT_TRUE(queue.Push(m_spTask2, m_now));
+	EXPECT_TRUE(queue.Push(m_spTask3, m_now));
+
+	EXPECT_EQ(queue.Pop(deadline), m_spTask1);
+	EXPECT_EQ(queue.Pop(deadline), m_spTask2);
+	EXPECT_EQ(queue.Pop(deadline), m_spTask3);
+}
+
+TEST_F(MsvDeadlineTaskQueueTests, PushShouldFailedWhenBoundedQueueIsFull)
+{
+	MsvDeadlineTaskQueue queue(2);
+	std::chrono::steady_clock::time_point deadline;
+
+	EXPECT_TRUE(queue.Push(m_spTask1, m_now));
+	EXPECT_TRUE(queue.Push(m_spTask2, m_now));
+	EXPECT_FALSE(queue.Push(m_spTask3, m_now));
+
+	EXPECT_EQ(queue.GetCapacity(), 2);
+	EXPECT_EQ(queue.Pop(deadline), m_spTask1);
+	EXPECT_TRUE(queue.Push(m_spTask3, m_now));
+}
+
+TEST_F(MsvDeadlineTaskQueueTests, PushOrDropLatestShouldDropTheLeastUrgentTask)
+{
+	MsvDeadlineTaskQueue queue(2);
+	std::chrono::steady_clock::time_point deadline;
+	std::shared_ptr<IMsvTask> spDroppedTask;
+
+	//queue is not full -> nothing is dropped
+	EXPECT_TRUE(queue.PushOrDropLatest(m_spTask1, m_now + std::chrono::seconds(3), spDroppedTask));
+	EXPECT_EQ(spDroppedTask, nullptr);
+	EXPECT_TRUE(queue.PushOrDropLatest(m_spTask2, m_now + std::chrono::seconds(1), spDroppedTask));
+	EXPECT_EQ(spDroppedTask, nullptr);
+
+	//queued task with the latest deadline is dropped
+	EXPECT_TRUE(queue.PushOrDropLatest(m_spTask3, m_now + std::chrono::seconds(2), spDroppedTask));
+	EXPECT_EQ(spDroppedTask, m_spTask1);
+
+	//new task with the latest deadline is dropped
+	EXPECT_TRUE(queue.PushOrDropLatest(m_spTask1, m_now + std::chrono::seconds(2), spDroppedTask));
+	EXPECT_EQ(spDroppedTask, m_spTask1);
+
+	EXPECT_EQ(queue.GetSize(), 2);
+	EXPECT_EQ(queue.Pop(deadline), m_spTask2);
+	EXPECT_EQ(queue.Pop(deadline), m_spTask3);
+}
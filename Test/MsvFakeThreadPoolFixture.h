@@ -0,0 +1,72 @@
+#ifndef MARSTECH_FAKETHREADPOOLFIXTURE_H
+#define MARSTECH_FAKETHREADPOOLFIXTURE_H
+
+
+#include "mthreading\Mocks\MsvThreadPool_Mock.h"
+#include "merror\MsvErrorCodes.h"
+
+#include <memory>
+#include <vector>
+
+
+//fake thread pool for parallel algorithms: tasks are only stored and the calling thread executes them while it "waits"
+class MsvFakeThreadPoolTests:
+	public::testing::Test
+{
+public:
+	MsvFakeThreadPoolTests()
+	{
+
+	}
+
+	virtual void SetUp()
+	{
+		m_spThreadPool.reset(new (std::nothrow) ::testing::NiceMock<MsvThreadPool_Mock>());
+		EXPECT_NE(m_spThreadPool, nullptr);
+
+		//split tasks are executed while the calling thread "waits" (like worker)
+		ON_CALL(*m_spThreadPool, AddTask(::testing::Matcher<std::shared_ptr<IMsvTask>>(::testing::_)))
+			.WillByDefault(::testing::Invoke([this](std::shared_ptr<IMsvTask> spTask) { m_tasks.push_back(spTask); return MSV_SUCCESS; }));
+		ON_CALL(*m_spThreadPool, IsWorkerThread())
+			.WillByDefault(::testing::Return(true));
+		ON_CALL(*m_spThreadPool, TryExecuteTask())
+			.WillByDefault(::testing::Invoke([this]() { return ExecuteTask(); }));
+	}
+
+	virtual void TearDown()
+	{
+		m_tasks.clear();
+		m_spThreadPool.reset();
+	}
+
+	//calling thread has queued task while any task has not been executed yet
+	void SetLocalTaskWhileTasksAreQueued()
+	{
+		ON_CALL(*m_spThreadPool, HasLocalTask())
+			.WillByDefault(::testing::Invoke([this]() { return !m_tasks.empty(); }));
+	}
+
+	//executes the latest task added to thread pool
+	bool ExecuteTask()
+	{
+		if (m_tasks.empty())
+		{
+			return false;
+		}
+
+		std::shared_ptr<IMsvTask> spTask = m_tasks.back();
+		m_tasks.pop_back();
+		spTask->Execute();
+
+		return true;
+	}
+
+	//mocks
+	std::shared_ptr<::testing::NiceMock<MsvThreadPool_Mock>> m_spThreadPool;
+
+	//tasks added to thread pool
+	std::vector<std::shared_ptr<IMsvTask>> m_tasks;
+};
+
+
+#endif // MARSTECH_FAKETHREADPOOLFIXTURE_H
@@ -0,0 +1,97 @@
+#include "pch.h"
+
+
+#include "mthreading\MsvForkJoin.h"
+#include "mthreading\MsvThreadingErrorCodes.h"
+#include "merror\MsvErrorCodes.h"
+
+#include "MsvFakeThreadPoolFixture.h"
+
+#include <array>
+#include <stdexcept>
+#include <vector>
+
+
+using namespace ::testing;
+
+
+class MsvForkJoinTests:
+	public MsvFakeThreadPoolTests
+{
+};
+
+TEST_F(MsvForkJoinTests, SyncShouldExecuteTheLatestChildFirst)
+{
+	std::vector<int32_t> executed;
+	MsvForkJoin forkJoin(*m_spThreadPool);
+
+	forkJoin.Spawn([&executed]() { executed.push_back(1); });
+	forkJoin.Spawn([&executed]() { executed.push_back(2); });
+	forkJoin.Spawn([&executed]() { executed.push_back(3); });
+	EXPECT_TRUE(executed.empty());
+	EXPECT_EQ(m_tasks.size(), 3);
+
+	forkJoin.Sync();
+	EXPECT_EQ(executed, std::vector<int32_t>({ 3, 2, 1 }));
+	EXPECT_TRUE(m_tasks.empty());
+}
+
+TEST_F(MsvForkJoinTests, ItShouldExecuteChildWhenThreadPoolRejectsIt)
+{
+	int32_t executed = 0;
+	MsvForkJoin forkJoin(*m_spThreadPool);
+
+	EXPECT_CALL(*m_spThreadPool, AddTask(Matcher<std::shared_ptr<IMsvTask>>(_)))
+		.WillOnce(Return(MSV_QUEUE_FULL_ERROR));
+
+	forkJoin.Spawn([&executed]() { ++executed; });
+	EXPECT_EQ(executed, 1);
+
+	forkJoin.Sync();
+	EXPECT_EQ(executed, 1);
+}
+
+TEST_F(MsvForkJoinTests, ItShouldSpawnChildrenWhichDoNotFitInlineStorage)
+{
+	int32_t sum = 0;
+	std::array<int32_t, MSV_FORK_JOIN_INLINE_SIZE / sizeof(int32_t)> values;
+	values.fill(1);
+
+	MsvForkJoin forkJoin(*m_spThreadPool);
+	for (int32_t i = 0; i < 3; ++i)
+	{
+		forkJoin.Spawn([values, &sum]() { for (int32_t value : values) { sum += value; } });
+	}
+
+	forkJoin.Sync();
+	EXPECT_EQ(sum, 3 * MSV_FORK_JOIN_INLINE_SIZE / sizeof(int32_t));
+}
+
+TEST_F(MsvForkJoinTests, ParallelInvokeShouldNotSpawnTheFirstFunction)
+{
+	std::vector<int32_t> executed;
+	MsvForkJoin forkJoin(*m_spThreadPool);
+
+	EXPECT_CALL(*m_spThreadPool, AddTask(Matcher<std::shared_ptr<IMsvTask>>(_)))
+		.Times(2)
+		.WillRepeatedly(Invoke([this](std::shared_ptr<IMsvTask> spTask) { m_tasks.push_back(spTask); return MSV_SUCCESS; }));
+
+	forkJoin.ParallelInvoke([&executed]() { executed.push_back(1); }, [&executed]() { executed.push_back(2); }, [&executed]() { executed.push_back(3); });
+	EXPECT_EQ(executed, std::vector<int32_t>({ 1, 3, 2 }));
+}
+
+TEST_F(MsvForkJoinTests, SyncShouldRethrowExceptionOfChild)
+{
+	int32_t executed = 0;
+	MsvForkJoin forkJoin(*m_spThreadPool);
+
+	forkJoin.Spawn([]() { throw std::runtime_error("error"); });
+	forkJoin.Spawn([&executed]() { ++executed; });
+
+	EXPECT_THROW(forkJoin.Sync(), std::runtime_error);
+	EXPECT_EQ(executed, 1);
+	EXPECT_TRUE(m_tasks.empty());
+
+	//exception is rethrown once
+	EXPECT_NO_THROW(forkJoin.Sync());
+}
@@ -0,0 +1,174 @@
+#include "pch.h"
+
+
+#include "mthreading\MsvFuture.h"
+#include "merror\MsvErrorCodes.h"
+
+#include "mthreading\Mocks\MsvThreadPool_Mock.h"
+
+#include <thread>
+#include <string>
+#include <stdexcept>
+
+
+using namespace ::testing;
+
+
+class MsvFutureTests:
+	public::testing::Test
+{
+public:
+	MsvFutureTests()
+	{
+
+	}
+
+	//creates future task from callable
+	template<typename T, typename Callable>
+	std::shared_ptr<MsvFutureTask<T, Callable>> CreateTask(Callable callable)
+	{
+		std::shared_ptr<MsvFutureTask<T, Callable>> spTask(new (std::nothrow) MsvFutureTask<T, Callable>(callable));
+		EXPECT_NE(spTask, nullptr);
+
+		return spTask;
+	}
+
+	//executes task (like worker)
+	void Execute(std::shared_ptr<IMsvTask> spTask)
+	{
+		spTask->Execute();
+	}
+};
+
+TEST_F(MsvFutureTests, ItShouldNotBeValidAfterCreate)
+{
+	MsvFuture<int32_t> future(MSV_ALLOCATION_ERROR);
+
+	EXPECT_FALSE(future.IsValid());
+	EXPECT_FALSE(future.IsReady());
+	EXPECT_FALSE(future.WaitFor(1000));
+	EXPECT_EQ(future.GetErrorCode(), MSV_ALLOCATION_ERROR);
+	EXPECT_THROW(future.Get(), std::logic_error);
+}
+
+TEST_F(MsvFutureTests, ItShouldReturnResultOfTask)
+{
+	auto spTask = CreateTask<std::string>([]() { return std::string("result"); });
+	MsvFuture<std::string> future(spTask);
+
+	EXPECT_TRUE(future.IsValid());
+	EXPECT_EQ(future.GetErrorCode(), MSV_SUCCESS);
+	EXPECT_FALSE(future.IsReady());
+	EXPECT_FALSE(future.WaitFor(1000));
+
+	Execute(spTask);
+
+	EXPECT_TRUE(future.IsReady());
+	EXPECT_EQ(future.Get(), "result");
+}
+
+TEST_F(MsvFutureTests, ItShouldRethrowExceptionOfTask)
+{
+	auto spTask = CreateTask<void>([]() { throw std::runtime_error("error"); });
+	MsvFuture<void> future(spTask);
+
+	Execute(spTask);
+
+	EXPECT_TRUE(future.IsReady());
+	EXPECT_THROW(future.Get(), std::runtime_error);
+}
+
+TEST_F(MsvFutureTests, ItShouldWakeUpWaitingThread)
+{
+	auto spTask = CreateTask<int32_t>([]() { return 42; });
+	MsvFuture<int32_t> future(spTask);
+
+	std::thread executor([this, spTask]()
+	{
+		using namespace std::chrono_literals;
+		std::this_thread::sleep_for(50ms);
+		Execute(spTask);
+	});
+
+	//waiter is parked
+	EXPECT_EQ(future.Get(), 42);
+	executor.join();
+}
+
+TEST_F(MsvFutureTests, ContinuationShouldBeExecutedWhenAntecedentCompletes)
+{
+	auto spTask = CreateTask<int32_t>([]() { return 20; });
+	MsvFuture<int32_t> future(spTask);
+
+	MsvFuture<int32_t> continuation = future.Then([](MsvFuture<int32_t>& antecedent) { return antecedent.Get() + 1; });
+	EXPECT_TRUE(continuation.IsValid());
+	EXPECT_FALSE(continuation.IsReady());
+
+	//future without executor executes continuation inline
+	Execute(spTask);
+
+	EXPECT_TRUE(continuation.IsReady());
+	EXPECT_EQ(continuation.Get(), 21);
+}
+
+TEST_F(MsvFutureTests, ContinuationShouldBeExecutedImmediatelyWhenAntecedentIsReady)
+{
+	auto spTask = CreateTask<int32_t>([]() { return 20; });
+	MsvFuture<int32_t> future(spTask);
+
+	Execute(spTask);
+
+	MsvFuture<void> continuation = future.Then([](MsvFuture<int32_t>& antecedent) { antecedent.Get(); }, MsvContinuationMode::MSV_CONTINUATION_INLINE);
+	EXPECT_TRUE(continuation.IsReady());
+}
+
+TEST_F(MsvFutureTests, ContinuationShouldBeAddedToExecutor)
+{
+	std::shared_ptr<MsvThreadPool_Mock> spExecutor(new (std::nothrow) MsvThreadPool_Mock());
+	EXPECT_NE(spExecutor, nullptr);
+
+	auto spTask = CreateTask<int32_t>([]() { return 20; });
+	MsvFuture<int32_t> future(spTask, spExecutor.get());
+
+	//continuations are executed in order in which they were added
+	std::string order;
+	MsvFuture<void> continuation1 = future.Then([&order](MsvFuture<int32_t>&) { order += "1"; });
+	MsvFuture<void> continuation2 = future.Then([&order](MsvFuture<int32_t>&) { order += "2"; }, MsvContinuationMode::MSV_CONTINUATION_INLINE);
+
+	std::shared_ptr<IMsvTask> spContinuationTask;
+	EXPECT_CALL(*spExecutor, AddTask(Matcher<std::shared_ptr<IMsvTask>>(_)))
+		.WillOnce(DoAll(SaveArg<0>(&spContinuationTask), Return(MSV_SUCCESS)));
+
+	Execute(spTask);
+
+	EXPECT_FALSE(continuation1.IsReady());
+	EXPECT_TRUE(continuation2.IsReady());
+	EXPECT_NE(spContinuationTask, nullptr);
+
+	Execute(spContinuationTask);
+
+	EXPECT_TRUE(continuation1.IsReady());
+	EXPECT_EQ(order, "21");
+}
+
+TEST_F(MsvFutureTests, ContinuationShouldGetExceptionOfAntecedent)
+{
+	auto spTask = CreateTask<int32_t>([]() -> int32_t { throw std::runtime_error("error"); });
+	MsvFuture<int32_t> future(spTask);
+
+	MsvFuture<int32_t> continuation = future.Then([](MsvFuture<int32_t>& antecedent)
+	{
+		try
+		{
+			return antecedent.Get();
+		}
+		catch (const std::runtime_error&)
+		{
+			return -1;
+		}
+	});
+
+	Execute(spTask);
+
+	EXPECT_EQ(continuation.Get(), -1);
+}
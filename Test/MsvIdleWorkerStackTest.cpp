@@ -0,0 +1,104 @@
+#include "pch.h"
+
+
+#include "mthreading\MsvIdleWorkerStack.h"
+
+#include <atomic>
+#include <thread>
+
+
+class MsvIdleWorkerStackTests:
+	public::testing::Test
+{
+public:
+	MsvIdleWorkerStackTests()
+	{
+
+	}
+
+	virtual void SetUp()
+	{
+
+	}
+
+	virtual void TearDown()
+	{
+
+	}
+
+	//waits until count of idle workers is reached
+	void WaitForIdleCount(size_t idleCount)
+	{
+		while (m_idleWorkers.GetIdleCount() != idleCount)
+		{
+			std::this_thread::sleep_for(std::chrono::microseconds(100));
+		}
+	}
+
+	//tested class
+	MsvIdleWorkerStack m_idleWorkers;
+};
+
+TEST_F(MsvIdleWorkerStackTests, WakeShouldStorePermitsWhenNobodyWaits)
+{
+	MsvSleepSlot slot;
+
+	m_idleWorkers.Wake(2);
+	EXPECT_EQ(m_idleWorkers.GetPermitCount(), 2);
+
+	//permits are consumed without waiting
+	EXPECT_TRUE(m_idleWorkers.Wait(slot, 0));
+	EXPECT_TRUE(m_idleWorkers.Wait(slot, 0));
+	EXPECT_EQ(m_idleWorkers.GetPermitCount(), 0);
+	EXPECT_EQ(m_idleWorkers.GetIdleCount(), 0);
+}
+
+TEST_F(MsvIdleWorkerStackTests, SignaledOrStoppedSlotShouldNotWait)
+{
+	MsvSleepSlot slot;
+
+	m_idleWorkers.Signal(slot);
+	EXPECT_TRUE(m_idleWorkers.Wait(slot, 0));
+
+	m_idleWorkers.Stop(slot);
+	EXPECT_FALSE(m_idleWorkers.Wait(slot, 0));
+	EXPECT_FALSE(m_idleWorkers.Wait(slot, 0));
+}
+
+TEST_F(MsvIdleWorkerStackTests, WaitShouldLeaveStackAfterTimeout)
+{
+	MsvSleepSlot slot;
+
+	EXPECT_TRUE(m_idleWorkers.Wait(slot, 1000));
+	EXPECT_EQ(m_idleWorkers.GetIdleCount(), 0);
+	EXPECT_EQ(m_idleWorkers.GetPermitCount(), 0);
+}
+
+TEST_F(MsvIdleWorkerStackTests, WakeShouldWakeOnlyTheLatestIdleWorker)
+{
+	MsvSleepSlot slot1;
+	MsvSleepSlot slot2;
+	std::atomic<int32_t> woken1(0);
+	std::atomic<int32_t> woken2(0);
+
+	std::thread thread1([this, &slot1, &woken1]() { while (m_idleWorkers.Wait(slot1, 0)) { ++woken1; } });
+	WaitForIdleCount(1);
+	//the latest worker waits only once (its slot is not pushed again after wake up)
+	std::thread thread2([this, &slot2, &woken2]() { if (m_idleWorkers.Wait(slot2, 0)) { ++woken2; } });
+	WaitForIdleCount(2);
+
+	//one wake up -> one worker (the latest one)
+	m_idleWorkers.Wake(1);
+	thread2.join();
+	EXPECT_EQ(m_idleWorkers.GetIdleCount(), 1);
+	EXPECT_EQ(woken1, 0);
+	EXPECT_EQ(woken2, 1);
+	EXPECT_EQ(m_idleWorkers.GetPermitCount(), 0);
+
+	m_idleWorkers.Stop(slot1);
+	thread1.join();
+
+	EXPECT_EQ(woken1, 0);
+	EXPECT_EQ(woken2, 1);
+	EXPECT_EQ(m_idleWorkers.GetIdleCount(), 0);
+}
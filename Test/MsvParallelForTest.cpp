@@ -0,0 +1,70 @@
+#include "pch.h"
+
+
+#include "mthreading\MsvParallelFor.h"
+#include "merror\MsvErrorCodes.h"
+
+#include "MsvFakeThreadPoolFixture.h"
+
+#include <vector>
+
+
+using namespace ::testing;
+
+
+class MsvParallelForTests:
+	public MsvFakeThreadPoolTests
+{
+};
+
+TEST_F(MsvParallelForTests, ItShouldFailedWithoutThreadPool)
+{
+	EXPECT_EQ(MsvParallelFor(nullptr, 0, 10, [](int32_t) {}), MSV_NOT_INITIALIZED_ERROR);
+}
+
+TEST_F(MsvParallelForTests, ItShouldNotSplitWhenThreadHasQueuedTask)
+{
+	std::vector<int32_t> executed;
+
+	EXPECT_CALL(*m_spThreadPool, HasLocalTask())
+		.WillRepeatedly(Return(true));
+	EXPECT_CALL(*m_spThreadPool, AddTask(Matcher<std::shared_ptr<IMsvTask>>(_)))
+		.Times(0);
+
+	EXPECT_EQ(MsvParallelFor(m_spThreadPool, 0, 100, [&executed](int32_t i) { executed.push_back(i); }), MSV_SUCCESS);
+
+	EXPECT_EQ(executed.size(), 100);
+	for (int32_t i = 0; i < 100; ++i)
+	{
+		EXPECT_EQ(executed[i], i);
+	}
+}
+
+TEST_F(MsvParallelForTests, ItShouldSplitRangeInHalfWhenWorkIsDemanded)
+{
+	std::vector<int32_t> executed(100, 0);
+
+	//the first check demands work, then the queue is not empty
+	EXPECT_CALL(*m_spThreadPool, HasLocalTask())
+		.WillOnce(Return(false))
+		.WillRepeatedly(Invoke([this]() { return !m_tasks.empty(); }));
+	EXPECT_CALL(*m_spThreadPool, AddTask(Matcher<std::shared_ptr<IMsvTask>>(_)))
+		.Times(AtLeast(1));
+
+	EXPECT_EQ(MsvParallelFor(m_spThreadPool, 0, 100, [&executed](int32_t i) { ++executed[i]; }, 10), MSV_SUCCESS);
+
+	EXPECT_TRUE(m_tasks.empty());
+	for (int32_t i = 0; i < 100; ++i)
+	{
+		EXPECT_EQ(executed[i], 1);
+	}
+}
+
+TEST_F(MsvParallelForTests, ItShouldRethrowExceptionOfSplitTask)
+{
+	ON_CALL(*m_spThreadPool, HasLocalTask())
+		.WillByDefault(Invoke([this]() { return !m_tasks.empty(); }));
+
+	EXPECT_THROW(MsvParallelFor(m_spThreadPool, 0, 100, [](int32_t i) { if (i == 99) throw std::runtime_error("error"); }, 10), std::runtime_error);
+	EXPECT_TRUE(m_tasks.empty());
+}
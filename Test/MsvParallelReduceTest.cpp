@@ -0,0 +1,107 @@
+#include "pch.h"
+
+
+#include "mthreading\MsvParallelReduce.h"
+#include "merror\MsvErrorCodes.h"
+
+#include "MsvFakeThreadPoolFixture.h"
+
+#include <functional>
+#include <string>
+#include <thread>
+#include <vector>
+
+
+using namespace ::testing;
+
+
+class MsvParallelReduceTests:
+	public MsvFakeThreadPoolTests
+{
+public:
+	MsvParallelReduceTests():
+		m_workerIndex(0)
+	{
+
+	}
+
+	virtual void SetUp()
+	{
+		MsvFakeThreadPoolTests::SetUp();
+		SetLocalTaskWhileTasksAreQueued();
+	}
+
+	//simulated worker index (it changes with each call)
+	size_t m_workerIndex;
+};
+
+TEST_F(MsvParallelReduceTests, ItShouldFailedWithoutThreadPool)
+{
+	int32_t result = 0;
+
+	EXPECT_EQ(MsvParallelReduce(nullptr, 0, 10, 0, std::plus<int32_t>(), result), MSV_NOT_INITIALIZED_ERROR);
+}
+
+TEST_F(MsvParallelReduceTests, ItShouldReturnInitWhenRangeIsEmpty)
+{
+	int32_t result = 0;
+
+	EXPECT_EQ(MsvParallelReduce(m_spThreadPool, 10, 10, 5, std::plus<int32_t>(), result), MSV_SUCCESS);
+	EXPECT_EQ(result, 5);
+}
+
+TEST_F(MsvParallelReduceTests, ItShouldReduceIndexRangeInPerWorkerSlots)
+{
+	int64_t result = 0;
+
+	//blocks are "executed" by different workers (and by non-worker thread)
+	EXPECT_CALL(*m_spThreadPool, GetWorkerCount())
+		.WillRepeatedly(Return(4));
+	EXPECT_CALL(*m_spThreadPool, GetCurrentWorkerIndex(_))
+		.WillRepeatedly(Invoke([this](size_t& workerIndex) { workerIndex = m_workerIndex++ % 5; return workerIndex != 4; }));
+
+	EXPECT_EQ(MsvParallelReduce(m_spThreadPool, static_cast<int64_t>(0), static_cast<int64_t>(1000), static_cast<int64_t>(7), std::plus<int64_t>(), result, MsvReduceOrder::MSV_REDUCE_ANY_ORDER, 10), MSV_SUCCESS);
+	EXPECT_EQ(result, 499507);
+	EXPECT_TRUE(m_tasks.empty());
+}
+
+TEST_F(MsvParallelReduceTests, ItShouldReduceBlocksExecutedByOtherNonWorkerThreads)
+{
+	int64_t result = 0;
+
+	//tasks are executed by another thread which is not worker (e.g. it helps by TryExecuteTask)
+	EXPECT_CALL(*m_spThreadPool, GetWorkerCount())
+		.WillRepeatedly(Return(4));
+	EXPECT_CALL(*m_spThreadPool, GetCurrentWorkerIndex(_))
+		.WillRepeatedly(Return(false));
+	EXPECT_CALL(*m_spThreadPool, TryExecuteTask())
+		.WillRepeatedly(Invoke([this]() { bool executed = false; std::thread thread([this, &executed]() { executed = ExecuteTask(); }); thread.join(); return executed; }));
+
+	EXPECT_EQ(MsvParallelReduce(m_spThreadPool, static_cast<int64_t>(0), static_cast<int64_t>(1000), static_cast<int64_t>(7), std::plus<int64_t>(), result, MsvReduceOrder::MSV_REDUCE_ANY_ORDER, 10), MSV_SUCCESS);
+	EXPECT_EQ(result, 499507);
+	EXPECT_TRUE(m_tasks.empty());
+}
+
+TEST_F(MsvParallelReduceTests, ItShouldCombineBlocksInOrderInDeterministicMode)
+{
+	std::vector<char> letters;
+	for (char letter = 'a'; letter <= 'z'; ++letter)
+	{
+		letters.push_back(letter);
+	}
+
+	//concatenation is not commutative
+	std::string result;
+	EXPECT_EQ(MsvParallelTransformReduce(m_spThreadPool, letters.begin(), letters.end(), std::string(">"), std::plus<std::string>(),
+		[](char letter) { return std::string(1, letter); }, result, MsvReduceOrder::MSV_REDUCE_DETERMINISTIC, 3), MSV_SUCCESS);
+	EXPECT_EQ(result, ">abcdefghijklmnopqrstuvwxyz");
+}
+
+TEST_F(MsvParallelReduceTests, ItShouldRethrowExceptionOfTransform)
+{
+	int32_t result = 0;
+
+	EXPECT_THROW(MsvParallelTransformReduce(m_spThreadPool, 0, 100, 0, std::plus<int32_t>(),
+		[](int32_t i) -> int32_t { if (i == 99) throw std::runtime_error("error"); return i; }, result, MsvReduceOrder::MSV_REDUCE_ANY_ORDER, 10), std::runtime_error);
+	EXPECT_TRUE(m_tasks.empty());
+}
@@ -0,0 +1,75 @@
+#include "pch.h"
+
+
+#include "mthreading\MsvParallelScan.h"
+#include "merror\MsvErrorCodes.h"
+
+#include "MsvFakeThreadPoolFixture.h"
+
+#include <functional>
+#include <string>
+#include <vector>
+
+
+using namespace ::testing;
+
+
+class MsvParallelScanTests:
+	public MsvFakeThreadPoolTests
+{
+public:
+	MsvParallelScanTests()
+	{
+
+	}
+
+	virtual void SetUp()
+	{
+		MsvFakeThreadPoolTests::SetUp();
+		SetLocalTaskWhileTasksAreQueued();
+
+		for (int32_t i = 1; i <= 10; ++i)
+		{
+			m_values.push_back(i);
+		}
+	}
+
+	//input values (1..10)
+	std::vector<int32_t> m_values;
+};
+
+TEST_F(MsvParallelScanTests, ItShouldFailedWithoutThreadPool)
+{
+	std::vector<int32_t> output(m_values.size());
+
+	EXPECT_EQ(MsvParallelInclusiveScan(nullptr, m_values.begin(), m_values.end(), output.begin(), std::plus<int32_t>()), MSV_NOT_INITIALIZED_ERROR);
+	EXPECT_EQ(MsvParallelExclusiveScan(nullptr, m_values.begin(), m_values.end(), output.begin(), 0, std::plus<int32_t>()), MSV_NOT_INITIALIZED_ERROR);
+}
+
+TEST_F(MsvParallelScanTests, ItShouldComputeInclusiveScanInBlocks)
+{
+	std::vector<int32_t> output(m_values.size());
+
+	EXPECT_EQ(MsvParallelInclusiveScan(m_spThreadPool, m_values.begin(), m_values.end(), output.begin(), std::plus<int32_t>(), 3), MSV_SUCCESS);
+	EXPECT_EQ(output, std::vector<int32_t>({ 1, 3, 6, 10, 15, 21, 28, 36, 45, 55 }));
+	EXPECT_TRUE(m_tasks.empty());
+}
+
+TEST_F(MsvParallelScanTests, ItShouldComputeExclusiveScanInPlace)
+{
+	EXPECT_EQ(MsvParallelExclusiveScan(m_spThreadPool, m_values.begin(), m_values.end(), m_values.begin(), 100, std::plus<int32_t>(), 4), MSV_SUCCESS);
+	EXPECT_EQ(m_values, std::vector<int32_t>({ 100, 101, 103, 106, 110, 115, 121, 128, 136, 145 }));
+}
+
+TEST_F(MsvParallelScanTests, ItShouldKeepOrderOfOperands)
+{
+	std::vector<std::string> letters = { "a", "b", "c", "d", "e", "f", "g" };
+	std::vector<std::string> output(letters.size());
+
+	//concatenation is not commutative
+	EXPECT_EQ(MsvParallelExclusiveScan(m_spThreadPool, letters.begin(), letters.end(), output.begin(), std::string(">"), std::plus<std::string>(), 2), MSV_SUCCESS);
+	EXPECT_EQ(output, std::vector<std::string>({ ">", ">a", ">ab", ">abc", ">abcd", ">abcde", ">abcdef" }));
+
+	EXPECT_EQ(MsvParallelInclusiveScan(m_spThreadPool, letters.begin(), letters.end(), output.begin(), std::plus<std::string>(), 2), MSV_SUCCESS);
+	EXPECT_EQ(output, std::vector<std::string>({ "a", "ab", "abc", "abcd", "abcde", "abcdef", "abcdefg" }));
+}
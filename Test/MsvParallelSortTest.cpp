@@ -0,0 +1,92 @@
+#include "pch.h"
+
+
+#include "mthreading\MsvParallelSort.h"
+#include "merror\MsvErrorCodes.h"
+
+#include "MsvFakeThreadPoolFixture.h"
+
+#include <algorithm>
+#include <functional>
+#include <random>
+#include <vector>
+
+
+using namespace ::testing;
+
+
+class MsvParallelSortTests:
+	public MsvFakeThreadPoolTests
+{
+public:
+	MsvParallelSortTests()
+	{
+
+	}
+
+	virtual void SetUp()
+	{
+		MsvFakeThreadPoolTests::SetUp();
+		SetLocalTaskWhileTasksAreQueued();
+
+		ON_CALL(*m_spThreadPool, GetWorkerCount())
+			.WillByDefault(Return(3));
+	}
+
+	//random values
+	std::vector<int32_t> GetRandomValues(size_t count)
+	{
+		std::mt19937 generator(42);
+		std::uniform_int_distribution<int32_t> distribution(0, 1000);
+		std::vector<int32_t> values(count);
+		for (int32_t& value : values)
+		{
+			value = distribution(generator);
+		}
+
+		return values;
+	}
+};
+
+TEST_F(MsvParallelSortTests, ItShouldFailedWithoutThreadPool)
+{
+	std::vector<int32_t> values = GetRandomValues(10);
+
+	EXPECT_EQ(MsvParallelSort(nullptr, values.begin(), values.end()), MSV_NOT_INITIALIZED_ERROR);
+}
+
+TEST_F(MsvParallelSortTests, ItShouldSortShortRangeSequentially)
+{
+	std::vector<int32_t> values = GetRandomValues(1000);
+	std::vector<int32_t> expected = values;
+	std::sort(expected.begin(), expected.end());
+
+	EXPECT_CALL(*m_spThreadPool, AddTask(Matcher<std::shared_ptr<IMsvTask>>(_)))
+		.Times(0);
+
+	EXPECT_EQ(MsvParallelSort(m_spThreadPool, values.begin(), values.end()), MSV_SUCCESS);
+	EXPECT_EQ(values, expected);
+}
+
+TEST_F(MsvParallelSortTests, ItShouldSortLongRangeWithComparator)
+{
+	//odd count - the last run has no pair in some rounds
+	std::vector<int32_t> values = GetRandomValues(100001);
+	std::vector<int32_t> expected = values;
+	std::sort(expected.begin(), expected.end(), std::greater<int32_t>());
+
+	EXPECT_EQ(MsvParallelSort(m_spThreadPool, values.begin(), values.end(), std::greater<int32_t>()), MSV_SUCCESS);
+	EXPECT_EQ(values, expected);
+	EXPECT_TRUE(m_tasks.empty());
+}
+
+TEST_F(MsvParallelSortTests, MergePathSplitShouldPreferTheFirstRun)
+{
+	std::vector<int32_t> first = { 1, 3, 3, 5 };
+	std::vector<int32_t> second = { 2, 3, 4 };
+
+	EXPECT_EQ(MsvMergePathSplit(first.begin(), 4, second.begin(), 3, 0, std::less<int32_t>()), 0);
+	EXPECT_EQ(MsvMergePathSplit(first.begin(), 4, second.begin(), 3, 2, std::less<int32_t>()), 1);
+	EXPECT_EQ(MsvMergePathSplit(first.begin(), 4, second.begin(), 3, 4, std::less<int32_t>()), 3);
+	EXPECT_EQ(MsvMergePathSplit(first.begin(), 4, second.begin(), 3, 7, std::less<int32_t>()), 4);
+}
@@ -0,0 +1,136 @@
+#include "pch.h"
+
+
+#include "mthreading\MsvPeriodicTask.h"
+#include "mthreading\MsvTimerWheel.h"
+#include "merror\MsvErrorCodes.h"
+
+#include "mthreading\Mocks\MsvTask_Mock.h"
+
+
+using namespace ::testing;
+
+
+class MsvPeriodicTaskTests:
+	public::testing::Test
+{
+public:
+	MsvPeriodicTaskTests()
+	{
+
+	}
+
+	virtual void SetUp()
+	{
+		m_spTask.reset(new (std::nothrow) MsvTask_Mock());
+		m_spTimerWheel.reset(new (std::nothrow) MsvTimerWheel(1000, m_now - std::chrono::seconds(1)));
+
+		EXPECT_NE(m_spTask, nullptr);
+		EXPECT_NE(m_spTimerWheel, nullptr);
+	}
+
+	virtual void TearDown()
+	{
+		m_spTask.reset();
+		m_spTimerWheel.reset();
+	}
+
+	//starts periodic task which is late (its first execution should have been 3.5 periods ago) and executes it
+	std::shared_ptr<MsvPeriodicTask> StartLateTask(MsvPeriodicMode mode, MsvMissedTickPolicy missedTickPolicy)
+	{
+		std::shared_ptr<MsvPeriodicTask> spPeriodicTask(new (std::nothrow) MsvPeriodicTask(m_spTask, m_period, mode, missedTickPolicy, m_spTimerWheel));
+		EXPECT_NE(spPeriodicTask, nullptr);
+		EXPECT_EQ(spPeriodicTask->Start(m_now - m_period * 7 / 2), MSV_SUCCESS);
+
+		std::vector<std::shared_ptr<IMsvTask>> expiredTasks;
+		EXPECT_EQ(m_spTimerWheel->Advance(m_now, expiredTasks), 1);
+		EXPECT_EQ(expiredTasks.size(), 1);
+
+		EXPECT_CALL(*m_spTask, Execute())
+			.Times(1);
+		expiredTasks[0]->Execute();
+		EXPECT_EQ(m_spTimerWheel->GetSize(), 1);
+
+		return spPeriodicTask;
+	}
+
+	//returns count of expired timers
+	size_t Advance(std::chrono::steady_clock::time_point now)
+	{
+		std::vector<std::shared_ptr<IMsvTask>> expiredTasks;
+		return m_spTimerWheel->Advance(now, expiredTasks);
+	}
+
+	//mocks
+	std::shared_ptr<MsvTask_Mock> m_spTask;
+
+	//timer wheel
+	std::shared_ptr<MsvTimerWheel> m_spTimerWheel;
+
+	//times
+	std::chrono::steady_clock::time_point m_now = std::chrono::steady_clock::now();
+	std::chrono::microseconds m_period = std::chrono::milliseconds(10);
+};
+
+TEST_F(MsvPeriodicTaskTests, ItShouldSkipMissedTicks)
+{
+	std::shared_ptr<MsvPeriodicTask> spPeriodicTask = StartLateTask(MsvPeriodicMode::MSV_PERIODIC_FIXED_RATE, MsvMissedTickPolicy::MSV_MISSED_TICK_SKIP);
+
+	//the next tick of the original schedule is half period from now
+	EXPECT_EQ(Advance(m_now + std::chrono::milliseconds(4)), 0);
+	EXPECT_EQ(Advance(m_now + std::chrono::milliseconds(5)), 1);
+}
+
+TEST_F(MsvPeriodicTaskTests, ItShouldCatchUpMissedTicks)
+{
+	std::shared_ptr<MsvPeriodicTask> spPeriodicTask = StartLateTask(MsvPeriodicMode::MSV_PERIODIC_FIXED_RATE, MsvMissedTickPolicy::MSV_MISSED_TICK_CATCH_UP);
+
+	//the next tick has been missed -> it expires immediately
+	EXPECT_EQ(Advance(m_now + std::chrono::milliseconds(1)), 1);
+}
+
+TEST_F(MsvPeriodicTaskTests, ItShouldCoalesceMissedTicks)
+{
+	std::shared_ptr<MsvPeriodicTask> spPeriodicTask = StartLateTask(MsvPeriodicMode::MSV_PERIODIC_FIXED_RATE, MsvMissedTickPolicy::MSV_MISSED_TICK_COALESCE);
+
+	//the schedule restarts from the execution
+	EXPECT_EQ(Advance(m_now + std::chrono::milliseconds(9)), 0);
+	EXPECT_EQ(Advance(m_now + std::chrono::hours(1)), 1);
+}
+
+TEST_F(MsvPeriodicTaskTests, ItShouldScheduleFixedDelayFromTheEndOfExecution)
+{
+	std::shared_ptr<MsvPeriodicTask> spPeriodicTask = StartLateTask(MsvPeriodicMode::MSV_PERIODIC_FIXED_DELAY, MsvMissedTickPolicy::MSV_MISSED_TICK_CATCH_UP);
+
+	EXPECT_EQ(Advance(m_now + std::chrono::milliseconds(9)), 0);
+	EXPECT_EQ(Advance(m_now + std::chrono::hours(1)), 1);
+}
+
+TEST_F(MsvPeriodicTaskTests, ItShouldNotBeExecutedWhenCancelled)
+{
+	std::shared_ptr<MsvPeriodicTask> spPeriodicTask(new (std::nothrow) MsvPeriodicTask(m_spTask, m_period, MsvPeriodicMode::MSV_PERIODIC_FIXED_RATE, MsvMissedTickPolicy::MSV_MISSED_TICK_SKIP, m_spTimerWheel));
+	EXPECT_NE(spPeriodicTask, nullptr);
+
+	EXPECT_EQ(spPeriodicTask->Start(m_now), MSV_SUCCESS);
+	EXPECT_EQ(m_spTimerWheel->GetSize(), 1);
+
+	EXPECT_TRUE(spPeriodicTask->Cancel());
+	EXPECT_FALSE(spPeriodicTask->Cancel());
+	EXPECT_EQ(m_spTimerWheel->GetSize(), 0);
+
+	//execution of already expired timer does nothing
+	EXPECT_CALL(*m_spTask, Execute())
+		.Times(0);
+	static_cast<std::shared_ptr<IMsvTask>>(spPeriodicTask)->Execute();
+	EXPECT_EQ(m_spTimerWheel->GetSize(), 0);
+}
+
+TEST_F(MsvPeriodicTaskTests, StartShouldFailedWhenTimerWheelIsReleased)
+{
+	std::shared_ptr<MsvPeriodicTask> spPeriodicTask(new (std::nothrow) MsvPeriodicTask(m_spTask, m_period, MsvPeriodicMode::MSV_PERIODIC_FIXED_RATE, MsvMissedTickPolicy::MSV_MISSED_TICK_SKIP, m_spTimerWheel));
+	EXPECT_NE(spPeriodicTask, nullptr);
+
+	m_spTimerWheel.reset();
+
+	EXPECT_EQ(spPeriodicTask->Start(m_now), MSV_ALLOCATION_ERROR);
+}
@@ -0,0 +1,157 @@
+#include "pch.h"
+
+
+#include "mthreading\MsvPriorityTaskQueue.h"
+#include "merror\MsvErrorCodes.h"
+
+#include "mthreading\Mocks\MsvTask_Mock.h"
+
+#include <vector>
+#include <algorithm>
+
+
+using namespace ::testing;
+
+
+class MsvPriorityTaskQueueTests:
+	public::testing::Test
+{
+public:
+	MsvPriorityTaskQueueTests()
+	{
+
+	}
+
+	virtual void SetUp()
+	{
+		m_spHighTask.reset(new (std::nothrow) MsvTask_Mock());
+		m_spNormalTask.reset(new (std::nothrow) MsvTask_Mock());
+		m_spLowTask.reset(new (std::nothrow) MsvTask_Mock());
+
+		EXPECT_NE(m_spHighTask, nullptr);
+		EXPECT_NE(m_spNormalTask, nullptr);
+		EXPECT_NE(m_spLowTask, nullptr);
+	}
+
+	virtual void TearDown()
+	{
+		m_spHighTask.reset();
+		m_spNormalTask.reset();
+		m_spLowTask.reset();
+	}
+
+	//pushes count tasks to each band
+	void PushTasks(MsvPriorityTaskQueue& queue, int32_t count)
+	{
+		for (int32_t i = 0; i < count; ++i)
+		{
+			EXPECT_TRUE(queue.Push(m_spLowTask, MsvTaskPriority::MSV_TASK_PRIORITY_LOW));
+			EXPECT_TRUE(queue.Push(m_spNormalTask, MsvTaskPriority::MSV_TASK_PRIORITY_NORMAL));
+			EXPECT_TRUE(queue.Push(m_spHighTask, MsvTaskPriority::MSV_TASK_PRIORITY_HIGH));
+		}
+	}
+
+	//mocks
+	std::shared_ptr<MsvTask_Mock> m_spHighTask;
+	std::shared_ptr<MsvTask_Mock> m_spNormalTask;
+	std::shared_ptr<MsvTask_Mock> m_spLowTask;
+};
+
+TEST_F(MsvPriorityTaskQueueTests, ItShouldBeEmptyAfterCreate)
+{
+	MsvPriorityTaskQueue queue;
+
+	EXPECT_EQ(queue.GetSize(), 0);
+	EXPECT_EQ(queue.GetCapacity(), 0);
+	EXPECT_EQ(queue.Pop(), nullptr);
+	EXPECT_EQ(queue.Pop(MsvTaskPriority::MSV_TASK_PRIORITY_LOW), nullptr);
+}
+
+TEST_F(MsvPriorityTaskQueueTests, ItShouldPopTasksStrictlyByPriority)
+{
+	MsvPriorityTaskQueue queue;
+	EXPECT_EQ(queue.SetPriorityAging(0), MSV_SUCCESS);
+
+	PushTasks(queue, 2);
+	EXPECT_TRUE(queue.Push(m_spNormalTask));
+	EXPECT_EQ(queue.GetSize(), 7);
+
+	EXPECT_EQ(queue.Pop(), m_spHighTask);
+	EXPECT_EQ(queue.Pop(), m_spHighTask);
+	EXPECT_EQ(queue.Pop(), m_spNormalTask);
+	EXPECT_EQ(queue.Pop(), m_spNormalTask);
+	EXPECT_EQ(queue.Pop(), m_spNormalTask);
+	EXPECT_EQ(queue.Pop(), m_spLowTask);
+	EXPECT_EQ(queue.Pop(), m_spLowTask);
+	EXPECT_EQ(queue.Pop(), nullptr);
+}
+
+TEST_F(MsvPriorityTaskQueueTests, ItShouldPopTasksByWeights)
+{
+	MsvPriorityTaskQueue queue;
+	EXPECT_EQ(queue.SetPriorityAging(0), MSV_SUCCESS);
+	EXPECT_EQ(queue.SetPriorityPolicy(MsvPriorityPolicy::MSV_PRIORITY_WEIGHTED), MSV_SUCCESS);
+	EXPECT_EQ(queue.SetPriorityWeights(4, 2, 1), MSV_SUCCESS);
+
+	PushTasks(queue, 10);
+
+	//one round of weighted round robin
+	std::shared_ptr<IMsvTask> tasks[7];
+	for (int32_t i = 0; i < 7; ++i)
+	{
+		EXPECT_EQ(queue.PopBatch(&tasks[i], 1), 1);
+	}
+
+	EXPECT_EQ(std::count(tasks, tasks + 7, m_spHighTask), 4);
+	EXPECT_EQ(std::count(tasks, tasks + 7, m_spNormalTask), 2);
+	EXPECT_EQ(std::count(tasks, tasks + 7, m_spLowTask), 1);
+}
+
+TEST_F(MsvPriorityTaskQueueTests, SetPriorityWeightsShouldFailedWhenWeightsAreInvalid)
+{
+	MsvPriorityTaskQueue queue;
+
+	EXPECT_EQ(queue.SetPriorityWeights(0, 1, 1), MSV_INVALID_DATA_ERROR);
+	EXPECT_EQ(queue.SetPriorityWeights(1, 1, MsvPriorityTaskQueue::MSV_MAX_PRIORITY_SCHEDULE_SIZE), MSV_INVALID_DATA_ERROR);
+	EXPECT_EQ(queue.SetPriorityWeights(1, 1, 1), MSV_SUCCESS);
+}
+
+TEST_F(MsvPriorityTaskQueueTests, AgingShouldServeStarvedLowPriorityTask)
+{
+	MsvPriorityTaskQueue queue;
+	EXPECT_EQ(queue.SetPriorityAging(8), MSV_SUCCESS);
+
+	for (int32_t i = 0; i < 100; ++i)
+	{
+		EXPECT_TRUE(queue.Push(m_spHighTask, MsvTaskPriority::MSV_TASK_PRIORITY_HIGH));
+	}
+	EXPECT_TRUE(queue.Push(m_spLowTask, MsvTaskPriority::MSV_TASK_PRIORITY_LOW));
+
+	//low priority task is popped after aging threshold (although there are high priority tasks)
+	int32_t lowTaskPop = -1;
+	for (int32_t i = 0; i < 20; ++i)
+	{
+		if (queue.Pop() == m_spLowTask)
+		{
+			lowTaskPop = i;
+			break;
+		}
+	}
+
+	EXPECT_EQ(lowTaskPop, 8);
+}
+
+TEST_F(MsvPriorityTaskQueueTests, BoundedBandShouldBeFullIndependently)
+{
+	MsvPriorityTaskQueue queue(2);
+
+	EXPECT_TRUE(queue.Push(m_spLowTask, MsvTaskPriority::MSV_TASK_PRIORITY_LOW));
+	EXPECT_TRUE(queue.Push(m_spLowTask, MsvTaskPriority::MSV_TASK_PRIORITY_LOW));
+	EXPECT_FALSE(queue.Push(m_spLowTask, MsvTaskPriority::MSV_TASK_PRIORITY_LOW));
+	EXPECT_TRUE(queue.Push(m_spHighTask, MsvTaskPriority::MSV_TASK_PRIORITY_HIGH));
+
+	EXPECT_EQ(queue.GetCapacity(), 2);
+	EXPECT_EQ(queue.GetSize(), 3);
+	EXPECT_EQ(queue.Pop(MsvTaskPriority::MSV_TASK_PRIORITY_LOW), m_spLowTask);
+	EXPECT_EQ(queue.GetSize(), 2);
+}
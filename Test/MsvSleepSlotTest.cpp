@@ -0,0 +1,75 @@
+#include "pch.h"
+
+
+#include "mthreading\MsvSleepSlot.h"
+
+#include <atomic>
+#include <thread>
+
+
+class MsvSleepSlotTests:
+	public::testing::Test
+{
+public:
+	MsvSleepSlotTests()
+	{
+
+	}
+
+	virtual void SetUp()
+	{
+
+	}
+
+	virtual void TearDown()
+	{
+
+	}
+
+	//tested class
+	MsvSleepSlot m_slot;
+};
+
+TEST_F(MsvSleepSlotTests, SignalShouldBeConsumedByTheNextWait)
+{
+	bool stopped = true;
+
+	EXPECT_FALSE(m_slot.TryWait(stopped));
+
+	//more signals before wait -> one wake up
+	m_slot.Signal();
+	m_slot.Signal();
+	EXPECT_TRUE(m_slot.IsSignaled());
+	EXPECT_TRUE(m_slot.TryWait(stopped));
+	EXPECT_FALSE(stopped);
+	EXPECT_FALSE(m_slot.IsSignaled());
+	EXPECT_FALSE(m_slot.TryWait(stopped));
+}
+
+TEST_F(MsvSleepSlotTests, WaitShouldReturnAfterTimeout)
+{
+	std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+
+	EXPECT_TRUE(m_slot.Wait(2000));
+	EXPECT_GE(std::chrono::steady_clock::now() - start, std::chrono::microseconds(2000));
+	EXPECT_FALSE(m_slot.IsSignaled());
+}
+
+TEST_F(MsvSleepSlotTests, SignalAndStopShouldWakeSleepingOwner)
+{
+	std::atomic<int32_t> woken(0);
+
+	std::thread thread([this, &woken]() { while (m_slot.Wait(0)) { ++woken; } });
+
+	m_slot.Signal();
+	while (!woken)
+	{
+		std::this_thread::sleep_for(std::chrono::microseconds(100));
+	}
+
+	m_slot.Stop();
+	thread.join();
+
+	EXPECT_GE(woken, 1);
+	EXPECT_FALSE(m_slot.Wait(0));
+}
@@ -0,0 +1,173 @@
+#include "pch.h"
+
+
+#include "mthreading\MsvTaskDeque.h"
+
+#include "mthreading\Mocks\MsvTask_Mock.h"
+
+#include <thread>
+#include <vector>
+#include <atomic>
+
+
+using namespace ::testing;
+
+
+class MsvTaskDequeTests:
+	public::testing::Test
+{
+public:
+	MsvTaskDequeTests()
+	{
+
+	}
+
+	virtual void SetUp()
+	{
+
+	}
+
+	virtual void TearDown()
+	{
+
+	}
+
+	//mocks
+	MsvTask_Mock m_task1;
+	MsvTask_Mock m_task2;
+	MsvTask_Mock m_task3;
+};
+
+TEST_F(MsvTaskDequeTests, ItShouldBeEmptyAfterCreate)
+{
+	MsvTaskDeque deque;
+
+	EXPECT_EQ(deque.GetSize(), 0);
+	EXPECT_EQ(deque.Pop(), nullptr);
+	EXPECT_EQ(deque.Steal(), nullptr);
+}
+
+TEST_F(MsvTaskDequeTests, OwnerShouldPopTheLatestTask)
+{
+	MsvTaskDeque deque;
+
+	EXPECT_TRUE(deque.Push(&m_task1));
+	EXPECT_TRUE(deque.Push(&m_task2));
+	EXPECT_TRUE(deque.Push(&m_task3));
+	EXPECT_EQ(deque.GetSize(), 3);
+
+	EXPECT_EQ(deque.Pop(), &m_task3);
+	EXPECT_EQ(deque.Pop(), &m_task2);
+	EXPECT_EQ(deque.Pop(), &m_task1);
+	EXPECT_EQ(deque.Pop(), nullptr);
+	EXPECT_EQ(deque.GetSize(), 0);
+}
+
+TEST_F(MsvTaskDequeTests, ThiefShouldStealTheOldestTask)
+{
+	MsvTaskDeque deque;
+
+	EXPECT_TRUE(deque.Push(&m_task1));
+	EXPECT_TRUE(deque.Push(&m_task2));
+	EXPECT_TRUE(deque.Push(&m_task3));
+
+	EXPECT_EQ(deque.Steal(), &m_task1);
+	EXPECT_EQ(deque.Pop(), &m_task3);
+	EXPECT_EQ(deque.Steal(), &m_task2);
+	EXPECT_EQ(deque.Steal(), nullptr);
+	EXPECT_EQ(deque.Pop(), nullptr);
+}
+
+TEST_F(MsvTaskDequeTests, ItShouldGrowWhenFull)
+{
+	MsvTaskDeque deque(2);
+
+	//more tasks than initial capacity
+	for (int32_t i = 0; i < 100; ++i)
+	{
+		EXPECT_TRUE(deque.Push(i % 2 ? &m_task2 : &m_task1));
+	}
+	EXPECT_EQ(deque.GetSize(), 100);
+
+	for (int32_t i = 0; i < 50; ++i)
+	{
+		EXPECT_EQ(deque.Steal(), i % 2 ? &m_task2 : &m_task1);
+	}
+	for (int32_t i = 99; i >= 50; --i)
+	{
+		EXPECT_EQ(deque.Pop(), i % 2 ? &m_task2 : &m_task1);
+	}
+	EXPECT_EQ(deque.GetSize(), 0);
+}
+
+TEST_F(MsvTaskDequeTests, ItShouldNotLoseOrDuplicateTasksWithManyThieves)
+{
+	const int32_t count = 20000;
+	std::vector<MsvTask_Mock> tasks(count);
+	std::unique_ptr<std::atomic<int32_t>[]> taken(new std::atomic<int32_t>[count]);
+	for (int32_t i = 0; i < count; ++i)
+	{
+		taken[i].store(0);
+	}
+
+	MsvTaskDeque deque(16);
+	std::atomic<int32_t> takenCount(0);
+	std::vector<std::thread> thieves;
+
+	//task index is its offset in tasks vector
+	auto takeTask = [&tasks, &taken, &takenCount](IMsvTask* pTask)
+	{
+		++taken[static_cast<MsvTask_Mock*>(pTask) - tasks.data()];
+		++takenCount;
+	};
+
+	for (int32_t i = 0; i < 4; ++i)
+	{
+		thieves.push_back(std::thread([&deque, &takenCount, &takeTask, count]()
+		{
+			while (takenCount.load() < count)
+			{
+				IMsvTask* pTask = deque.Steal();
+				if (pTask)
+				{
+					takeTask(pTask);
+				}
+			}
+		}));
+	}
+
+	//owner pushes tasks and pops some of them
+	for (int32_t i = 0; i < count; ++i)
+	{
+		EXPECT_TRUE(deque.Push(&tasks[i]));
+		if (i % 3 == 0)
+		{
+			IMsvTask* pTask = deque.Pop();
+			if (pTask)
+			{
+				takeTask(pTask);
+			}
+		}
+	}
+
+	//owner pops the rest
+	while (takenCount.load() < count)
+	{
+		IMsvTask* pTask = deque.Pop();
+		if (pTask)
+		{
+			takeTask(pTask);
+		}
+	}
+
+	for (std::vector<std::thread>::iterator it = thieves.begin(); it != thieves.end(); ++it)
+	{
+		it->join();
+	}
+
+	for (int32_t i = 0; i < count; ++i)
+	{
+		EXPECT_EQ(taken[i].load(), 1);
+	}
+	EXPECT_EQ(deque.GetSize(), 0);
+}
@@ -0,0 +1,176 @@
+#include "pch.h"
+
+
+#include "mthreading\MsvTaskGraph.h"
+#include "merror\MsvErrorCodes.h"
+
+#include "mthreading\Mocks\MsvThreadPool_Mock.h"
+#include "mthreading\Mocks\MsvTask_Mock.h"
+
+#include <stdexcept>
+#include <vector>
+
+
+using namespace ::testing;
+
+
+class MsvTaskGraphTests:
+	public::testing::Test
+{
+public:
+	MsvTaskGraphTests()
+	{
+
+	}
+
+	virtual void SetUp()
+	{
+		m_spThreadPool.reset(new (std::nothrow) NiceMock<MsvThreadPool_Mock>());
+		EXPECT_NE(m_spThreadPool, nullptr);
+
+		ON_CALL(*m_spThreadPool, AddTask(Matcher<std::shared_ptr<IMsvTask>>(_)))
+			.WillByDefault(Invoke([this](std::shared_ptr<IMsvTask> spTask) { m_tasks.push_back(spTask); return MSV_SUCCESS; }));
+		ON_CALL(*m_spThreadPool, IsWorkerThread())
+			.WillByDefault(Return(false));
+	}
+
+	virtual void TearDown()
+	{
+		m_tasks.clear();
+		m_spThreadPool.reset();
+	}
+
+	//adds node which records its execution
+	size_t AddNode(MsvTaskGraph& graph, int32_t id)
+	{
+		std::function<void()> task = [this, id]() { m_executed.push_back(id); };
+		size_t nodeId = 0;
+		EXPECT_EQ(graph.AddNode(task, &nodeId), MSV_SUCCESS);
+
+		return nodeId;
+	}
+
+	//executes tasks added to thread pool (in order of adding)
+	void ExecuteTasks()
+	{
+		for (size_t i = 0; i < m_tasks.size(); ++i)
+		{
+			std::shared_ptr<IMsvTask> spTask = m_tasks[i];
+			spTask->Execute();
+		}
+		m_tasks.clear();
+	}
+
+	//mocks
+	std::shared_ptr<NiceMock<MsvThreadPool_Mock>> m_spThreadPool;
+
+	//tasks added to thread pool
+	std::vector<std::shared_ptr<IMsvTask>> m_tasks;
+
+	//ids of executed nodes
+	std::vector<int32_t> m_executed;
+};
+
+TEST_F(MsvTaskGraphTests, AddShouldFailedWithInvalidData)
+{
+	MsvTaskGraph graph;
+	size_t nodeId = AddNode(graph, 0);
+
+	EXPECT_EQ(nodeId, 0);
+	EXPECT_EQ(graph.AddNode(std::shared_ptr<IMsvTask>()), MSV_INVALID_DATA_ERROR);
+	EXPECT_EQ(graph.AddEdge(nodeId, nodeId), MSV_INVALID_DATA_ERROR);
+	EXPECT_EQ(graph.AddEdge(nodeId, 1), MSV_INVALID_DATA_ERROR);
+	EXPECT_EQ(graph.GetNodeCount(), 1);
+}
+
+TEST_F(MsvTaskGraphTests, RunShouldFailedWhenGraphHasCycle)
+{
+	MsvTaskGraph graph;
+	size_t node0 = AddNode(graph, 0);
+	size_t node1 = AddNode(graph, 1);
+	size_t node2 = AddNode(graph, 2);
+
+	EXPECT_EQ(graph.AddEdge(node0, node1), MSV_SUCCESS);
+	EXPECT_EQ(graph.AddEdge(node1, node2), MSV_SUCCESS);
+	EXPECT_EQ(graph.AddEdge(node2, node1), MSV_SUCCESS);
+
+	EXPECT_EQ(graph.Run(nullptr), MSV_NOT_INITIALIZED_ERROR);
+	EXPECT_EQ(graph.Run(m_spThreadPool), MSV_INVALID_DATA_ERROR);
+	EXPECT_FALSE(graph.IsRunning());
+	EXPECT_TRUE(m_tasks.empty());
+}
+
+TEST_F(MsvTaskGraphTests, ReadySuccessorShouldBeExecutedByTheSameThread)
+{
+	//diamond: 0 -> (1, 2) -> 3
+	MsvTaskGraph graph;
+	size_t node0 = AddNode(graph, 0);
+	size_t node1 = AddNode(graph, 1);
+	size_t node2 = AddNode(graph, 2);
+	size_t node3 = AddNode(graph, 3);
+
+	EXPECT_EQ(graph.AddEdge(node0, node1), MSV_SUCCESS);
+	EXPECT_EQ(graph.AddEdge(node0, node2), MSV_SUCCESS);
+	EXPECT_EQ(graph.AddEdge(node1, node3), MSV_SUCCESS);
+	EXPECT_EQ(graph.AddEdge(node2, node3), MSV_SUCCESS);
+
+	EXPECT_EQ(graph.Run(m_spThreadPool), MSV_SUCCESS);
+	EXPECT_TRUE(graph.IsRunning());
+	EXPECT_EQ(graph.Run(m_spThreadPool), MSV_ALREADY_RUNNING_INFO);
+	EXPECT_EQ(graph.AddEdge(node0, node3), MSV_ALREADY_RUNNING_INFO);
+	EXPECT_EQ(m_tasks.size(), 1);
+
+	//root -> node 1 continues in the same task, node 2 is added to thread pool
+	m_tasks[0]->Execute();
+	EXPECT_EQ(m_executed, std::vector<int32_t>({ 0, 1 }));
+	EXPECT_EQ(m_tasks.size(), 2);
+
+	//node 2 -> node 3 continues in the same task
+	m_tasks[1]->Execute();
+	EXPECT_EQ(m_executed, std::vector<int32_t>({ 0, 1, 2, 3 }));
+	EXPECT_EQ(m_tasks.size(), 2);
+
+	EXPECT_FALSE(graph.IsRunning());
+	EXPECT_NO_THROW(graph.Wait());
+	m_tasks.clear();
+}
+
+TEST_F(MsvTaskGraphTests, GraphShouldBeReusable)
+{
+	MsvTaskGraph graph;
+	size_t node0 = AddNode(graph, 0);
+	size_t node1 = AddNode(graph, 1);
+	size_t node2 = AddNode(graph, 2);
+
+	EXPECT_EQ(graph.AddEdge(node0, node2), MSV_SUCCESS);
+	EXPECT_EQ(graph.AddEdge(node1, node2), MSV_SUCCESS);
+
+	for (int32_t i = 0; i < 3; ++i)
+	{
+		m_executed.clear();
+
+		EXPECT_EQ(graph.Run(m_spThreadPool), MSV_SUCCESS);
+		ExecuteTasks();
+
+		EXPECT_EQ(m_executed, std::vector<int32_t>({ 0, 1, 2 }));
+		EXPECT_FALSE(graph.IsRunning());
+		graph.Wait();
+	}
+}
+
+TEST_F(MsvTaskGraphTests, WaitShouldRethrowExceptionOfNode)
+{
+	MsvTaskGraph graph;
+	std::function<void()> task = []() { throw std::runtime_error("error"); };
+	size_t node0 = 0;
+	EXPECT_EQ(graph.AddNode(task, &node0), MSV_SUCCESS);
+	size_t node1 = AddNode(graph, 1);
+	EXPECT_EQ(graph.AddEdge(node0, node1), MSV_SUCCESS);
+
+	EXPECT_EQ(graph.Run(m_spThreadPool), MSV_SUCCESS);
+	ExecuteTasks();
+
+	//successors are executed anyway
+	EXPECT_EQ(m_executed, std::vector<int32_t>({ 1 }));
+	EXPECT_THROW(graph.Wait(), std::runtime_error);
+}
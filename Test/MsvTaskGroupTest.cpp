@@ -0,0 +1,142 @@
+#include "pch.h"
+
+
+#include "mthreading\MsvTaskGroup.h"
+#include "merror\MsvErrorCodes.h"
+
+#include "mthreading\Mocks\MsvThreadPool_Mock.h"
+#include "mthreading\Mocks\MsvTask_Mock.h"
+
+#include <stdexcept>
+#include <vector>
+
+
+using namespace ::testing;
+
+
+class MsvTaskGroupTests:
+	public::testing::Test
+{
+public:
+	MsvTaskGroupTests()
+	{
+
+	}
+
+	virtual void SetUp()
+	{
+		m_spThreadPool.reset(new (std::nothrow) NiceMock<MsvThreadPool_Mock>());
+		m_spTask.reset(new (std::nothrow) MsvTask_Mock());
+
+		EXPECT_NE(m_spThreadPool, nullptr);
+		EXPECT_NE(m_spTask, nullptr);
+
+		ON_CALL(*m_spThreadPool, AddTask(Matcher<std::shared_ptr<IMsvTask>>(_)))
+			.WillByDefault(Invoke([this](std::shared_ptr<IMsvTask> spTask) { m_tasks.push_back(spTask); return MSV_SUCCESS; }));
+		ON_CALL(*m_spThreadPool, IsWorkerThread())
+			.WillByDefault(Return(false));
+	}
+
+	virtual void TearDown()
+	{
+		m_tasks.clear();
+		m_spThreadPool.reset();
+		m_spTask.reset();
+	}
+
+	//executes tasks added to thread pool
+	void ExecuteTasks()
+	{
+		for (std::shared_ptr<IMsvTask>& spTask: m_tasks)
+		{
+			spTask->Execute();
+		}
+		m_tasks.clear();
+	}
+
+	//mocks
+	std::shared_ptr<NiceMock<MsvThreadPool_Mock>> m_spThreadPool;
+	std::shared_ptr<MsvTask_Mock> m_spTask;
+
+	//tasks added to thread pool
+	std::vector<std::shared_ptr<IMsvTask>> m_tasks;
+};
+
+TEST_F(MsvTaskGroupTests, AddTaskShouldFailedWithoutThreadPool)
+{
+	MsvTaskGroup group(nullptr);
+
+	EXPECT_EQ(group.AddTask(m_spTask), MSV_NOT_INITIALIZED_ERROR);
+	EXPECT_EQ(group.GetPendingTaskCount(), 0);
+	EXPECT_NO_THROW(group.Wait());
+}
+
+TEST_F(MsvTaskGroupTests, AddTaskShouldNotCountTaskWhichWasNotAdded)
+{
+	MsvTaskGroup group(m_spThreadPool);
+
+	EXPECT_CALL(*m_spThreadPool, AddTask(Matcher<std::shared_ptr<IMsvTask>>(_)))
+		.WillOnce(Return(MSV_ALLOCATION_ERROR));
+
+	EXPECT_EQ(group.AddTask(m_spTask), MSV_ALLOCATION_ERROR);
+	EXPECT_EQ(group.GetPendingTaskCount(), 0);
+}
+
+TEST_F(MsvTaskGroupTests, AddTaskShouldSkipNullptrTask)
+{
+	MsvTaskGroup group(m_spThreadPool);
+
+	EXPECT_CALL(*m_spThreadPool, AddTask(Matcher<std::shared_ptr<IMsvTask>>(_)))
+		.Times(0);
+
+	EXPECT_EQ(group.AddTask(std::shared_ptr<IMsvTask>()), MSV_SUCCESS);
+	EXPECT_EQ(group.GetPendingTaskCount(), 0);
+	EXPECT_NO_THROW(group.Wait());
+}
+
+TEST_F(MsvTaskGroupTests, WaitShouldReturnWhenAllTasksAreExecuted)
+{
+	MsvTaskGroup group(m_spThreadPool);
+
+	EXPECT_CALL(*m_spTask, Execute())
+		.Times(2);
+
+	EXPECT_EQ(group.AddTask(m_spTask), MSV_SUCCESS);
+	EXPECT_EQ(group.AddTask(m_spTask), MSV_SUCCESS);
+	EXPECT_EQ(group.GetPendingTaskCount(), 2);
+
+	ExecuteTasks();
+
+	EXPECT_EQ(group.GetPendingTaskCount(), 0);
+	EXPECT_NO_THROW(group.Wait());
+}
+
+TEST_F(MsvTaskGroupTests, WaitShouldRethrowExceptionOfTask)
+{
+	MsvTaskGroup group(m_spThreadPool);
+	std::function<void()> task = []() { throw std::runtime_error("error"); };
+
+	EXPECT_EQ(group.AddTask(task), MSV_SUCCESS);
+	ExecuteTasks();
+
+	EXPECT_THROW(group.Wait(), std::runtime_error);
+	EXPECT_NO_THROW(group.Wait());
+}
+
+TEST_F(MsvTaskGroupTests, WorkerShouldExecuteQueuedTasksWhileWaiting)
+{
+	MsvTaskGroup group(m_spThreadPool);
+
+	EXPECT_CALL(*m_spTask, Execute())
+		.Times(1);
+
+	EXPECT_EQ(group.AddTask(m_spTask), MSV_SUCCESS);
+
+	EXPECT_CALL(*m_spThreadPool, IsWorkerThread())
+		.WillRepeatedly(Return(true));
+	EXPECT_CALL(*m_spThreadPool, TryExecuteTask())
+		.WillOnce(Invoke([this]() { ExecuteTasks(); return true; }));
+
+	group.Wait();
+	EXPECT_EQ(group.GetPendingTaskCount(), 0);
+}
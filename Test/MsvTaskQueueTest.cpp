@@ -0,0 +1,250 @@
+#include "pch.h"
+
+
+#include "mthreading\MsvTaskQueue.h"
+#include "merror\MsvErrorCodes.h"
+
+#include "mthreading\Mocks\MsvTask_Mock.h"
+
+#include <thread>
+#include <vector>
+#include <atomic>
+
+
+using namespace ::testing;
+
+
+class MsvTaskQueueTests:
+	public::testing::Test
+{
+public:
+	MsvTaskQueueTests()
+	{
+
+	}
+
+	virtual void SetUp()
+	{
+		m_spTask1.reset(new (std::nothrow) MsvTask_Mock());
+		m_spTask2.reset(new (std::nothrow) MsvTask_Mock());
+		m_spTask3.reset(new (std::nothrow) MsvTask_Mock());
+
+		EXPECT_NE(m_spTask1, nullptr);
+		EXPECT_NE(m_spTask2, nullptr);
+		EXPECT_NE(m_spTask3, nullptr);
+	}
+
+	virtual void TearDown()
+	{
+		m_spTask1.reset();
+		m_spTask2.reset();
+		m_spTask3.reset();
+	}
+
+	//pushes count tasks from producerCount threads and pops them by consumerCount threads (batchSize tasks at once)
+	void PushAndPopConcurrently(MsvTaskQueue& queue, int32_t producerCount, int32_t consumerCount, int32_t count, size_t batchSize = 1)
+	{
+		std::atomic<int32_t> popped(0);
+		std::vector<std::thread> threads;
+
+		for (int32_t i = 0; i < producerCount; ++i)
+		{
+			threads.push_back(std::thread([this, &queue, count]()
+			{
+				for (int32_t j = 0; j < count; ++j)
+				{
+					while (!queue.Push(m_spTask1))
+					{
+						std::this_thread::yield();
+					}
+				}
+			}));
+		}
+
+		for (int32_t i = 0; i < consumerCount; ++i)
+		{
+			threads.push_back(std::thread([&queue, &popped, producerCount, count, batchSize]()
+			{
+				std::vector<std::shared_ptr<IMsvTask>> tasks(batchSize);
+				while (popped.load() < producerCount * count)
+				{
+					if (batchSize == 1)
+					{
+						if (queue.Pop())
+						{
+							++popped;
+						}
+						continue;
+					}
+
+					size_t poppedCount = queue.PopBatch(tasks.data(), batchSize);
+					for (size_t i = 0; i < poppedCount; ++i)
+					{
+						EXPECT_NE(tasks[i], nullptr);
+					}
+					popped += static_cast<int32_t>(poppedCount);
+				}
+			}));
+		}
+
+		for (std::vector<std::thread>::iterator it = threads.begin(); it != threads.end(); ++it)
+		{
+			it->join();
+		}
+
+		EXPECT_EQ(popped.load(), producerCount * count);
+		EXPECT_EQ(queue.GetSize(), 0);
+		EXPECT_EQ(queue.Pop(), nullptr);
+	}
+
+	//mocks
+	std::shared_ptr<MsvTask_Mock> m_spTask1;
+	std::shared_ptr<MsvTask_Mock> m_spTask2;
+	std::shared_ptr<MsvTask_Mock> m_spTask3;
+};
+
+TEST_F(MsvTaskQueueTests, ItShouldBeEmptyAfterCreate)
+{
+	MsvTaskQueue unboundedQueue;
+	MsvTaskQueue boundedQueue(16);
+
+	EXPECT_EQ(unboundedQueue.GetSize(), 0);
+	EXPECT_EQ(unboundedQueue.GetCapacity(), 0);
+	EXPECT_EQ(unboundedQueue.Pop(), nullptr);
+
+	EXPECT_EQ(boundedQueue.GetSize(), 0);
+	EXPECT_EQ(boundedQueue.GetCapacity(), 16);
+	EXPECT_EQ(boundedQueue.Pop(), nullptr);
+}
+
+TEST_F(MsvTaskQueueTests, BoundedQueueShouldBeFirstInFirstOut)
+{
+	MsvTaskQueue queue(3);
+
+	EXPECT_TRUE(queue.Push(m_spTask1));
+	EXPECT_TRUE(queue.Push(m_spTask2));
+	EXPECT_TRUE(queue.Push(m_spTask3));
+	EXPECT_EQ(queue.GetSize(), 3);
+
+	EXPECT_EQ(queue.Pop(), m_spTask1);
+	EXPECT_EQ(queue.Pop(), m_spTask2);
+	EXPECT_EQ(queue.Pop(), m_spTask3);
+	EXPECT_EQ(queue.Pop(), nullptr);
+	EXPECT_EQ(queue.GetSize(), 0);
+}
+
+TEST_F(MsvTaskQueueTests, BoundedQueueShouldRejectTaskWhenFull)
+{
+	MsvTaskQueue queue(2);
+
+	EXPECT_TRUE(queue.Push(m_spTask1));
+	EXPECT_TRUE(queue.Push(m_spTask2));
+	EXPECT_FALSE(queue.Push(m_spTask3));
+	EXPECT_EQ(queue.GetSize(), 2);
+
+	//there is a space after pop (next lap of ring buffer)
+	EXPECT_EQ(queue.Pop(), m_spTask1);
+	EXPECT_TRUE(queue.Push(m_spTask3));
+	EXPECT_EQ(queue.Pop(), m_spTask2);
+	EXPECT_EQ(queue.Pop(), m_spTask3);
+	EXPECT_EQ(queue.Pop(), nullptr);
+}
+
+TEST_F(MsvTaskQueueTests, UnboundedQueueShouldBeFirstInFirstOutAcrossSegments)
+{
+	MsvTaskQueue queue;
+
+	//more tasks than one segment can hold
+	for (int32_t i = 0; i < 1000; ++i)
+	{
+		EXPECT_TRUE(queue.Push(i % 2 ? m_spTask2 : m_spTask1));
+	}
+	EXPECT_EQ(queue.GetSize(), 1000);
+
+	for (int32_t i = 0; i < 1000; ++i)
+	{
+		EXPECT_EQ(queue.Pop(), i % 2 ? m_spTask2 : m_spTask1);
+	}
+	EXPECT_EQ(queue.Pop(), nullptr);
+	EXPECT_EQ(queue.GetSize(), 0);
+}
+
+TEST_F(MsvTaskQueueTests, BoundedQueueShouldNotLoseTasksWithManyProducersAndConsumers)
+{
+	MsvTaskQueue queue(64);
+	PushAndPopConcurrently(queue, 4, 4, 20000);
+}
+
+TEST_F(MsvTaskQueueTests, UnboundedQueueShouldNotLoseTasksWithManyProducersAndConsumers)
+{
+	MsvTaskQueue queue;
+	PushAndPopConcurrently(queue, 4, 4, 20000);
+}
+
+TEST_F(MsvTaskQueueTests, BoundedQueueShouldPopBatchInFirstInFirstOutOrder)
+{
+	MsvTaskQueue queue(4);
+	std::shared_ptr<IMsvTask> tasks[4];
+
+	EXPECT_EQ(queue.PopBatch(tasks, 4), 0);
+
+	EXPECT_TRUE(queue.Push(m_spTask1));
+	EXPECT_TRUE(queue.Push(m_spTask2));
+	EXPECT_TRUE(queue.Push(m_spTask3));
+
+	EXPECT_EQ(queue.PopBatch(tasks, 2), 2);
+	EXPECT_EQ(tasks[0], m_spTask1);
+	EXPECT_EQ(tasks[1], m_spTask2);
+
+	//batch wraps around ring buffer
+	EXPECT_TRUE(queue.Push(m_spTask1));
+	EXPECT_TRUE(queue.Push(m_spTask2));
+	EXPECT_TRUE(queue.Push(m_spTask3));
+	EXPECT_EQ(queue.GetSize(), 4);
+
+	EXPECT_EQ(queue.PopBatch(tasks, 4), 4);
+	EXPECT_EQ(tasks[0], m_spTask3);
+	EXPECT_EQ(tasks[1], m_spTask1);
+	EXPECT_EQ(tasks[2], m_spTask2);
+	EXPECT_EQ(tasks[3], m_spTask3);
+	EXPECT_EQ(queue.GetSize(), 0);
+	EXPECT_EQ(queue.PopBatch(tasks, 4), 0);
+}
+
+TEST_F(MsvTaskQueueTests, UnboundedQueueShouldPopBatchAcrossSegments)
+{
+	MsvTaskQueue queue;
+	std::shared_ptr<IMsvTask> tasks[64];
+
+	for (int32_t i = 0; i < 1000; ++i)
+	{
+		EXPECT_TRUE(queue.Push(i % 2 ? m_spTask2 : m_spTask1));
+	}
+
+	//batch never crosses segment -> it can be shorter
+	int32_t popped = 0;
+	size_t count = 0;
+	while ((count = queue.PopBatch(tasks, 64)) != 0)
+	{
+		EXPECT_LE(count, 64);
+		for (size_t i = 0; i < count; ++i, ++popped)
+		{
+			EXPECT_EQ(tasks[i], popped % 2 ? m_spTask2 : m_spTask1);
+		}
+	}
+
+	EXPECT_EQ(popped, 1000);
+	EXPECT_EQ(queue.GetSize(), 0);
+}
+
+TEST_F(MsvTaskQueueTests, BoundedQueueShouldNotLoseTasksWithBatchConsumers)
+{
+	MsvTaskQueue queue(64);
+	PushAndPopConcurrently(queue, 4, 4, 20000, 8);
+}
+
+TEST_F(MsvTaskQueueTests, UnboundedQueueShouldNotLoseTasksWithBatchConsumers)
+{
+	MsvTaskQueue queue;
+	PushAndPopConcurrently(queue, 4, 4, 20000, 8);
+}
@@ -0,0 +1,96 @@
+#include "pch.h"
+
+
+#include "mthreading\MsvTaskWaiter.h"
+
+#include "mthreading\Mocks\MsvThreadPool_Mock.h"
+
+#include <thread>
+
+
+using namespace ::testing;
+
+
+class MsvTaskWaiterTests:
+	public::testing::Test
+{
+public:
+	MsvTaskWaiterTests()
+	{
+
+	}
+
+	virtual void SetUp()
+	{
+		m_spThreadPool.reset(new (std::nothrow) NiceMock<MsvThreadPool_Mock>());
+		EXPECT_NE(m_spThreadPool, nullptr);
+	}
+
+	virtual void TearDown()
+	{
+		m_spThreadPool.reset();
+	}
+
+	//mocks
+	std::shared_ptr<NiceMock<MsvThreadPool_Mock>> m_spThreadPool;
+};
+
+TEST_F(MsvTaskWaiterTests, WaitShouldReturnWithoutPendingTasks)
+{
+	MsvTaskWaiter waiter;
+
+	EXPECT_TRUE(waiter.IsInitialized());
+	EXPECT_EQ(waiter.GetPendingCount(), 0);
+
+	waiter.Wait(nullptr);
+	waiter.Wait(m_spThreadPool);
+}
+
+TEST_F(MsvTaskWaiterTests, DoneShouldCountDownPendingTasks)
+{
+	MsvTaskWaiter waiter;
+
+	waiter.Add();
+	waiter.Add(2);
+	EXPECT_EQ(waiter.GetPendingCount(), 3);
+
+	waiter.Done();
+	waiter.Done();
+	EXPECT_EQ(waiter.GetPendingCount(), 1);
+
+	waiter.Done();
+	EXPECT_EQ(waiter.GetPendingCount(), 0);
+}
+
+TEST_F(MsvTaskWaiterTests, WorkerShouldExecuteTasksWhileItWaits)
+{
+	MsvTaskWaiter waiter;
+	waiter.Add(3);
+
+	EXPECT_CALL(*m_spThreadPool, IsWorkerThread())
+		.WillOnce(Return(true));
+	EXPECT_CALL(*m_spThreadPool, TryExecuteTask())
+		.Times(3)
+		.WillRepeatedly(Invoke([&waiter]() { waiter.Done(); return true; }));
+
+	waiter.Wait(m_spThreadPool);
+	EXPECT_EQ(waiter.GetPendingCount(), 0);
+}
+
+TEST_F(MsvTaskWaiterTests, OtherThreadShouldWaitForLastTask)
+{
+	MsvTaskWaiter waiter;
+	waiter.Add(2);
+
+	EXPECT_CALL(*m_spThreadPool, IsWorkerThread())
+		.WillOnce(Return(false));
+	EXPECT_CALL(*m_spThreadPool, TryExecuteTask())
+		.Times(0);
+
+	std::thread thread([&waiter]() { waiter.Done(); waiter.Done(); });
+
+	waiter.Wait(m_spThreadPool);
+	EXPECT_EQ(waiter.GetPendingCount(), 0);
+
+	thread.join();
+}
@@ -3,6 +3,8 @@
 
 
 #include "mthreading\MsvThreadPool.h"
+#include "mthreading\MsvBlockingScope.h"
+#include "mthreading\MsvThreadingErrorCodes.h"
 #include "merror\MsvErrorCodes.h"
 #include "merror\MsvException.h"
 
@@ -18,15 +20,20 @@ class TestMsvThreadPoolObject:
 	public MsvThreadPool
 {
 public:
-	TestMsvThreadPoolObject(std::shared_ptr<MsvThreadPool_Factory> spFactory = nullptr):
-		MsvThreadPool(spFactory)
+	TestMsvThreadPoolObject(std::shared_ptr<MsvThreadPool_Factory> spFactory = nullptr, size_t taskQueueCapacity = 0):
+		MsvThreadPool(spFactory, taskQueueCapacity)
 	{
 
 	}
 
-	/*const */std::queue<std::shared_ptr<IMsvTask>>& GetTasks()
+	std::shared_ptr<IMsvPriorityTaskQueue>& GetTasks()
 	{
-		return m_taskQueue;
+		return m_spTaskQueue;
+	}
+
+	std::shared_ptr<IMsvDeadlineTaskQueue>& GetDeadlineTasks()
+	{
+		return m_spDeadlineTaskQueue;
 	}
 
 	const std::vector<std::shared_ptr<IMsvUniqueWorker>>& GetWorkers()
@@ -34,19 +41,49 @@ public:
 		return m_workers;
 	}
 
-	std::shared_ptr<std::condition_variable>& GetSharedCondition()
+	std::shared_ptr<MsvIdleWorkerStack>& GetIdleWorkers()
+	{
+		return m_spIdleWorkers;
+	}
+
+	const std::vector<std::unique_ptr<MsvTaskDeque>>& GetTaskDeques()
+	{
+		return m_taskDeques;
+	}
+
+	size_t GetDequeueBatchSize()
+	{
+		return m_dequeueBatchSize.load();
+	}
+
+	bool ExecuteBatch()
+	{
+		return ExecuteTaskBatch();
+	}
+
+	void ClimbTarget(double throughput)
 	{
-		return m_spSharedCondition;
+		ClimbTargetWorkerCount(throughput);
 	}
 
-	std::shared_ptr<std::mutex>& GetSharedMutex()
+	void SetTargetWorkerCount(size_t targetWorkers)
 	{
-		return m_spSharedConditionMutex;
+		m_targetWorkers.store(targetWorkers);
 	}
 
-	std::shared_ptr<std::uint64_t>& GetSharedPredicate()
+	void AddActiveWorkers(size_t count)
 	{
-		return m_spSharedConditionPredicate;
+		m_activeWorkers += count;
+	}
+
+	bool TryPark()
+	{
+		return TryParkWorker();
+	}
+
+	void RunWorker(size_t workerIndex)
+	{
+		ExecuteTask(workerIndex);
 	}
 };
 
@@ -95,7 +132,7 @@ public:
 TEST_F(MsvThreadPoolTests, ItShouldNotBeRunningAfterCreate)
 {
 	EXPECT_FALSE(m_spThreadPool->IsRunning());
-	EXPECT_EQ(m_spThreadPool->GetTasks().size(), 0);
+	EXPECT_EQ(m_spThreadPool->GetTasks()->GetSize(), 0);
 	EXPECT_EQ(m_spThreadPool->GetWorkers().size(), 0);
 }
 
@@ -118,14 +155,43 @@ TEST_F(MsvThreadPoolTests, ItShouldBeAbleToAddTaskIfThreadPoolIsNotRunning)
 	EXPECT_FALSE(m_spThreadPool->IsRunning());
 	EXPECT_EQ(m_spThreadPool->GetWorkers().size(), 0);
 
-	EXPECT_EQ(m_spThreadPool->GetTasks().size(), 3);
-	EXPECT_EQ(m_spThreadPool->GetTasks().front(), m_spTask);
-	m_spThreadPool->GetTasks().pop();
-	EXPECT_EQ(m_spThreadPool->GetTasks().front(), m_spTask);
-	m_spThreadPool->GetTasks().pop();
-	EXPECT_EQ(m_spThreadPool->GetTasks().front(), m_spTask);
-	m_spThreadPool->GetTasks().pop();
-	EXPECT_EQ(m_spThreadPool->GetTasks().size(), 0);
+	EXPECT_EQ(m_spThreadPool->GetTasks()->GetSize(), 3);
+	EXPECT_EQ(m_spThreadPool->GetTasks()->Pop(), m_spTask);
+	EXPECT_EQ(m_spThreadPool->GetTasks()->Pop(), m_spTask);
+	EXPECT_EQ(m_spThreadPool->GetTasks()->Pop(), m_spTask);
+	EXPECT_EQ(m_spThreadPool->GetTasks()->GetSize(), 0);
+	EXPECT_EQ(m_spThreadPool->GetTasks()->Pop(), nullptr);
+}
+
+TEST_F(MsvThreadPoolTests, ItShouldBeAbleToAddTasksIfThreadPoolIsNotRunning)
+{
+	std::shared_ptr<MsvTask_Mock> spTask2(new (std::nothrow) MsvTask_Mock());
+	std::vector<std::shared_ptr<MsvTask_Mock>> derivedTasks = { m_spTask, spTask2 };
+	std::vector<std::shared_ptr<IMsvTask>> tasks = { spTask2, m_spTask };
+
+	EXPECT_EQ(m_spThreadPool->AddTasks({ m_spTask, nullptr, spTask2 }), MSV_SUCCESS);
+	EXPECT_EQ(m_spThreadPool->AddTasks(derivedTasks), MSV_SUCCESS);
+	EXPECT_EQ(m_spThreadPool->AddTasks(tasks), MSV_SUCCESS);
+	EXPECT_EQ(m_spThreadPool->AddTasks(tasks.begin(), tasks.begin() + 1), MSV_SUCCESS);
+
+	//nullptr task is skipped and nobody is woken up (there is no worker)
+	EXPECT_EQ(m_spThreadPool->GetIdleWorkers()->GetPermitCount(), 0);
+	EXPECT_EQ(m_spThreadPool->GetTasks()->GetSize(), 7);
+	EXPECT_EQ(m_spThreadPool->GetTasks()->Pop(), m_spTask);
+	EXPECT_EQ(m_spThreadPool->GetTasks()->Pop(), spTask2);
+	EXPECT_EQ(m_spThreadPool->GetTasks()->Pop(), m_spTask);
+	EXPECT_EQ(m_spThreadPool->GetTasks()->Pop(), spTask2);
+	EXPECT_EQ(m_spThreadPool->GetTasks()->Pop(), spTask2);
+	EXPECT_EQ(m_spThreadPool->GetTasks()->Pop(), m_spTask);
+	EXPECT_EQ(m_spThreadPool->GetTasks()->Pop(), spTask2);
+	EXPECT_EQ(m_spThreadPool->GetTasks()->Pop(), nullptr);
+}
+
+TEST_F(MsvThreadPoolTests, AddTasksShouldFailedWhenTaskQueueIsNull)
+{
+	m_spThreadPool->GetTasks().reset();
+
+	EXPECT_EQ(m_spThreadPool->AddTasks({ m_spTask }), MSV_ALLOCATION_ERROR);
 }
 
 TEST_F(MsvThreadPoolTests, AddTaskShouldFailedWhenNullptrIsReturned)
@@ -140,13 +206,25 @@ TEST_F(MsvThreadPoolTests, AddTaskShouldFailedWhenNullptrIsReturned)
 
 	EXPECT_EQ(m_spThreadPool->AddTask(m_voidContextFunction, this), MSV_ALLOCATION_ERROR);
 
-	EXPECT_EQ(m_spThreadPool->GetTasks().size(), 0);
+	EXPECT_EQ(m_spThreadPool->GetTasks()->GetSize(), 0);
+}
+
+TEST_F(MsvThreadPoolTests, StartThreadPoolShouldFailedWhenTaskQueueIsNull)
+{
+	m_spThreadPool->GetTasks().reset();
+
+	EXPECT_CALL(*m_spThreadPoolFactoryMock, GetIMsvTask(Matcher<std::function<void()>&>(_)))
+		.WillOnce(Return(m_spTask));
+
+	EXPECT_EQ(m_spThreadPool->AddTask(m_voidFunction), MSV_ALLOCATION_ERROR);
+	EXPECT_EQ(m_spThreadPool->StartThreadPool(1), MSV_ALLOCATION_ERROR);
+	EXPECT_FALSE(m_spThreadPool->IsRunning());
 }
 
 //also tests StartThreadPool success
 TEST_F(MsvThreadPoolTests, StartThreadPoolShouldReturnInfoWhenAlreadyRunning)
 {
-	EXPECT_CALL(*m_spThreadPoolFactoryMock, GetIMsvUniqueWorker(m_spThreadPool->GetSharedCondition(), m_spThreadPool->GetSharedMutex(), m_spThreadPool->GetSharedPredicate()))
+	EXPECT_CALL(*m_spThreadPoolFactoryMock, GetIMsvUniqueWorker(m_spThreadPool->GetIdleWorkers()))
 		.WillOnce(Return(m_spUniqueWorker));
 
 	EXPECT_CALL(*m_spUniqueWorker, SetTask(Matcher<std::function<void()>&>(_)))
@@ -160,9 +238,517 @@ TEST_F(MsvThreadPoolTests, StartThreadPoolShouldReturnInfoWhenAlreadyRunning)
 	EXPECT_TRUE(m_spThreadPool->IsRunning());
 }
 
-TEST_F(MsvThreadPoolTests, StartThreadPoolShouldFailedWhenSharedConditionVariableIsNull)
+TEST_F(MsvThreadPoolTests, SetWorkStealingShouldReturnInfoWhenAlreadyRunning)
+{
+	EXPECT_CALL(*m_spThreadPoolFactoryMock, GetIMsvUniqueWorker(m_spThreadPool->GetIdleWorkers()))
+		.WillOnce(Return(m_spUniqueWorker));
+
+	EXPECT_CALL(*m_spUniqueWorker, SetTask(Matcher<std::function<void()>&>(_)))
+		.WillOnce(Return(MSV_SUCCESS));
+
+	EXPECT_CALL(*m_spUniqueWorker, StartThread(0))
+		.WillOnce(Return(MSV_SUCCESS));
+
+	EXPECT_EQ(m_spThreadPool->SetWorkStealing(true), MSV_SUCCESS);
+	EXPECT_EQ(m_spThreadPool->StartThreadPool(1), MSV_SUCCESS);
+	EXPECT_EQ(m_spThreadPool->GetTaskDeques().size(), 1);
+	EXPECT_EQ(m_spThreadPool->SetWorkStealing(false), MSV_ALREADY_RUNNING_INFO);
+}
+
+TEST_F(MsvThreadPoolTests, WaitForThreadPoolStopShouldExecuteTasksLeftInWorkerDeques)
+{
+	EXPECT_CALL(*m_spThreadPoolFactoryMock, GetIMsvUniqueWorker(m_spThreadPool->GetIdleWorkers()))
+		.WillOnce(Return(m_spUniqueWorker));
+	EXPECT_CALL(*m_spUniqueWorker, SetTask(Matcher<std::function<void()>&>(_)))
+		.WillOnce(Return(MSV_SUCCESS));
+	EXPECT_CALL(*m_spUniqueWorker, StartThread(0))
+		.WillOnce(Return(MSV_SUCCESS));
+	EXPECT_CALL(*m_spUniqueWorker, StopThread())
+		.WillOnce(Return(MSV_SUCCESS));
+	EXPECT_CALL(*m_spUniqueWorker, WaitForThreadStop(_))
+		.WillOnce(Return(MSV_SUCCESS));
+
+	EXPECT_EQ(m_spThreadPool->SetWorkStealing(true), MSV_SUCCESS);
+	EXPECT_EQ(m_spThreadPool->StartThreadPool(1), MSV_SUCCESS);
+
+	//owned task and task without owner (its owner waits for it) are left in the deque of stopped worker
+	EXPECT_TRUE(m_spThreadPool->GetTaskDeques()[0]->Push(new (std::nothrow) MsvOwnedTask(m_spTask)));
+	EXPECT_TRUE(m_spThreadPool->GetTaskDeques()[0]->Push(m_spTask.get()));
+
+	EXPECT_CALL(*m_spTask, Execute())
+		.Times(2);
+
+	EXPECT_EQ(m_spThreadPool->StopAndWaitForThreadPoolStop(), MSV_SUCCESS);
+	EXPECT_EQ(m_spThreadPool->GetTaskDeques()[0]->GetSize(), 0);
+}
+
+TEST_F(MsvThreadPoolTests, SetDequeueBatchSizeShouldClampBatchSize)
+{
+	EXPECT_EQ(m_spThreadPool->GetDequeueBatchSize(), 1);
+
+	EXPECT_EQ(m_spThreadPool->SetDequeueBatchSize(0), MSV_SUCCESS);
+	EXPECT_EQ(m_spThreadPool->GetDequeueBatchSize(), 1);
+
+	EXPECT_EQ(m_spThreadPool->SetDequeueBatchSize(16), MSV_SUCCESS);
+	EXPECT_EQ(m_spThreadPool->GetDequeueBatchSize(), 16);
+
+	EXPECT_EQ(m_spThreadPool->SetDequeueBatchSize(100000), MSV_SUCCESS);
+	EXPECT_EQ(m_spThreadPool->GetDequeueBatchSize(), MsvThreadPool::MSV_MAX_DEQUEUE_BATCH_SIZE);
+}
+
+TEST_F(MsvThreadPoolTests, SetElasticWorkersShouldFailedWhenBoundsAreInvalid)
+{
+	EXPECT_EQ(m_spThreadPool->SetElasticWorkers(4, 2), MSV_INVALID_DATA_ERROR);
+	EXPECT_EQ(m_spThreadPool->SetElasticWorkers(2, 4), MSV_SUCCESS);
+	EXPECT_EQ(m_spThreadPool->SetElasticWorkers(0, 0), MSV_SUCCESS);
+}
+
+TEST_F(MsvThreadPoolTests, StartThreadPoolShouldClampWorkerCountToElasticBounds)
+{
+	std::shared_ptr<MsvUniqueWorker_Mock> spTimerWorker(new (std::nothrow) MsvUniqueWorker_Mock());
+
+	//two workers are started (the minimum), there are slots for three workers
+	EXPECT_CALL(*m_spThreadPoolFactoryMock, GetIMsvUniqueWorker(m_spThreadPool->GetIdleWorkers()))
+		.Times(2)
+		.WillRepeatedly(Return(m_spUniqueWorker));
+	EXPECT_CALL(*m_spUniqueWorker, SetTask(Matcher<std::function<void()>&>(_)))
+		.Times(2)
+		.WillRepeatedly(Return(MSV_SUCCESS));
+	EXPECT_CALL(*m_spUniqueWorker, StartThread(0))
+		.Times(2)
+		.WillRepeatedly(Return(MSV_SUCCESS));
+
+	//timer thread adjusts worker count
+	EXPECT_CALL(*m_spThreadPoolFactoryMock, GetIMsvUniqueWorker(IsNull(), IsNull(), IsNull()))
+		.WillOnce(Return(spTimerWorker));
+	EXPECT_CALL(*spTimerWorker, SetTask(Matcher<std::function<void()>&>(_)))
+		.WillOnce(Return(MSV_SUCCESS));
+	EXPECT_CALL(*spTimerWorker, StartThread(MsvThreadPool::MSV_TIMER_RESOLUTION))
+		.WillOnce(Return(MSV_SUCCESS));
+
+	EXPECT_EQ(m_spThreadPool->SetElasticWorkers(2, 3), MSV_SUCCESS);
+	EXPECT_EQ(m_spThreadPool->StartThreadPool(1), MSV_SUCCESS);
+	EXPECT_EQ(m_spThreadPool->SetElasticWorkers(1, 3), MSV_ALREADY_RUNNING_INFO);
+	EXPECT_EQ(m_spThreadPool->GetWorkerCount(), 3);
+	EXPECT_EQ(m_spThreadPool->GetRunningWorkerCount(), 2);
+	EXPECT_EQ(m_spThreadPool->GetWorkers().size(), 3);
+
+	EXPECT_CALL(*spTimerWorker, StopThread())
+		.WillOnce(Return(MSV_SUCCESS));
+	EXPECT_CALL(*spTimerWorker, WaitForThreadStop(30000))
+		.WillOnce(Return(MSV_SUCCESS));
+	EXPECT_CALL(*m_spUniqueWorker, StopThread())
+		.Times(2)
+		.WillRepeatedly(Return(MSV_SUCCESS));
+	EXPECT_CALL(*m_spUniqueWorker, WaitForThreadStop(30000))
+		.Times(2)
+		.WillRepeatedly(Return(MSV_SUCCESS));
+
+	EXPECT_EQ(m_spThreadPool->StopAndWaitForThreadPoolStop(30000), MSV_SUCCESS);
+	EXPECT_EQ(m_spThreadPool->GetRunningWorkerCount(), 0);
+}
+
+TEST_F(MsvThreadPoolTests, HillClimbingShouldMoveTargetByThroughput)
+{
+	std::shared_ptr<MsvUniqueWorker_Mock> spTimerWorker(new (std::nothrow) MsvUniqueWorker_Mock());
+
+	EXPECT_CALL(*m_spThreadPoolFactoryMock, GetIMsvUniqueWorker(m_spThreadPool->GetIdleWorkers()))
+		.Times(3)
+		.WillRepeatedly(Return(m_spUniqueWorker));
+	EXPECT_CALL(*m_spUniqueWorker, SetTask(Matcher<std::function<void()>&>(_)))
+		.Times(3)
+		.WillRepeatedly(Return(MSV_SUCCESS));
+	EXPECT_CALL(*m_spUniqueWorker, StartThread(0))
+		.Times(3)
+		.WillRepeatedly(Return(MSV_SUCCESS));
+
+	//timer thread samples throughput
+	EXPECT_CALL(*m_spThreadPoolFactoryMock, GetIMsvUniqueWorker(IsNull(), IsNull(), IsNull()))
+		.WillOnce(Return(spTimerWorker));
+	EXPECT_CALL(*spTimerWorker, SetTask(Matcher<std::function<void()>&>(_)))
+		.WillOnce(Return(MSV_SUCCESS));
+	EXPECT_CALL(*spTimerWorker, StartThread(MsvThreadPool::MSV_TIMER_RESOLUTION))
+		.WillOnce(Return(MSV_SUCCESS));
+
+	EXPECT_EQ(m_spThreadPool->GetTargetWorkerCount(), 0);
+	EXPECT_EQ(m_spThreadPool->SetHillClimbing(true), MSV_SUCCESS);
+	EXPECT_EQ(m_spThreadPool->StartThreadPool(3), MSV_SUCCESS);
+	EXPECT_EQ(m_spThreadPool->SetHillClimbing(false), MSV_ALREADY_RUNNING_INFO);
+	EXPECT_EQ(m_spThreadPool->GetTargetWorkerCount(), 3);
+
+	//the first sample at maximum -> fewer workers
+	m_spThreadPool->ClimbTarget(100.0);
+	EXPECT_EQ(m_spThreadPool->GetTargetWorkerCount(), 2);
+
+	//throughput has improved -> the same direction
+	m_spThreadPool->ClimbTarget(150.0);
+	EXPECT_EQ(m_spThreadPool->GetTargetWorkerCount(), 1);
+
+	//throughput has dropped -> opposite direction
+	m_spThreadPool->ClimbTarget(100.0);
+	EXPECT_EQ(m_spThreadPool->GetTargetWorkerCount(), 2);
+
+	//no significant change -> target is stable
+	for (uint32_t i = 1; i < MsvThreadPool::MSV_HILL_CLIMBING_HOLD_SAMPLES; ++i)
+	{
+		m_spThreadPool->ClimbTarget(102.0);
+		EXPECT_EQ(m_spThreadPool->GetTargetWorkerCount(), 2);
+	}
+
+	//flat for hold samples -> probe fewer workers
+	m_spThreadPool->ClimbTarget(101.0);
+	EXPECT_EQ(m_spThreadPool->GetTargetWorkerCount(), 1);
+
+	//minimum -> probe more workers (after hold samples again)
+	for (uint32_t i = 1; i < MsvThreadPool::MSV_HILL_CLIMBING_HOLD_SAMPLES; ++i)
+	{
+		m_spThreadPool->ClimbTarget(100.0);
+		EXPECT_EQ(m_spThreadPool->GetTargetWorkerCount(), 1);
+	}
+	m_spThreadPool->ClimbTarget(100.0);
+	EXPECT_EQ(m_spThreadPool->GetTargetWorkerCount(), 2);
+
+	EXPECT_CALL(*spTimerWorker, StopThread())
+		.WillOnce(Return(MSV_SUCCESS));
+	EXPECT_CALL(*spTimerWorker, WaitForThreadStop(30000))
+		.WillOnce(Return(MSV_SUCCESS));
+	EXPECT_CALL(*m_spUniqueWorker, StopThread())
+		.Times(3)
+		.WillRepeatedly(Return(MSV_SUCCESS));
+	EXPECT_CALL(*m_spUniqueWorker, WaitForThreadStop(30000))
+		.Times(3)
+		.WillRepeatedly(Return(MSV_SUCCESS));
+
+	EXPECT_EQ(m_spThreadPool->StopAndWaitForThreadPoolStop(30000), MSV_SUCCESS);
+}
+
+TEST_F(MsvThreadPoolTests, SurplusWorkerShouldParkWhileAnotherWorkerIsBlocked)
+{
+	EXPECT_EQ(m_spThreadPool->SetCompensatingWorkers(1), MSV_SUCCESS);
+	EXPECT_EQ(m_spThreadPool->AddTask(m_spTask), MSV_SUCCESS);
+
+	EXPECT_CALL(*m_spTask, Execute())
+		.WillOnce(Invoke([this]()
+		{
+			//this worker is blocked, other two workers are active (the second one compensates it)
+			MsvBlockingScope scope(*m_spThreadPool);
+			m_spThreadPool->AddActiveWorkers(2);
+			m_spThreadPool->SetTargetWorkerCount(2);
+			EXPECT_FALSE(m_spThreadPool->TryPark());
+
+			//target has been lowered -> one active worker is surplus (blocked worker does not change it)
+			m_spThreadPool->SetTargetWorkerCount(1);
+			EXPECT_TRUE(m_spThreadPool->TryPark());
+			EXPECT_FALSE(m_spThreadPool->TryPark());
+		}));
+
+	//worker context is thread local -> worker runs in its own thread (it is not surplus at start)
+	m_spThreadPool->SetTargetWorkerCount(1);
+	std::thread worker([this]() { m_spThreadPool->RunWorker(0); });
+	worker.join();
+}
+
+TEST_F(MsvThreadPoolTests, ExecuteTaskBatchShouldExecuteAtMostBatchSizeTasks)
+{
+	std::vector<std::shared_ptr<IMsvTask>> tasks(10, m_spTask);
+	EXPECT_EQ(m_spThreadPool->AddTasks(tasks), MSV_SUCCESS);
+	EXPECT_EQ(m_spThreadPool->SetDequeueBatchSize(4), MSV_SUCCESS);
+
+	EXPECT_CALL(*m_spTask, Execute())
+		.Times(10);
+
+	EXPECT_TRUE(m_spThreadPool->ExecuteBatch());
+	EXPECT_EQ(m_spThreadPool->GetTasks()->GetSize(), 6);
+
+	EXPECT_TRUE(m_spThreadPool->ExecuteBatch());
+	EXPECT_TRUE(m_spThreadPool->ExecuteBatch());
+	EXPECT_EQ(m_spThreadPool->GetTasks()->GetSize(), 0);
+
+	EXPECT_FALSE(m_spThreadPool->ExecuteBatch());
+}
+
+TEST_F(MsvThreadPoolTests, TryExecuteTaskShouldExecuteOneQueuedTask)
+{
+	EXPECT_FALSE(m_spThreadPool->IsWorkerThread());
+	EXPECT_FALSE(m_spThreadPool->TryExecuteTask());
+
+	EXPECT_EQ(m_spThreadPool->AddTasks({ m_spTask, m_spTask }), MSV_SUCCESS);
+
+	EXPECT_CALL(*m_spTask, Execute())
+		.Times(2);
+
+	EXPECT_TRUE(m_spThreadPool->TryExecuteTask());
+	EXPECT_EQ(m_spThreadPool->GetTasks()->GetSize(), 1);
+	EXPECT_TRUE(m_spThreadPool->TryExecuteTask());
+	EXPECT_FALSE(m_spThreadPool->TryExecuteTask());
+}
+
+TEST_F(MsvThreadPoolTests, AddTaskShouldRejectTaskWhenBoundedQueueIsFull)
+{
+	TestMsvThreadPoolObject threadPool(m_spThreadPoolFactoryMock, 2);
+	std::shared_ptr<MsvTask_Mock> spTask2(new (std::nothrow) MsvTask_Mock());
+
+	EXPECT_EQ(threadPool.SetQueueFullPolicy(MsvQueueFullPolicy::MSV_QUEUE_FULL_REJECT), MSV_SUCCESS);
+	EXPECT_EQ(threadPool.AddTasks({ m_spTask, m_spTask }), MSV_SUCCESS);
+	EXPECT_EQ(threadPool.AddTask(spTask2), MSV_QUEUE_FULL_ERROR);
+	EXPECT_EQ(threadPool.AddTasks({ spTask2, spTask2 }), MSV_QUEUE_FULL_ERROR);
+
+	EXPECT_EQ(threadPool.GetQueueFullCount(), 2);
+	EXPECT_EQ(threadPool.GetTasks()->GetSize(), 2);
+	EXPECT_EQ(threadPool.GetTasks()->Pop(), m_spTask);
+	EXPECT_EQ(threadPool.GetTasks()->Pop(), m_spTask);
+}
+
+TEST_F(MsvThreadPoolTests, AddTaskShouldDropTheOldestTaskWhenBoundedQueueIsFull)
+{
+	TestMsvThreadPoolObject threadPool(m_spThreadPoolFactoryMock, 2);
+	std::shared_ptr<MsvTask_Mock> spTask2(new (std::nothrow) MsvTask_Mock());
+	std::shared_ptr<MsvTask_Mock> spTask3(new (std::nothrow) MsvTask_Mock());
+
+	EXPECT_EQ(threadPool.SetQueueFullPolicy(MsvQueueFullPolicy::MSV_QUEUE_FULL_DROP_OLDEST), MSV_SUCCESS);
+	EXPECT_EQ(threadPool.AddTasks({ m_spTask, spTask2, spTask3 }), MSV_SUCCESS);
+
+	EXPECT_EQ(threadPool.GetQueueFullCount(), 1);
+	EXPECT_EQ(threadPool.GetTasks()->GetSize(), 2);
+	EXPECT_EQ(threadPool.GetTasks()->Pop(), spTask2);
+	EXPECT_EQ(threadPool.GetTasks()->Pop(), spTask3);
+}
+
+TEST_F(MsvThreadPoolTests, AddTaskShouldExecuteTaskInCallerThreadWhenBoundedQueueIsFull)
+{
+	TestMsvThreadPoolObject threadPool(m_spThreadPoolFactoryMock, 2);
+	std::shared_ptr<MsvTask_Mock> spTask2(new (std::nothrow) MsvTask_Mock());
+
+	EXPECT_CALL(*m_spTask, Execute())
+		.Times(0);
+	EXPECT_CALL(*spTask2, Execute())
+		.Times(1);
+
+	EXPECT_EQ(threadPool.SetQueueFullPolicy(MsvQueueFullPolicy::MSV_QUEUE_FULL_CALLER_RUNS), MSV_SUCCESS);
+	EXPECT_EQ(threadPool.AddTasks({ m_spTask, m_spTask, spTask2 }), MSV_SUCCESS);
+
+	EXPECT_EQ(threadPool.GetQueueFullCount(), 1);
+	EXPECT_EQ(threadPool.GetTasks()->GetSize(), 2);
+}
+
+TEST_F(MsvThreadPoolTests, AddTaskShouldFailedWhenWaitForFreeSpaceTimedOut)
+{
+	TestMsvThreadPoolObject threadPool(m_spThreadPoolFactoryMock, 2);
+
+	EXPECT_EQ(threadPool.SetQueueFullPolicy(MsvQueueFullPolicy::MSV_QUEUE_FULL_BLOCK, 1000), MSV_SUCCESS);
+	EXPECT_EQ(threadPool.AddTasks({ m_spTask, m_spTask }), MSV_SUCCESS);
+	EXPECT_EQ(threadPool.AddTask(m_spTask), MSV_QUEUE_FULL_ERROR);
+
+	EXPECT_EQ(threadPool.GetQueueFullCount(), 1);
+	EXPECT_EQ(threadPool.GetTasks()->GetSize(), 2);
+}
+
+TEST_F(MsvThreadPoolTests, AddTaskWithDeadlineShouldApplyQueueFullPolicy)
+{
+	TestMsvThreadPoolObject threadPool(m_spThreadPoolFactoryMock, 2);
+	std::shared_ptr<MsvTask_Mock> spTask2(new (std::nothrow) MsvTask_Mock());
+	std::shared_ptr<MsvTask_Mock> spTask3(new (std::nothrow) MsvTask_Mock());
+	std::shared_ptr<MsvTask_Mock> spTask4(new (std::nothrow) MsvTask_Mock());
+	std::vector<std::shared_ptr<IMsvTask>> droppedTasks;
+	std::chrono::steady_clock::time_point now = std::chrono::steady_clock::now();
+	std::chrono::steady_clock::time_point deadline;
+
+	EXPECT_CALL(*m_spTask, Execute())
+		.Times(0);
+	EXPECT_CALL(*spTask2, Execute())
+		.Times(1);
+	EXPECT_CALL(*spTask3, Execute())
+		.Times(0);
+	EXPECT_CALL(*spTask4, Execute())
+		.Times(0);
+
+	EXPECT_EQ(threadPool.SetDeadlineScheduling(true), MSV_SUCCESS);
+	EXPECT_EQ(threadPool.SetDropExpiredTasks(false, [&droppedTasks](std::shared_ptr<IMsvTask> spTask) { droppedTasks.push_back(spTask); }), MSV_SUCCESS);
+	EXPECT_EQ(threadPool.AddTask(m_spTask, now + std::chrono::hours(1)), MSV_SUCCESS);
+	EXPECT_EQ(threadPool.AddTask(spTask3, now + std::chrono::hours(3)), MSV_SUCCESS);
+
+	EXPECT_EQ(threadPool.SetQueueFullPolicy(MsvQueueFullPolicy::MSV_QUEUE_FULL_REJECT), MSV_SUCCESS);
+	EXPECT_EQ(threadPool.AddTask(spTask2, now + std::chrono::hours(2)), MSV_QUEUE_FULL_ERROR);
+
+	EXPECT_EQ(threadPool.SetQueueFullPolicy(MsvQueueFullPolicy::MSV_QUEUE_FULL_CALLER_RUNS), MSV_SUCCESS);
+	EXPECT_EQ(threadPool.AddTask(spTask2, now + std::chrono::hours(2)), MSV_SUCCESS);
+
+	//the latest deadline is dropped (queued task or the new one) and reported
+	EXPECT_EQ(threadPool.SetQueueFullPolicy(MsvQueueFullPolicy::MSV_QUEUE_FULL_DROP_OLDEST), MSV_SUCCESS);
+	EXPECT_EQ(threadPool.AddTask(spTask2, now + std::chrono::hours(2)), MSV_SUCCESS);
+	EXPECT_EQ(threadPool.AddTask(spTask4, now + std::chrono::hours(4)), MSV_SUCCESS);
+	EXPECT_EQ(droppedTasks.size(), 2);
+	EXPECT_EQ(droppedTasks[0], spTask3);
+	EXPECT_EQ(droppedTasks[1], spTask4);
+
+	EXPECT_EQ(threadPool.SetQueueFullPolicy(MsvQueueFullPolicy::MSV_QUEUE_FULL_BLOCK, 1000), MSV_SUCCESS);
+	EXPECT_EQ(threadPool.AddTask(m_spTask, now + std::chrono::hours(1)), MSV_QUEUE_FULL_ERROR);
+
+	EXPECT_EQ(threadPool.GetQueueFullCount(), 5);
+	EXPECT_EQ(threadPool.GetDeadlineTasks()->GetSize(), 2);
+	EXPECT_EQ(threadPool.GetDeadlineTasks()->Pop(deadline), m_spTask);
+	EXPECT_EQ(threadPool.GetDeadlineTasks()->Pop(deadline), spTask2);
+}
+
+TEST_F(MsvThreadPoolTests, ItShouldExecuteTasksByPriority)
+{
+	std::shared_ptr<MsvTask_Mock> spHighTask(new (std::nothrow) MsvTask_Mock());
+	std::shared_ptr<MsvTask_Mock> spLowTask(new (std::nothrow) MsvTask_Mock());
+
+	EXPECT_CALL(*m_spThreadPoolFactoryMock, GetIMsvTask(Matcher<std::function<void()>&>(_)))
+		.WillOnce(Return(spHighTask));
+
+	EXPECT_EQ(m_spThreadPool->AddTask(spLowTask, MsvTaskPriority::MSV_TASK_PRIORITY_LOW), MSV_SUCCESS);
+	EXPECT_EQ(m_spThreadPool->AddTask(m_spTask), MSV_SUCCESS);
+	EXPECT_EQ(m_spThreadPool->AddTask(m_voidFunction, MsvTaskPriority::MSV_TASK_PRIORITY_HIGH), MSV_SUCCESS);
+
+	EXPECT_EQ(m_spThreadPool->GetTasks()->GetSize(), 3);
+	EXPECT_EQ(m_spThreadPool->GetTasks()->Pop(), spHighTask);
+	EXPECT_EQ(m_spThreadPool->GetTasks()->Pop(), m_spTask);
+	EXPECT_EQ(m_spThreadPool->GetTasks()->Pop(), spLowTask);
+}
+
+TEST_F(MsvThreadPoolTests, SetPriorityPolicyShouldReturnInfoWhenAlreadyRunning)
+{
+	EXPECT_CALL(*m_spThreadPoolFactoryMock, GetIMsvUniqueWorker(m_spThreadPool->GetIdleWorkers()))
+		.WillOnce(Return(m_spUniqueWorker));
+
+	EXPECT_CALL(*m_spUniqueWorker, SetTask(Matcher<std::function<void()>&>(_)))
+		.WillOnce(Return(MSV_SUCCESS));
+
+	EXPECT_CALL(*m_spUniqueWorker, StartThread(0))
+		.WillOnce(Return(MSV_SUCCESS));
+
+	EXPECT_EQ(m_spThreadPool->SetPriorityWeights(0, 1, 1), MSV_INVALID_DATA_ERROR);
+	EXPECT_EQ(m_spThreadPool->StartThreadPool(1), MSV_SUCCESS);
+	EXPECT_EQ(m_spThreadPool->SetPriorityPolicy(MsvPriorityPolicy::MSV_PRIORITY_WEIGHTED), MSV_ALREADY_RUNNING_INFO);
+	EXPECT_EQ(m_spThreadPool->SetPriorityWeights(8, 4, 1), MSV_ALREADY_RUNNING_INFO);
+	EXPECT_EQ(m_spThreadPool->SetPriorityAging(16), MSV_SUCCESS);
+}
+
+TEST_F(MsvThreadPoolTests, ItShouldExecuteTheEarliestDeadlineFirst)
+{
+	std::shared_ptr<MsvTask_Mock> spTask2(new (std::nothrow) MsvTask_Mock());
+	std::shared_ptr<MsvTask_Mock> spTask3(new (std::nothrow) MsvTask_Mock());
+	std::chrono::steady_clock::time_point now = std::chrono::steady_clock::now();
+
+	EXPECT_EQ(m_spThreadPool->SetDeadlineScheduling(true), MSV_SUCCESS);
+	EXPECT_EQ(m_spThreadPool->AddTask(m_spTask), MSV_SUCCESS);
+	EXPECT_EQ(m_spThreadPool->AddTask(spTask2, now + std::chrono::hours(2)), MSV_SUCCESS);
+	EXPECT_EQ(m_spThreadPool->AddTask(spTask3, now + std::chrono::hours(1)), MSV_SUCCESS);
+
+	{
+		InSequence sequence;
+		EXPECT_CALL(*spTask3, Execute());
+		EXPECT_CALL(*spTask2, Execute());
+		EXPECT_CALL(*m_spTask, Execute());
+	}
+
+	EXPECT_TRUE(m_spThreadPool->ExecuteBatch());
+	EXPECT_TRUE(m_spThreadPool->ExecuteBatch());
+	EXPECT_TRUE(m_spThreadPool->ExecuteBatch());
+	EXPECT_FALSE(m_spThreadPool->ExecuteBatch());
+}
+
+TEST_F(MsvThreadPoolTests, ItShouldDropExpiredTasks)
+{
+	std::shared_ptr<MsvTask_Mock> spExpiredTask(new (std::nothrow) MsvTask_Mock());
+	std::chrono::steady_clock::time_point now = std::chrono::steady_clock::now();
+	std::vector<std::shared_ptr<IMsvTask>> expiredTasks;
+
+	EXPECT_EQ(m_spThreadPool->SetDeadlineScheduling(true), MSV_SUCCESS);
+	EXPECT_EQ(m_spThreadPool->SetDropExpiredTasks(true, [&expiredTasks](std::shared_ptr<IMsvTask> spTask) { expiredTasks.push_back(spTask); }), MSV_SUCCESS);
+	EXPECT_EQ(m_spThreadPool->AddTask(spExpiredTask, now - std::chrono::seconds(1)), MSV_SUCCESS);
+	EXPECT_EQ(m_spThreadPool->AddTask(spExpiredTask, now - std::chrono::seconds(2)), MSV_SUCCESS);
+	EXPECT_EQ(m_spThreadPool->AddTask(m_spTask, now + std::chrono::hours(1)), MSV_SUCCESS);
+
+	EXPECT_CALL(*spExpiredTask, Execute())
+		.Times(0);
+	EXPECT_CALL(*m_spTask, Execute())
+		.Times(1);
+
+	EXPECT_TRUE(m_spThreadPool->ExecuteBatch());
+	EXPECT_FALSE(m_spThreadPool->ExecuteBatch());
+
+	EXPECT_EQ(m_spThreadPool->GetExpiredTaskCount(), 2);
+	EXPECT_EQ(expiredTasks.size(), 2);
+}
+
+TEST_F(MsvThreadPoolTests, DeadlineShouldBeIgnoredWhenDeadlineSchedulingIsDisabled)
+{
+	EXPECT_EQ(m_spThreadPool->AddTask(m_spTask, std::chrono::steady_clock::now()), MSV_SUCCESS);
+
+	EXPECT_EQ(m_spThreadPool->GetTasks()->GetSize(), 1);
+	EXPECT_EQ(m_spThreadPool->GetTasks()->Pop(), m_spTask);
+}
+
+TEST_F(MsvThreadPoolTests, ItShouldCancelDelayedTaskIfThreadPoolIsNotRunning)
+{
+	uint64_t timerId = 0;
+
+	EXPECT_EQ(m_spThreadPool->AddDelayedTask(m_spTask, std::chrono::seconds(10), &timerId), MSV_SUCCESS);
+	EXPECT_EQ(m_spThreadPool->GetDelayedTaskCount(), 1);
+	EXPECT_EQ(m_spThreadPool->GetTasks()->GetSize(), 0);
+
+	EXPECT_EQ(m_spThreadPool->CancelDelayedTask(timerId), MSV_SUCCESS);
+	EXPECT_EQ(m_spThreadPool->CancelDelayedTask(timerId), MSV_NOT_PENDING_INFO);
+	EXPECT_EQ(m_spThreadPool->GetDelayedTaskCount(), 0);
+}
+
+TEST_F(MsvThreadPoolTests, ItShouldCancelPeriodicTaskIfThreadPoolIsNotRunning)
+{
+	uint64_t periodicTaskId = 0;
+
+	EXPECT_EQ(m_spThreadPool->AddPeriodicTask(m_spTask, std::chrono::microseconds(0)), MSV_INVALID_DATA_ERROR);
+	EXPECT_EQ(m_spThreadPool->AddPeriodicTask(m_spTask, std::chrono::seconds(1), MsvPeriodicMode::MSV_PERIODIC_FIXED_RATE, MsvMissedTickPolicy::MSV_MISSED_TICK_SKIP, &periodicTaskId), MSV_SUCCESS);
+	EXPECT_EQ(m_spThreadPool->GetDelayedTaskCount(), 1);
+
+	EXPECT_EQ(m_spThreadPool->CancelPeriodicTask(periodicTaskId), MSV_SUCCESS);
+	EXPECT_EQ(m_spThreadPool->CancelPeriodicTask(periodicTaskId), MSV_NOT_PENDING_INFO);
+	EXPECT_EQ(m_spThreadPool->GetDelayedTaskCount(), 0);
+}
+
+TEST_F(MsvThreadPoolTests, AddDelayedTaskShouldStartTimerThreadWhenThreadPoolIsRunning)
+{
+	std::shared_ptr<MsvUniqueWorker_Mock> spTimerWorker(new (std::nothrow) MsvUniqueWorker_Mock());
+
+	EXPECT_CALL(*m_spThreadPoolFactoryMock, GetIMsvUniqueWorker(m_spThreadPool->GetIdleWorkers()))
+		.WillOnce(Return(m_spUniqueWorker));
+	EXPECT_CALL(*m_spUniqueWorker, SetTask(Matcher<std::function<void()>&>(_)))
+		.WillOnce(Return(MSV_SUCCESS));
+	EXPECT_CALL(*m_spUniqueWorker, StartThread(0))
+		.WillOnce(Return(MSV_SUCCESS));
+
+	EXPECT_EQ(m_spThreadPool->StartThreadPool(1), MSV_SUCCESS);
+
+	//the first delayed task starts timer thread
+	EXPECT_CALL(*m_spThreadPoolFactoryMock, GetIMsvUniqueWorker(IsNull(), IsNull(), IsNull()))
+		.WillOnce(Return(spTimerWorker));
+	EXPECT_CALL(*spTimerWorker, SetTask(Matcher<std::function<void()>&>(_)))
+		.WillOnce(Return(MSV_SUCCESS));
+	EXPECT_CALL(*spTimerWorker, StartThread(MsvThreadPool::MSV_TIMER_RESOLUTION))
+		.WillOnce(Return(MSV_SUCCESS));
+
+	EXPECT_EQ(m_spThreadPool->AddDelayedTask(m_spTask, std::chrono::seconds(10)), MSV_SUCCESS);
+	EXPECT_EQ(m_spThreadPool->AddDelayedTask(m_spTask, std::chrono::seconds(10)), MSV_SUCCESS);
+	EXPECT_EQ(m_spThreadPool->GetDelayedTaskCount(), 2);
+
+	EXPECT_CALL(*spTimerWorker, StopThread())
+		.WillOnce(Return(MSV_SUCCESS));
+	EXPECT_CALL(*spTimerWorker, WaitForThreadStop(30000))
+		.WillOnce(Return(MSV_SUCCESS));
+	EXPECT_CALL(*m_spUniqueWorker, StopThread())
+		.WillOnce(Return(MSV_SUCCESS));
+	EXPECT_CALL(*m_spUniqueWorker, WaitForThreadStop(30000))
+		.WillOnce(Return(MSV_SUCCESS));
+
+	EXPECT_EQ(m_spThreadPool->StopAndWaitForThreadPoolStop(30000), MSV_SUCCESS);
+	EXPECT_FALSE(m_spThreadPool->IsRunning());
+}
+
+TEST_F(MsvThreadPoolTests, StartThreadPoolShouldFailedWhenIdleWorkerStackIsNull)
 {
-	m_spThreadPool->GetSharedCondition().reset();
+	m_spThreadPool->GetIdleWorkers().reset();
 
 	EXPECT_EQ(static_cast<std::shared_ptr<IMsvThreadPool>>(m_spThreadPool)->StartThreadPool(), MSV_ALLOCATION_ERROR);
 	EXPECT_FALSE(m_spThreadPool->IsRunning());
@@ -170,7 +756,7 @@ TEST_F(MsvThreadPoolTests, StartThreadPoolShouldFailedWhenSharedConditionVariabl
 
 TEST_F(MsvThreadPoolTests, StartThreadPoolShouldFailedWhenGetWorkersFailed)
 {
-	EXPECT_CALL(*m_spThreadPoolFactoryMock, GetIMsvUniqueWorker(m_spThreadPool->GetSharedCondition(), m_spThreadPool->GetSharedMutex(), m_spThreadPool->GetSharedPredicate()))
+	EXPECT_CALL(*m_spThreadPoolFactoryMock, GetIMsvUniqueWorker(m_spThreadPool->GetIdleWorkers()))
 		.WillOnce(Return(nullptr));
 
 	EXPECT_EQ(static_cast<std::shared_ptr<IMsvThreadPool>>(m_spThreadPool)->StartThreadPool(), MSV_ALLOCATION_ERROR);
@@ -179,7 +765,7 @@ TEST_F(MsvThreadPoolTests, StartThreadPoolShouldFailedWhenGetWorkersFailed)
 
 TEST_F(MsvThreadPoolTests, StartThreadPoolShouldFailedWhenSetTaskFailed)
 {
-	EXPECT_CALL(*m_spThreadPoolFactoryMock, GetIMsvUniqueWorker(m_spThreadPool->GetSharedCondition(), m_spThreadPool->GetSharedMutex(), m_spThreadPool->GetSharedPredicate()))
+	EXPECT_CALL(*m_spThreadPoolFactoryMock, GetIMsvUniqueWorker(m_spThreadPool->GetIdleWorkers()))
 		.WillOnce(Return(m_spUniqueWorker));
 
 	EXPECT_CALL(*m_spUniqueWorker, SetTask(Matcher<std::function<void()>&>(_)))
@@ -191,7 +777,7 @@ TEST_F(MsvThreadPoolTests, StartThreadPoolShouldFailedWhenSetTaskFailed)
 
 TEST_F(MsvThreadPoolTests, StartThreadPoolShouldFailedWhenStartWorkersFailed)
 {
-	EXPECT_CALL(*m_spThreadPoolFactoryMock, GetIMsvUniqueWorker(m_spThreadPool->GetSharedCondition(), m_spThreadPool->GetSharedMutex(), m_spThreadPool->GetSharedPredicate()))
+	EXPECT_CALL(*m_spThreadPoolFactoryMock, GetIMsvUniqueWorker(m_spThreadPool->GetIdleWorkers()))
 		.WillOnce(Return(m_spUniqueWorker));
 
 	EXPECT_CALL(*m_spUniqueWorker, SetTask(Matcher<std::function<void()>&>(_)))
@@ -215,7 +801,7 @@ TEST_F(MsvThreadPoolTests, StopThreadPoolShouldReturnInfoWhenNotRunning)
 //also tests StopThreadPool success
 TEST_F(MsvThreadPoolTests, StopThreadPoolShouldReturnInfoWhenStopAlreadyRequested)
 {
-	EXPECT_CALL(*m_spThreadPoolFactoryMock, GetIMsvUniqueWorker(m_spThreadPool->GetSharedCondition(), m_spThreadPool->GetSharedMutex(), m_spThreadPool->GetSharedPredicate()))
+	EXPECT_CALL(*m_spThreadPoolFactoryMock, GetIMsvUniqueWorker(m_spThreadPool->GetIdleWorkers()))
 		.WillOnce(Return(m_spUniqueWorker));
 
 	EXPECT_CALL(*m_spUniqueWorker, SetTask(Matcher<std::function<void()>&>(_)))
@@ -240,7 +826,7 @@ TEST_F(MsvThreadPoolTests, StopThreadPoolShouldReturnInfoWhenStopAlreadyRequeste
 
 TEST_F(MsvThreadPoolTests, StopThreadPoolShouldFailedWhenStopThreadsFailed)
 {
-	EXPECT_CALL(*m_spThreadPoolFactoryMock, GetIMsvUniqueWorker(m_spThreadPool->GetSharedCondition(), m_spThreadPool->GetSharedMutex(), m_spThreadPool->GetSharedPredicate()))
+	EXPECT_CALL(*m_spThreadPoolFactoryMock, GetIMsvUniqueWorker(m_spThreadPool->GetIdleWorkers()))
 		.WillOnce(Return(m_spUniqueWorker));
 
 	EXPECT_CALL(*m_spUniqueWorker, SetTask(Matcher<std::function<void()>&>(_)))
@@ -272,7 +858,7 @@ TEST_F(MsvThreadPoolTests, WaitForThreadPoolStopShouldReturnInfoWhenNotRunning)
 
 TEST_F(MsvThreadPoolTests, WaitForThreadPoolStopShouldFailedWhenStopWasNotRequested)
 {
-	EXPECT_CALL(*m_spThreadPoolFactoryMock, GetIMsvUniqueWorker(m_spThreadPool->GetSharedCondition(), m_spThreadPool->GetSharedMutex(), m_spThreadPool->GetSharedPredicate()))
+	EXPECT_CALL(*m_spThreadPoolFactoryMock, GetIMsvUniqueWorker(m_spThreadPool->GetIdleWorkers()))
 		.WillOnce(Return(m_spUniqueWorker));
 
 	EXPECT_CALL(*m_spUniqueWorker, SetTask(Matcher<std::function<void()>&>(_)))
@@ -291,7 +877,7 @@ TEST_F(MsvThreadPoolTests, WaitForThreadPoolStopShouldFailedWhenStopWasNotReques
 
 TEST_F(MsvThreadPoolTests, WaitForThreadPoolStopShouldFailedWhenStopThreadsFailed)
 {
-	EXPECT_CALL(*m_spThreadPoolFactoryMock, GetIMsvUniqueWorker(m_spThreadPool->GetSharedCondition(), m_spThreadPool->GetSharedMutex(), m_spThreadPool->GetSharedPredicate()))
+	EXPECT_CALL(*m_spThreadPoolFactoryMock, GetIMsvUniqueWorker(m_spThreadPool->GetIdleWorkers()))
 		.WillOnce(Return(m_spUniqueWorker));
 
 	EXPECT_CALL(*m_spUniqueWorker, SetTask(Matcher<std::function<void()>&>(_)))
@@ -317,7 +903,7 @@ TEST_F(MsvThreadPoolTests, WaitForThreadPoolStopShouldFailedWhenStopThreadsFaile
 
 TEST_F(MsvThreadPoolTests, WaitForThreadPoolStopShouldSucceeded)
 {
-	EXPECT_CALL(*m_spThreadPoolFactoryMock, GetIMsvUniqueWorker(m_spThreadPool->GetSharedCondition(), m_spThreadPool->GetSharedMutex(), m_spThreadPool->GetSharedPredicate()))
+	EXPECT_CALL(*m_spThreadPoolFactoryMock, GetIMsvUniqueWorker(m_spThreadPool->GetIdleWorkers()))
 		.WillOnce(Return(m_spUniqueWorker));
 
 	EXPECT_CALL(*m_spUniqueWorker, SetTask(Matcher<std::function<void()>&>(_)))
@@ -343,7 +929,7 @@ TEST_F(MsvThreadPoolTests, WaitForThreadPoolStopShouldSucceeded)
 
 TEST_F(MsvThreadPoolTests, StopAndWaitForThreadPoolStopShouldSucceeded)
 {
-	EXPECT_CALL(*m_spThreadPoolFactoryMock, GetIMsvUniqueWorker(m_spThreadPool->GetSharedCondition(), m_spThreadPool->GetSharedMutex(), m_spThreadPool->GetSharedPredicate()))
+	EXPECT_CALL(*m_spThreadPoolFactoryMock, GetIMsvUniqueWorker(m_spThreadPool->GetIdleWorkers()))
 		.WillOnce(Return(m_spUniqueWorker));
 
 	EXPECT_CALL(*m_spUniqueWorker, SetTask(Matcher<std::function<void()>&>(_)))
@@ -3,10 +3,25 @@
 
 
 #include "mthreading\MsvThreadPool.h"
+#include "mthreading\MsvTask.h"
+#include "mthreading\MsvWhen.h"
+#include "mthreading\MsvTaskGroup.h"
+#include "mthreading\MsvTaskGraph.h"
+#include "mthreading\MsvParallelFor.h"
+#include "mthreading\MsvBlockingScope.h"
+#include "mthreading\MsvForkJoin.h"
+#include "mthreading\MsvParallelReduce.h"
+#include "mthreading\MsvParallelScan.h"
+#include "mthreading\MsvParallelSort.h"
+#include "mthreading\MsvThreadingErrorCodes.h"
 #include "merror\MsvErrorCodes.h"
 #include "merror\MsvException.h"
 
+#include <algorithm>
+#include <functional>
+#include <random>
 #include <thread>
+#include <stdexcept>
 
 
 using namespace ::testing;
@@ -39,6 +54,22 @@ protected:
 	int32_t m_callCount;
 };
 
+//recursive fibonacci (fork join of two branches)
+int64_t ForkJoinFibonacci(IMsvThreadPool& threadPool, int32_t n)
+{
+	if (n < 15)
+	{
+		return n < 2 ? n : ForkJoinFibonacci(threadPool, n - 1) + ForkJoinFibonacci(threadPool, n - 2);
+	}
+
+	int64_t first = 0;
+	int64_t second = 0;
+	MsvForkJoin forkJoin(threadPool);
+	forkJoin.ParallelInvoke([&]() { first = ForkJoinFibonacci(threadPool, n - 1); }, [&]() { second = ForkJoinFibonacci(threadPool, n - 2); });
+
+	return first + second;
+}
+
 class MsvThreadPoolTests_Integration:
 	public::testing::Test
 {
@@ -216,3 +247,798 @@ TEST_F(MsvThreadPoolTests_Integration, ItShouldExecuteAllRegisteredFunctionsWith
 
 	EXPECT_EQ(GetCallCount(), 20);
 }
+
+TEST_F(MsvThreadPoolTests_Integration, ItShouldExecuteAllNestedTasksInWorkStealingMode)
+{
+	std::shared_ptr<MsvThreadPool> spThreadPool(new (std::nothrow) MsvThreadPool());
+	EXPECT_NE(spThreadPool, nullptr);
+
+	EXPECT_EQ(spThreadPool->SetWorkStealing(true), MSV_SUCCESS);
+	EXPECT_EQ(spThreadPool->StartThreadPool(4), MSV_SUCCESS);
+	EXPECT_TRUE(spThreadPool->IsRunning());
+
+	//each task adds nested tasks (they are pushed to deque of the worker and stolen by other workers)
+	std::function<void()> nestedTask = [this, &spThreadPool]()
+	{
+		this->AddCall();
+		for (int32_t i = 0; i < 10; ++i)
+		{
+			spThreadPool->AddTask(m_voidFunction);
+		}
+	};
+
+	for (int32_t i = 0; i < 100; ++i)
+	{
+		EXPECT_EQ(spThreadPool->AddTask(nestedTask), MSV_SUCCESS);
+	}
+
+	//wait for all tasks execution
+	for (int32_t i = 0; i < 100 && GetCallCount() < 1100; ++i)
+	{
+		using namespace std::chrono_literals;
+		std::this_thread::sleep_for(50ms);
+	}
+
+	EXPECT_EQ(spThreadPool->StopAndWaitForThreadPoolStop(3000000), MSV_SUCCESS);
+	EXPECT_FALSE(spThreadPool->IsRunning());
+
+	EXPECT_EQ(GetCallCount(), 1100);
+}
+
+TEST_F(MsvThreadPoolTests_Integration, ItShouldExecuteTasksWithoutOwnerInWorkStealingMode)
+{
+	std::shared_ptr<MsvThreadPool> spThreadPool(new (std::nothrow) MsvThreadPool());
+	EXPECT_NE(spThreadPool, nullptr);
+
+	EXPECT_EQ(spThreadPool->SetWorkStealing(true), MSV_SUCCESS);
+	EXPECT_EQ(spThreadPool->StartThreadPool(4), MSV_SUCCESS);
+	EXPECT_TRUE(spThreadPool->IsRunning());
+
+	//tasks are owned by the test (thread pool gets shared pointers without owner)
+	std::vector<std::unique_ptr<MsvTask>> tasks;
+	for (int32_t i = 0; i < 1000; ++i)
+	{
+		tasks.emplace_back(new (std::nothrow) MsvTask(m_voidFunction));
+	}
+
+	std::function<void(void*)> nestedTask = [&tasks, &spThreadPool](void* pContext)
+	{
+		//context is never nullptr (task with nullptr context executes function without context)
+		size_t first = (reinterpret_cast<size_t>(pContext) - 1) * 10;
+		for (size_t i = first; i < first + 10; ++i)
+		{
+			spThreadPool->AddTask(std::shared_ptr<IMsvTask>(std::shared_ptr<IMsvTask>(), tasks[i].get()));
+		}
+	};
+
+	for (size_t i = 1; i <= 100; ++i)
+	{
+		EXPECT_EQ(spThreadPool->AddTask(nestedTask, reinterpret_cast<void*>(i)), MSV_SUCCESS);
+	}
+
+	//wait for all tasks execution
+	for (int32_t i = 0; i < 100 && GetCallCount() < 1000; ++i)
+	{
+		using namespace std::chrono_literals;
+		std::this_thread::sleep_for(50ms);
+	}
+
+	EXPECT_EQ(spThreadPool->StopAndWaitForThreadPoolStop(3000000), MSV_SUCCESS);
+	EXPECT_FALSE(spThreadPool->IsRunning());
+
+	EXPECT_EQ(GetCallCount(), 1000);
+}
+
+TEST_F(MsvThreadPoolTests_Integration, ItShouldExecuteAllTasksAddedInBatch)
+{
+	std::shared_ptr<IMsvThreadPool> spThreadPool(new (std::nothrow) MsvThreadPool());
+	EXPECT_NE(spThreadPool, nullptr);
+
+	std::vector<std::shared_ptr<IMsvTask>> tasks(10000, m_spTask);
+
+	//tasks can be added before start
+	EXPECT_EQ(spThreadPool->AddTasks(tasks), MSV_SUCCESS);
+
+	EXPECT_EQ(spThreadPool->StartThreadPool(4), MSV_SUCCESS);
+	EXPECT_TRUE(spThreadPool->IsRunning());
+
+	EXPECT_EQ(spThreadPool->AddTasks(tasks), MSV_SUCCESS);
+
+	//wait for all tasks execution
+	for (int32_t i = 0; i < 100 && m_spTask->GetCallCount() < 20000; ++i)
+	{
+		using namespace std::chrono_literals;
+		std::this_thread::sleep_for(50ms);
+	}
+
+	EXPECT_EQ(spThreadPool->StopAndWaitForThreadPoolStop(3000000), MSV_SUCCESS);
+	EXPECT_FALSE(spThreadPool->IsRunning());
+
+	EXPECT_EQ(m_spTask->GetCallCount(), 20000);
+}
+
+TEST_F(MsvThreadPoolTests_Integration, ItShouldExecuteAllTasksWithDequeueBatch)
+{
+	std::shared_ptr<MsvThreadPool> spThreadPool(new (std::nothrow) MsvThreadPool());
+	EXPECT_NE(spThreadPool, nullptr);
+
+	EXPECT_EQ(spThreadPool->SetDequeueBatchSize(16), MSV_SUCCESS);
+	EXPECT_EQ(spThreadPool->StartThreadPool(4), MSV_SUCCESS);
+	EXPECT_TRUE(spThreadPool->IsRunning());
+
+	for (int32_t i = 0; i < 20000; ++i)
+	{
+		EXPECT_EQ(spThreadPool->AddTask(m_voidFunction), MSV_SUCCESS);
+	}
+
+	//wait for all tasks execution
+	for (int32_t i = 0; i < 100 && GetCallCount() < 20000; ++i)
+	{
+		using namespace std::chrono_literals;
+		std::this_thread::sleep_for(50ms);
+	}
+
+	EXPECT_EQ(spThreadPool->StopAndWaitForThreadPoolStop(3000000), MSV_SUCCESS);
+	EXPECT_FALSE(spThreadPool->IsRunning());
+
+	EXPECT_EQ(GetCallCount(), 20000);
+}
+
+TEST_F(MsvThreadPoolTests_Integration, ItShouldExecuteAllTasksWhenBoundedQueueBlocks)
+{
+	std::shared_ptr<MsvThreadPool> spThreadPool(new (std::nothrow) MsvThreadPool(nullptr, 8));
+	EXPECT_NE(spThreadPool, nullptr);
+
+	EXPECT_EQ(spThreadPool->SetQueueFullPolicy(MsvQueueFullPolicy::MSV_QUEUE_FULL_BLOCK), MSV_SUCCESS);
+	EXPECT_EQ(spThreadPool->StartThreadPool(4), MSV_SUCCESS);
+	EXPECT_TRUE(spThreadPool->IsRunning());
+
+	//producer is much faster than workers -> it must wait for free space
+	for (int32_t i = 0; i < 20000; ++i)
+	{
+		EXPECT_EQ(spThreadPool->AddTask(m_voidFunction), MSV_SUCCESS);
+	}
+
+	//wait for all tasks execution
+	for (int32_t i = 0; i < 100 && GetCallCount() < 20000; ++i)
+	{
+		using namespace std::chrono_literals;
+		std::this_thread::sleep_for(50ms);
+	}
+
+	EXPECT_EQ(spThreadPool->StopAndWaitForThreadPoolStop(3000000), MSV_SUCCESS);
+	EXPECT_FALSE(spThreadPool->IsRunning());
+
+	EXPECT_EQ(GetCallCount(), 20000);
+	EXPECT_GT(spThreadPool->GetQueueFullCount(), 0);
+}
+
+TEST_F(MsvThreadPoolTests_Integration, ItShouldExecuteDelayedTasksWhichWereNotCancelled)
+{
+	std::shared_ptr<MsvThreadPool> spThreadPool(new (std::nothrow) MsvThreadPool());
+	EXPECT_NE(spThreadPool, nullptr);
+
+	std::shared_ptr<MsvTestTask> spCancelledTask(new (std::nothrow) MsvTestTask());
+	EXPECT_NE(spCancelledTask, nullptr);
+
+	EXPECT_EQ(spThreadPool->StartThreadPool(4), MSV_SUCCESS);
+	EXPECT_TRUE(spThreadPool->IsRunning());
+
+	uint64_t timerId = 0;
+	std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+	for (int32_t i = 0; i < 100; ++i)
+	{
+		EXPECT_EQ(spThreadPool->AddDelayedTask(m_spTask, std::chrono::milliseconds(20 + i)), MSV_SUCCESS);
+	}
+	EXPECT_EQ(spThreadPool->AddDelayedTask(spCancelledTask, std::chrono::milliseconds(50), &timerId), MSV_SUCCESS);
+	EXPECT_EQ(spThreadPool->CancelDelayedTask(timerId), MSV_SUCCESS);
+
+	//wait for all tasks execution
+	for (int32_t i = 0; i < 100 && m_spTask->GetCallCount() < 100; ++i)
+	{
+		using namespace std::chrono_literals;
+		std::this_thread::sleep_for(10ms);
+	}
+
+	//delay is never shorter
+	EXPECT_GE(std::chrono::steady_clock::now() - start, std::chrono::milliseconds(119));
+
+	EXPECT_EQ(spThreadPool->StopAndWaitForThreadPoolStop(3000000), MSV_SUCCESS);
+	EXPECT_FALSE(spThreadPool->IsRunning());
+
+	EXPECT_EQ(m_spTask->GetCallCount(), 100);
+	EXPECT_EQ(spCancelledTask->GetCallCount(), 0);
+	EXPECT_EQ(spThreadPool->GetDelayedTaskCount(), 0);
+}
+
+TEST_F(MsvThreadPoolTests_Integration, ItShouldExecutePeriodicTaskUntilItIsCancelled)
+{
+	std::shared_ptr<MsvThreadPool> spThreadPool(new (std::nothrow) MsvThreadPool());
+	EXPECT_NE(spThreadPool, nullptr);
+
+	std::shared_ptr<MsvTestTask> spFixedDelayTask(new (std::nothrow) MsvTestTask());
+	EXPECT_NE(spFixedDelayTask, nullptr);
+
+	EXPECT_EQ(spThreadPool->StartThreadPool(2), MSV_SUCCESS);
+	EXPECT_TRUE(spThreadPool->IsRunning());
+
+	uint64_t fixedRateId = 0;
+	uint64_t fixedDelayId = 0;
+	EXPECT_EQ(spThreadPool->AddPeriodicTask(m_spTask, std::chrono::milliseconds(10), MsvPeriodicMode::MSV_PERIODIC_FIXED_RATE, MsvMissedTickPolicy::MSV_MISSED_TICK_SKIP, &fixedRateId), MSV_SUCCESS);
+	EXPECT_EQ(spThreadPool->AddPeriodicTask(spFixedDelayTask, std::chrono::milliseconds(10), MsvPeriodicMode::MSV_PERIODIC_FIXED_DELAY, MsvMissedTickPolicy::MSV_MISSED_TICK_SKIP, &fixedDelayId), MSV_SUCCESS);
+	EXPECT_NE(fixedRateId, fixedDelayId);
+
+	{
+		using namespace std::chrono_literals;
+		std::this_thread::sleep_for(205ms);
+	}
+
+	EXPECT_EQ(spThreadPool->CancelPeriodicTask(fixedRateId), MSV_SUCCESS);
+	EXPECT_EQ(spThreadPool->CancelPeriodicTask(fixedDelayId), MSV_SUCCESS);
+	EXPECT_EQ(spThreadPool->CancelPeriodicTask(fixedRateId), MSV_NOT_PENDING_INFO);
+
+	//fixed rate does not drift (scheduler can only miss some ticks)
+	int32_t callCount = m_spTask->GetCallCount();
+	EXPECT_LE(callCount, 21);
+	EXPECT_GE(callCount, 10);
+	EXPECT_GE(spFixedDelayTask->GetCallCount(), 5);
+
+	//execution which was running during cancel could finish
+	{
+		using namespace std::chrono_literals;
+		std::this_thread::sleep_for(20ms);
+	}
+	callCount = m_spTask->GetCallCount();
+
+	{
+		using namespace std::chrono_literals;
+		std::this_thread::sleep_for(50ms);
+	}
+
+	EXPECT_EQ(m_spTask->GetCallCount(), callCount);
+	EXPECT_EQ(spThreadPool->GetDelayedTaskCount(), 0);
+
+	EXPECT_EQ(spThreadPool->StopAndWaitForThreadPoolStop(3000000), MSV_SUCCESS);
+	EXPECT_FALSE(spThreadPool->IsRunning());
+}
+
+TEST_F(MsvThreadPoolTests_Integration, ItShouldReturnResultsOfSubmittedTasks)
+{
+	std::shared_ptr<MsvThreadPool> spThreadPool(new (std::nothrow) MsvThreadPool());
+	EXPECT_NE(spThreadPool, nullptr);
+
+	EXPECT_EQ(spThreadPool->StartThreadPool(4), MSV_SUCCESS);
+	EXPECT_TRUE(spThreadPool->IsRunning());
+
+	std::vector<MsvFuture<int64_t>> futures;
+	for (int64_t i = 0; i < 1000; ++i)
+	{
+		futures.push_back(spThreadPool->Submit([i]() { return i * i; }));
+		EXPECT_TRUE(futures.back().IsValid());
+	}
+
+	MsvFuture<void> exceptionFuture = spThreadPool->Submit([]() { throw std::runtime_error("error"); });
+
+	int64_t sum = 0;
+	for (MsvFuture<int64_t>& future : futures)
+	{
+		sum += future.Get();
+	}
+	EXPECT_EQ(sum, 332833500);
+	EXPECT_THROW(exceptionFuture.Get(), std::runtime_error);
+
+	EXPECT_EQ(spThreadPool->StopAndWaitForThreadPoolStop(3000000), MSV_SUCCESS);
+	EXPECT_FALSE(spThreadPool->IsRunning());
+}
+
+TEST_F(MsvThreadPoolTests_Integration, ItShouldExecuteContinuationsWithoutBlockingWorkers)
+{
+	std::shared_ptr<MsvThreadPool> spThreadPool(new (std::nothrow) MsvThreadPool());
+	EXPECT_NE(spThreadPool, nullptr);
+
+	//one worker would deadlock if any continuation waited for its antecedent
+	EXPECT_EQ(spThreadPool->StartThreadPool(1), MSV_SUCCESS);
+	EXPECT_TRUE(spThreadPool->IsRunning());
+
+	MsvFuture<int32_t> asyncFuture = spThreadPool->Submit([]() { return 0; });
+	MsvFuture<int32_t> inlineFuture = spThreadPool->Submit([]() { return 0; });
+	for (int32_t i = 0; i < 100; ++i)
+	{
+		asyncFuture = asyncFuture.Then([](MsvFuture<int32_t>& antecedent) { return antecedent.Get() + 1; });
+		inlineFuture = inlineFuture.Then([](MsvFuture<int32_t>& antecedent) { return antecedent.Get() + 1; }, MsvContinuationMode::MSV_CONTINUATION_INLINE);
+	}
+
+	EXPECT_EQ(asyncFuture.Get(), 100);
+	EXPECT_EQ(inlineFuture.Get(), 100);
+
+	EXPECT_EQ(spThreadPool->StopAndWaitForThreadPoolStop(3000000), MSV_SUCCESS);
+	EXPECT_FALSE(spThreadPool->IsRunning());
+}
+
+TEST_F(MsvThreadPoolTests_Integration, ItShouldJoinSubmittedTasksWithOneWait)
+{
+	std::shared_ptr<MsvThreadPool> spThreadPool(new (std::nothrow) MsvThreadPool());
+	EXPECT_NE(spThreadPool, nullptr);
+
+	EXPECT_EQ(spThreadPool->StartThreadPool(4), MSV_SUCCESS);
+	EXPECT_TRUE(spThreadPool->IsRunning());
+
+	std::atomic<int32_t> sum(0);
+	std::vector<MsvFuture<void>> futures;
+	for (int32_t i = 0; i < 1000; ++i)
+	{
+		futures.push_back(spThreadPool->Submit([&sum, i]() { sum += i; }));
+	}
+
+	MsvFuture<void> all = MsvWhenAll(futures);
+	MsvFuture<size_t> any = MsvWhenAny(futures);
+
+	EXPECT_TRUE(all.WaitFor(3000000));
+	EXPECT_EQ(sum, 499500);
+	EXPECT_LT(any.Get(), 1000);
+
+	EXPECT_EQ(spThreadPool->StopAndWaitForThreadPoolStop(3000000), MSV_SUCCESS);
+	EXPECT_FALSE(spThreadPool->IsRunning());
+}
+
+TEST_F(MsvThreadPoolTests_Integration, ItShouldNotDeadlockWhenWorkersWaitForNestedTaskGroups)
+{
+	std::shared_ptr<MsvThreadPool> spThreadPool(new (std::nothrow) MsvThreadPool());
+	EXPECT_NE(spThreadPool, nullptr);
+
+	//each worker waits for nested group (blocked workers would never execute nested tasks)
+	EXPECT_EQ(spThreadPool->StartThreadPool(2), MSV_SUCCESS);
+	EXPECT_TRUE(spThreadPool->IsRunning());
+
+	std::atomic<int32_t> counter(0);
+	std::function<void()> innerTask = [&counter]() { ++counter; };
+	std::function<void()> outerTask = [&spThreadPool, &innerTask]()
+	{
+		MsvTaskGroup innerGroup(spThreadPool);
+		for (int32_t i = 0; i < 100; ++i)
+		{
+			EXPECT_EQ(innerGroup.AddTask(innerTask), MSV_SUCCESS);
+		}
+		innerGroup.Wait();
+	};
+
+	MsvTaskGroup group(spThreadPool);
+	for (int32_t i = 0; i < 8; ++i)
+	{
+		EXPECT_EQ(group.AddTask(outerTask), MSV_SUCCESS);
+	}
+	group.Wait();
+
+	EXPECT_EQ(counter, 800);
+
+	EXPECT_EQ(spThreadPool->StopAndWaitForThreadPoolStop(3000000), MSV_SUCCESS);
+	EXPECT_FALSE(spThreadPool->IsRunning());
+}
+
+TEST_F(MsvThreadPoolTests_Integration, ItShouldExecuteTaskGraphRepeatedly)
+{
+	std::shared_ptr<MsvThreadPool> spThreadPool(new (std::nothrow) MsvThreadPool());
+	EXPECT_NE(spThreadPool, nullptr);
+
+	EXPECT_EQ(spThreadPool->StartThreadPool(4), MSV_SUCCESS);
+	EXPECT_TRUE(spThreadPool->IsRunning());
+
+	//layers of nodes, each node depends on two nodes of the previous layer (it checks they have been executed)
+	const size_t layerCount = 100;
+	const size_t layerSize = 100;
+	std::vector<std::atomic<int32_t>> runs(layerCount * layerSize);
+	std::atomic<int32_t> errors(0);
+	int32_t run = 0;
+
+	MsvTaskGraph graph;
+	for (size_t i = 0; i < runs.size(); ++i)
+	{
+		runs[i] = 0;
+		std::function<void()> task = [&runs, &errors, &run, i, layerSize]()
+		{
+			if (i >= layerSize && (runs[i - layerSize] != run || runs[i - layerSize + (i + 1) % layerSize] != run))
+			{
+				++errors;
+			}
+			runs[i] = run;
+		};
+		EXPECT_EQ(graph.AddNode(task), MSV_SUCCESS);
+
+		if (i >= layerSize)
+		{
+			EXPECT_EQ(graph.AddEdge(i - layerSize, i), MSV_SUCCESS);
+			EXPECT_EQ(graph.AddEdge(i - layerSize + (i + 1) % layerSize, i), MSV_SUCCESS);
+		}
+	}
+
+	for (run = 1; run <= 3; ++run)
+	{
+		EXPECT_EQ(graph.Run(spThreadPool), MSV_SUCCESS);
+		graph.Wait();
+		EXPECT_EQ(runs.back(), run);
+	}
+	EXPECT_EQ(errors, 0);
+
+	EXPECT_EQ(spThreadPool->StopAndWaitForThreadPoolStop(3000000), MSV_SUCCESS);
+	EXPECT_FALSE(spThreadPool->IsRunning());
+}
+
+TEST_F(MsvThreadPoolTests_Integration, ItShouldExecuteParallelForWithUnevenIterations)
+{
+	for (bool workStealing : { false, true })
+	{
+		std::shared_ptr<MsvThreadPool> spThreadPool(new (std::nothrow) MsvThreadPool());
+		EXPECT_NE(spThreadPool, nullptr);
+
+		EXPECT_EQ(spThreadPool->SetWorkStealing(workStealing), MSV_SUCCESS);
+		EXPECT_EQ(spThreadPool->StartThreadPool(4), MSV_SUCCESS);
+		EXPECT_TRUE(spThreadPool->IsRunning());
+
+		//the last iterations are much longer (static chunks would be unbalanced)
+		std::vector<std::atomic<int32_t>> executed(10000);
+		for (std::atomic<int32_t>& value : executed)
+		{
+			value = 0;
+		}
+		EXPECT_EQ(MsvParallelFor(spThreadPool, 0, 10000, [&executed](int32_t i)
+		{
+			volatile int32_t work = 0;
+			for (int32_t j = 0; j < (i > 9000 ? 1000 : 10); ++j)
+			{
+				work = work + j;
+			}
+			++executed[i];
+		}), MSV_SUCCESS);
+
+		for (std::atomic<int32_t>& value : executed)
+		{
+			EXPECT_EQ(value, 1);
+		}
+
+		//nested loops are executed by workers (they help while they wait)
+		std::atomic<int32_t> sum(0);
+		EXPECT_EQ(MsvParallelFor(spThreadPool, 0, 100, [&spThreadPool, &sum](int32_t)
+		{
+			EXPECT_EQ(MsvParallelFor(spThreadPool, 0, 100, [&sum](int32_t j) { sum += j; }), MSV_SUCCESS);
+		}), MSV_SUCCESS);
+		EXPECT_EQ(sum, 495000);
+
+		EXPECT_EQ(spThreadPool->StopAndWaitForThreadPoolStop(3000000), MSV_SUCCESS);
+		EXPECT_FALSE(spThreadPool->IsRunning());
+	}
+}
+
+TEST_F(MsvThreadPoolTests_Integration, ItShouldReduceRangeInBothOrders)
+{
+	for (bool workStealing : { false, true })
+	{
+		std::shared_ptr<MsvThreadPool> spThreadPool(new (std::nothrow) MsvThreadPool());
+		EXPECT_NE(spThreadPool, nullptr);
+
+		EXPECT_EQ(spThreadPool->SetWorkStealing(workStealing), MSV_SUCCESS);
+		EXPECT_EQ(spThreadPool->StartThreadPool(4), MSV_SUCCESS);
+		EXPECT_TRUE(spThreadPool->IsRunning());
+
+		std::vector<int64_t> values(100000);
+		for (size_t i = 0; i < values.size(); ++i)
+		{
+			values[i] = static_cast<int64_t>(i);
+		}
+
+		int64_t sum = 0;
+		EXPECT_EQ(MsvParallelReduce(spThreadPool, values.begin(), values.end(), static_cast<int64_t>(0), std::plus<int64_t>(), sum), MSV_SUCCESS);
+		EXPECT_EQ(sum, 4999950000);
+
+		EXPECT_EQ(MsvParallelTransformReduce(spThreadPool, values.begin(), values.end(), static_cast<int64_t>(0), std::plus<int64_t>(),
+			[](int64_t value) { return value % 3; }, sum, MsvReduceOrder::MSV_REDUCE_DETERMINISTIC), MSV_SUCCESS);
+		EXPECT_EQ(sum, 99999);
+
+		//floating point sum is not associative (deterministic order gives always the same bits)
+		double expected = 0.0;
+		EXPECT_EQ(MsvParallelTransformReduce(spThreadPool, 0, 100000, 0.0, std::plus<double>(),
+			[](int32_t i) { return 1.0 / (i + 1); }, expected, MsvReduceOrder::MSV_REDUCE_DETERMINISTIC), MSV_SUCCESS);
+		for (int32_t run = 0; run < 20; ++run)
+		{
+			double result = 0.0;
+			EXPECT_EQ(MsvParallelTransformReduce(spThreadPool, 0, 100000, 0.0, std::plus<double>(),
+				[](int32_t i) { return 1.0 / (i + 1); }, result, MsvReduceOrder::MSV_REDUCE_DETERMINISTIC), MSV_SUCCESS);
+			EXPECT_EQ(result, expected);
+		}
+
+		EXPECT_EQ(spThreadPool->StopAndWaitForThreadPoolStop(3000000), MSV_SUCCESS);
+		EXPECT_FALSE(spThreadPool->IsRunning());
+	}
+}
+
+TEST_F(MsvThreadPoolTests_Integration, ItShouldScanLargeRange)
+{
+	std::shared_ptr<MsvThreadPool> spThreadPool(new (std::nothrow) MsvThreadPool());
+	EXPECT_NE(spThreadPool, nullptr);
+
+	EXPECT_EQ(spThreadPool->SetWorkStealing(true), MSV_SUCCESS);
+	EXPECT_EQ(spThreadPool->StartThreadPool(4), MSV_SUCCESS);
+	EXPECT_TRUE(spThreadPool->IsRunning());
+
+	std::vector<int64_t> values(1000000, 1);
+	std::vector<int64_t> offsets(values.size());
+
+	EXPECT_EQ(MsvParallelExclusiveScan(spThreadPool, values.begin(), values.end(), offsets.begin(), static_cast<int64_t>(0), std::plus<int64_t>()), MSV_SUCCESS);
+	EXPECT_EQ(MsvParallelInclusiveScan(spThreadPool, values.begin(), values.end(), values.begin(), std::plus<int64_t>()), MSV_SUCCESS);
+	for (size_t i = 0; i < values.size(); ++i)
+	{
+		ASSERT_EQ(offsets[i], static_cast<int64_t>(i));
+		ASSERT_EQ(values[i], static_cast<int64_t>(i + 1));
+	}
+
+	EXPECT_EQ(spThreadPool->StopAndWaitForThreadPoolStop(3000000), MSV_SUCCESS);
+	EXPECT_FALSE(spThreadPool->IsRunning());
+}
+
+TEST_F(MsvThreadPoolTests_Integration, ItShouldSortLargeRange)
+{
+	std::shared_ptr<MsvThreadPool> spThreadPool(new (std::nothrow) MsvThreadPool());
+	EXPECT_NE(spThreadPool, nullptr);
+
+	EXPECT_EQ(spThreadPool->SetWorkStealing(true), MSV_SUCCESS);
+	EXPECT_EQ(spThreadPool->StartThreadPool(4), MSV_SUCCESS);
+	EXPECT_TRUE(spThreadPool->IsRunning());
+
+	std::mt19937 generator(7);
+	std::vector<uint32_t> values(1000000);
+	for (uint32_t& value : values)
+	{
+		value = generator();
+	}
+	std::vector<uint32_t> expected = values;
+	std::sort(expected.begin(), expected.end());
+
+	EXPECT_EQ(MsvParallelSort(spThreadPool, values.begin(), values.end()), MSV_SUCCESS);
+	EXPECT_EQ(values, expected);
+
+	EXPECT_EQ(spThreadPool->StopAndWaitForThreadPoolStop(3000000), MSV_SUCCESS);
+	EXPECT_FALSE(spThreadPool->IsRunning());
+}
+
+TEST_F(MsvThreadPoolTests_Integration, ItShouldExecuteRecursiveForkJoin)
+{
+	for (bool workStealing : { false, true })
+	{
+		std::shared_ptr<MsvThreadPool> spThreadPool(new (std::nothrow) MsvThreadPool());
+		EXPECT_NE(spThreadPool, nullptr);
+
+		EXPECT_EQ(spThreadPool->SetWorkStealing(workStealing), MSV_SUCCESS);
+		EXPECT_EQ(spThreadPool->StartThreadPool(4), MSV_SUCCESS);
+		EXPECT_TRUE(spThreadPool->IsRunning());
+
+		//the first level is executed by non-worker thread
+		EXPECT_EQ(ForkJoinFibonacci(*spThreadPool, 27), 196418);
+
+		//recursion inside of worker (it helps while it syncs)
+		std::atomic<int64_t> result(0);
+		std::function<void()> task = [&spThreadPool, &result]() { result = ForkJoinFibonacci(*spThreadPool, 25); };
+		MsvTaskGroup group(spThreadPool);
+		EXPECT_EQ(group.AddTask(task), MSV_SUCCESS);
+		group.Wait();
+		EXPECT_EQ(result, 75025);
+
+		EXPECT_EQ(spThreadPool->StopAndWaitForThreadPoolStop(3000000), MSV_SUCCESS);
+		EXPECT_FALSE(spThreadPool->IsRunning());
+	}
+}
+
+TEST_F(MsvThreadPoolTests_Integration, ItShouldGrowAndRetireElasticWorkers)
+{
+	std::shared_ptr<MsvThreadPool> spThreadPool(new (std::nothrow) MsvThreadPool());
+	EXPECT_NE(spThreadPool, nullptr);
+
+	//one worker at start, up to four workers, idle worker is retired after 20 ms
+	EXPECT_EQ(spThreadPool->SetElasticWorkers(1, 4, 20000, 1000), MSV_SUCCESS);
+	EXPECT_EQ(spThreadPool->StartThreadPool(1), MSV_SUCCESS);
+	EXPECT_EQ(spThreadPool->GetRunningWorkerCount(), 1);
+
+	//tasks wait for each other -> they finish only when four workers run at once
+	std::atomic<int32_t> started(0);
+	std::atomic<int32_t> finished(0);
+	std::function<void()> task = [&started, &finished]()
+	{
+		++started;
+		std::chrono::steady_clock::time_point deadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+		while (started < 4 && std::chrono::steady_clock::now() < deadline)
+		{
+			std::this_thread::sleep_for(std::chrono::milliseconds(1));
+		}
+		++finished;
+	};
+	for (int32_t i = 0; i < 4; ++i)
+	{
+		EXPECT_EQ(spThreadPool->AddTask(task), MSV_SUCCESS);
+	}
+
+	while (finished < 4)
+	{
+		std::this_thread::sleep_for(std::chrono::milliseconds(1));
+	}
+	EXPECT_EQ(started, 4);
+	EXPECT_EQ(spThreadPool->GetRunningWorkerCount(), 4);
+	EXPECT_EQ(spThreadPool->GetWorkerCount(), 4);
+
+	//idle workers are retired (but not below the minimum)
+	std::chrono::steady_clock::time_point deadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+	while (spThreadPool->GetRunningWorkerCount() > 1 && std::chrono::steady_clock::now() < deadline)
+	{
+		std::this_thread::sleep_for(std::chrono::milliseconds(1));
+	}
+	EXPECT_EQ(spThreadPool->GetRunningWorkerCount(), 1);
+
+	//the rest of workers still executes tasks
+	std::atomic<int32_t> executed(0);
+	std::function<void()> counter = [&executed]() { ++executed; };
+	for (int32_t i = 0; i < 100; ++i)
+	{
+		EXPECT_EQ(spThreadPool->AddTask(counter), MSV_SUCCESS);
+	}
+	while (executed < 100)
+	{
+		std::this_thread::sleep_for(std::chrono::milliseconds(1));
+	}
+
+	EXPECT_EQ(spThreadPool->StopAndWaitForThreadPoolStop(3000000), MSV_SUCCESS);
+	EXPECT_FALSE(spThreadPool->IsRunning());
+}
+
+TEST_F(MsvThreadPoolTests_Integration, ItShouldExecuteAllTasksWithHillClimbing)
+{
+	for (int32_t workStealing = 0; workStealing < 2; ++workStealing)
+	{
+		std::shared_ptr<MsvThreadPool> spThreadPool(new (std::nothrow) MsvThreadPool());
+		EXPECT_NE(spThreadPool, nullptr);
+
+		//sample each 5 ms
+		EXPECT_EQ(spThreadPool->SetWorkStealing(workStealing != 0), MSV_SUCCESS);
+		EXPECT_EQ(spThreadPool->SetHillClimbing(true, 5000), MSV_SUCCESS);
+		EXPECT_EQ(spThreadPool->StartThreadPool(4), MSV_SUCCESS);
+		EXPECT_EQ(spThreadPool->GetTargetWorkerCount(), 4);
+
+		//short tasks (there are always queued tasks -> target is climbing)
+		std::atomic<int32_t> executed(0);
+		std::function<void()> task = [&executed]()
+		{
+			std::chrono::steady_clock::time_point end = std::chrono::steady_clock::now() + std::chrono::microseconds(20);
+			while (std::chrono::steady_clock::now() < end);
+			++executed;
+		};
+
+		bool targetChanged = false;
+		int32_t added = 0;
+		std::chrono::steady_clock::time_point deadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+		while ((!targetChanged || added < 10000) && std::chrono::steady_clock::now() < deadline)
+		{
+			if (added - executed < 1000)
+			{
+				for (int32_t i = 0; i < 100; ++i)
+				{
+					EXPECT_EQ(spThreadPool->AddTask(task), MSV_SUCCESS);
+				}
+				added += 100;
+			}
+			else
+			{
+				std::this_thread::sleep_for(std::chrono::microseconds(100));
+			}
+
+			size_t targetWorkers = spThreadPool->GetTargetWorkerCount();
+			EXPECT_GE(targetWorkers, 1);
+			EXPECT_LE(targetWorkers, 4);
+			targetChanged = targetChanged || targetWorkers != 4;
+		}
+		EXPECT_TRUE(targetChanged);
+
+		//parked workers do not block queued tasks
+		while (executed < added)
+		{
+			std::this_thread::sleep_for(std::chrono::milliseconds(1));
+		}
+
+		EXPECT_EQ(spThreadPool->StopAndWaitForThreadPoolStop(3000000), MSV_SUCCESS);
+		EXPECT_EQ(executed, added);
+	}
+}
+
+TEST_F(MsvThreadPoolTests_Integration, ItShouldCompensateWorkersInBlockingScope)
+{
+	std::shared_ptr<MsvThreadPool> spThreadPool(new (std::nothrow) MsvThreadPool());
+	EXPECT_NE(spThreadPool, nullptr);
+
+	EXPECT_EQ(spThreadPool->SetCompensatingWorkers(2), MSV_SUCCESS);
+	EXPECT_EQ(spThreadPool->StartThreadPool(2), MSV_SUCCESS);
+	EXPECT_EQ(spThreadPool->SetCompensatingWorkers(1), MSV_ALREADY_RUNNING_INFO);
+	EXPECT_EQ(spThreadPool->GetWorkerCount(), 4);
+
+	//other threads are not compensated
+	EXPECT_FALSE(spThreadPool->EnterBlockingRegion());
+
+	//both workers block until the last task is executed (it would never be executed without compensation)
+	std::atomic<bool> released(false);
+	std::atomic<int32_t> timedOut(0);
+	std::atomic<int32_t> blocked(0);
+	std::function<void()> blockingTask = [&spThreadPool, &released, &timedOut, &blocked]()
+	{
+		MsvBlockingScope scope(*spThreadPool);
+		MsvBlockingScope nestedScope(*spThreadPool);
+		++blocked;
+
+		std::chrono::steady_clock::time_point deadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+		while (!released && std::chrono::steady_clock::now() < deadline)
+		{
+			std::this_thread::sleep_for(std::chrono::milliseconds(1));
+		}
+		if (!released)
+		{
+			++timedOut;
+		}
+		--blocked;
+	};
+	EXPECT_EQ(spThreadPool->AddTask(blockingTask), MSV_SUCCESS);
+	EXPECT_EQ(spThreadPool->AddTask(blockingTask), MSV_SUCCESS);
+
+	while (blocked < 2)
+	{
+		std::this_thread::sleep_for(std::chrono::milliseconds(1));
+	}
+	std::function<void()> releasingTask = [&released]() { released = true; };
+	EXPECT_EQ(spThreadPool->AddTask(releasingTask), MSV_SUCCESS);
+
+	while (blocked > 0)
+	{
+		std::this_thread::sleep_for(std::chrono::milliseconds(1));
+	}
+	EXPECT_TRUE(released);
+	EXPECT_EQ(timedOut, 0);
+
+	//compensating workers are parked, the rest of workers still executes tasks
+	std::atomic<int32_t> executed(0);
+	std::function<void()> counter = [&executed]() { ++executed; };
+	for (int32_t i = 0; i < 100; ++i)
+	{
+		EXPECT_EQ(spThreadPool->AddTask(counter), MSV_SUCCESS);
+	}
+	while (executed < 100)
+	{
+		std::this_thread::sleep_for(std::chrono::milliseconds(1));
+	}
+
+	EXPECT_EQ(spThreadPool->StopAndWaitForThreadPoolStop(3000000), MSV_SUCCESS);
+}
+
+TEST_F(MsvThreadPoolTests_Integration, ItShouldExecuteTasksWithSpinningIdleWorkers)
+{
+	std::shared_ptr<MsvThreadPool> spThreadPool(new (std::nothrow) MsvThreadPool());
+	EXPECT_NE(spThreadPool, nullptr);
+
+	EXPECT_EQ(spThreadPool->SetIdleStrategy(10000, 100), MSV_SUCCESS);
+	EXPECT_EQ(spThreadPool->StartThreadPool(2), MSV_SUCCESS);
+
+	//one task at a time -> each of them is added to (almost) empty thread pool with spinning worker
+	std::atomic<int32_t> executed(0);
+	std::function<void()> task = [&executed]() { ++executed; };
+	for (int32_t i = 0; i < 1000; ++i)
+	{
+		EXPECT_EQ(spThreadPool->AddTask(task), MSV_SUCCESS);
+		while (executed <= i)
+		{
+			std::this_thread::yield();
+		}
+	}
+
+	//workers park after spin budget -> they still execute tasks after long idle time
+	EXPECT_EQ(spThreadPool->SetIdleStrategy(0, 0), MSV_SUCCESS);
+	std::this_thread::sleep_for(std::chrono::milliseconds(10));
+	EXPECT_EQ(spThreadPool->AddTask(task), MSV_SUCCESS);
+	while (executed < 1001)
+	{
+		std::this_thread::sleep_for(std::chrono::milliseconds(1));
+	}
+
+	EXPECT_EQ(spThreadPool->StopAndWaitForThreadPoolStop(3000000), MSV_SUCCESS);
+	EXPECT_EQ(executed, 1001);
+}
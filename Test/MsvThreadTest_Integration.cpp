@@ -6,6 +6,8 @@
 #include "merror\MsvErrorCodes.h"
 #include "merror\MsvException.h"
 
+#include <atomic>
+
 
 class TestMsvThreadObject:
 	public MsvThread
@@ -22,6 +24,17 @@ public:
 
 	}
 
+	TestMsvThreadObject(std::shared_ptr<MsvIdleWorkerStack> spIdleWorkers):
+		MsvThread(spIdleWorkers),
+		m_HandleCaughtExceptionCalls(0),
+		m_OnThreadStartCalls(0),
+		m_OnThreadStopCalls(0),
+		m_ThreadMainCalls(0),
+		m_throwException(false)
+	{
+
+	}
+
 	TestMsvThreadObject():
 		TestMsvThreadObject(std::shared_ptr<std::condition_variable>(new (std::nothrow) std::condition_variable()), std::shared_ptr<std::mutex>(new (std::nothrow) std::mutex), nullptr/*std::shared_ptr<std::uint64_t>(new (std::nothrow) std::uint64_t(0))*/)
 	{
@@ -60,7 +73,7 @@ public:
 	int32_t m_HandleCaughtExceptionCalls;
 	int32_t m_OnThreadStartCalls;
 	int32_t m_OnThreadStopCalls;
-	int32_t m_ThreadMainCalls;
+	std::atomic<int32_t> m_ThreadMainCalls;
 
 	bool m_throwException;
 };
@@ -202,6 +215,36 @@ TEST_F(MsvThreadTests_Integration, ItShouldExecuteInLoopWhenPositiveTimeoutIsSet
 	EXPECT_GT(m_spThread->m_ThreadMainCalls, 1);
 }
 
+TEST_F(MsvThreadTests_Integration, NotifyShouldWakeOnlyNotifiedThreadWithIdleWorkerStack)
+{
+	std::shared_ptr<MsvIdleWorkerStack> spIdleWorkers(new (std::nothrow) MsvIdleWorkerStack());
+	std::shared_ptr<TestMsvThreadObject> spThread1(new (std::nothrow) TestMsvThreadObject(spIdleWorkers));
+	std::shared_ptr<TestMsvThreadObject> spThread2(new (std::nothrow) TestMsvThreadObject(spIdleWorkers));
+
+	EXPECT_EQ(spThread1->StartThread(0), MSV_SUCCESS);
+	EXPECT_EQ(spThread2->StartThread(0), MSV_SUCCESS);
+	while (spIdleWorkers->GetIdleCount() < 2)
+	{
+		std::this_thread::sleep_for(std::chrono::microseconds(100));
+	}
+
+	//notified thread leaves the stack, the other one keeps sleeping
+	spThread1->Notify();
+	while (spThread1->m_ThreadMainCalls < 2 || spIdleWorkers->GetIdleCount() < 2)
+	{
+		std::this_thread::sleep_for(std::chrono::microseconds(100));
+	}
+
+	EXPECT_EQ(spThread1->StopAndWaitForThreadStop(3000000), MSV_SUCCESS);
+	EXPECT_EQ(spThread2->StopAndWaitForThreadStop(3000000), MSV_SUCCESS);
+
+	EXPECT_FALSE(spThread1->IsRunning());
+	EXPECT_FALSE(spThread2->IsRunning());
+	EXPECT_EQ(spThread1->m_ThreadMainCalls, 2);
+	EXPECT_EQ(spThread2->m_ThreadMainCalls, 1);
+	EXPECT_EQ(spIdleWorkers->GetIdleCount(), 0);
+}
+
 TEST_F(MsvThreadTests_Integration, ItShouldFailedWhenSharedConditionIsNull)
 {
 	m_spThread->SetSharedConditionVariable(nullptr);
@@ -0,0 +1,165 @@
+#include "pch.h"
+
+
+#include "mthreading\MsvTimerWheel.h"
+
+#include "mthreading\Mocks\MsvTask_Mock.h"
+
+
+using namespace ::testing;
+
+
+class MsvTimerWheelTests:
+	public::testing::Test
+{
+public:
+	MsvTimerWheelTests()
+	{
+
+	}
+
+	virtual void SetUp()
+	{
+		m_spTask1.reset(new (std::nothrow) MsvTask_Mock());
+		m_spTask2.reset(new (std::nothrow) MsvTask_Mock());
+		m_spTask3.reset(new (std::nothrow) MsvTask_Mock());
+
+		EXPECT_NE(m_spTask1, nullptr);
+		EXPECT_NE(m_spTask2, nullptr);
+		EXPECT_NE(m_spTask3, nullptr);
+	}
+
+	virtual void TearDown()
+	{
+		m_spTask1.reset();
+		m_spTask2.reset();
+		m_spTask3.reset();
+	}
+
+	//returns time of tick (wheel has 1 ms resolution)
+	std::chrono::steady_clock::time_point GetTime(uint64_t tick)
+	{
+		return m_start + std::chrono::milliseconds(tick);
+	}
+
+	//mocks
+	std::shared_ptr<MsvTask_Mock> m_spTask1;
+	std::shared_ptr<MsvTask_Mock> m_spTask2;
+	std::shared_ptr<MsvTask_Mock> m_spTask3;
+
+	//wheel start time
+	std::chrono::steady_clock::time_point m_start = std::chrono::steady_clock::now();
+};
+
+TEST_F(MsvTimerWheelTests, ItShouldBeEmptyAfterCreate)
+{
+	MsvTimerWheel wheel(1000, m_start);
+	std::vector<std::shared_ptr<IMsvTask>> expiredTasks;
+
+	EXPECT_EQ(wheel.GetSize(), 0);
+	EXPECT_EQ(wheel.GetResolution(), 1000);
+	EXPECT_EQ(wheel.Advance(GetTime(100), expiredTasks), 0);
+	EXPECT_TRUE(expiredTasks.empty());
+}
+
+TEST_F(MsvTimerWheelTests, ItShouldExpireTimerWhenItsTickElapsed)
+{
+	MsvTimerWheel wheel(1000, m_start);
+	std::vector<std::shared_ptr<IMsvTask>> expiredTasks;
+	uint64_t timerId1 = 0;
+	uint64_t timerId2 = 0;
+
+	EXPECT_TRUE(wheel.AddTimer(m_spTask1, GetTime(10), timerId1));
+	EXPECT_TRUE(wheel.AddTimer(m_spTask2, GetTime(5), timerId2));
+	EXPECT_NE(timerId1, timerId2);
+	EXPECT_EQ(wheel.GetSize(), 2);
+
+	EXPECT_EQ(wheel.Advance(GetTime(4), expiredTasks), 0);
+	EXPECT_EQ(wheel.Advance(GetTime(5), expiredTasks), 1);
+	EXPECT_EQ(expiredTasks.size(), 1);
+	EXPECT_EQ(expiredTasks[0], m_spTask2);
+
+	EXPECT_EQ(wheel.Advance(GetTime(10), expiredTasks), 1);
+	EXPECT_EQ(expiredTasks.size(), 2);
+	EXPECT_EQ(expiredTasks[1], m_spTask1);
+	EXPECT_EQ(wheel.GetSize(), 0);
+}
+
+TEST_F(MsvTimerWheelTests, ItShouldCascadeTimersFromHigherLevels)
+{
+	MsvTimerWheel wheel(1000, m_start);
+	std::vector<std::shared_ptr<IMsvTask>> expiredTasks;
+	uint64_t timerId = 0;
+
+	//level 1, level 2 and level 3 timers
+	EXPECT_TRUE(wheel.AddTimer(m_spTask1, GetTime(100), timerId));
+	EXPECT_TRUE(wheel.AddTimer(m_spTask2, GetTime(5000), timerId));
+	EXPECT_TRUE(wheel.AddTimer(m_spTask3, GetTime(300000), timerId));
+
+	EXPECT_EQ(wheel.Advance(GetTime(99), expiredTasks), 0);
+	EXPECT_EQ(wheel.Advance(GetTime(100), expiredTasks), 1);
+	EXPECT_EQ(wheel.Advance(GetTime(4999), expiredTasks), 0);
+	EXPECT_EQ(wheel.Advance(GetTime(5000), expiredTasks), 1);
+	EXPECT_EQ(wheel.Advance(GetTime(299999), expiredTasks), 0);
+	EXPECT_EQ(wheel.Advance(GetTime(300000), expiredTasks), 1);
+
+	EXPECT_EQ(expiredTasks.size(), 3);
+	EXPECT_EQ(expiredTasks[0], m_spTask1);
+	EXPECT_EQ(expiredTasks[1], m_spTask2);
+	EXPECT_EQ(expiredTasks[2], m_spTask3);
+}
+
+TEST_F(MsvTimerWheelTests, ItShouldNotExpireCancelledTimer)
+{
+	MsvTimerWheel wheel(1000, m_start);
+	std::vector<std::shared_ptr<IMsvTask>> expiredTasks;
+	uint64_t timerId1 = 0;
+	uint64_t timerId2 = 0;
+
+	EXPECT_TRUE(wheel.AddTimer(m_spTask1, GetTime(10), timerId1));
+	EXPECT_TRUE(wheel.AddTimer(m_spTask2, GetTime(10), timerId2));
+
+	EXPECT_TRUE(wheel.CancelTimer(timerId1));
+	EXPECT_FALSE(wheel.CancelTimer(timerId1));
+	EXPECT_EQ(wheel.GetSize(), 1);
+
+	EXPECT_EQ(wheel.Advance(GetTime(10), expiredTasks), 1);
+	EXPECT_EQ(expiredTasks.size(), 1);
+	EXPECT_EQ(expiredTasks[0], m_spTask2);
+
+	//expired timer can't be cancelled
+	EXPECT_FALSE(wheel.CancelTimer(timerId2));
+}
+
+TEST_F(MsvTimerWheelTests, ItShouldNotCancelReusedTimerByStaleIdentifier)
+{
+	MsvTimerWheel wheel(1000, m_start);
+	uint64_t timerId1 = 0;
+	uint64_t timerId2 = 0;
+
+	EXPECT_TRUE(wheel.AddTimer(m_spTask1, GetTime(10), timerId1));
+	EXPECT_TRUE(wheel.CancelTimer(timerId1));
+
+	//the same timer is reused with new generation
+	EXPECT_TRUE(wheel.AddTimer(m_spTask2, GetTime(10), timerId2));
+	EXPECT_NE(timerId1, timerId2);
+
+	EXPECT_FALSE(wheel.CancelTimer(timerId1));
+	EXPECT_EQ(wheel.GetSize(), 1);
+	EXPECT_TRUE(wheel.CancelTimer(timerId2));
+	EXPECT_EQ(wheel.GetSize(), 0);
+}
+
+TEST_F(MsvTimerWheelTests, ItShouldExpireTimerFromThePastInTheNextTick)
+{
+	MsvTimerWheel wheel(1000, m_start);
+	std::vector<std::shared_ptr<IMsvTask>> expiredTasks;
+	uint64_t timerId = 0;
+
+	EXPECT_EQ(wheel.Advance(GetTime(20), expiredTasks), 0);
+	EXPECT_TRUE(wheel.AddTimer(m_spTask1, GetTime(10), timerId));
+
+	EXPECT_EQ(wheel.Advance(GetTime(20), expiredTasks), 0);
+	EXPECT_EQ(wheel.Advance(GetTime(21), expiredTasks), 1);
+	EXPECT_EQ(expiredTasks[0], m_spTask1);
+}
@@ -0,0 +1,89 @@
+#include "pch.h"
+
+
+#include "mthreading\MsvWhen.h"
+#include "merror\MsvErrorCodes.h"
+
+#include <vector>
+
+
+using namespace ::testing;
+
+
+class MsvWhenTests:
+	public::testing::Test
+{
+public:
+	MsvWhenTests()
+	{
+
+	}
+
+	virtual void SetUp()
+	{
+		for (int32_t i = 0; i < 3; ++i)
+		{
+			std::shared_ptr<MsvFutureTask<int32_t, std::function<int32_t()>>> spTask(new (std::nothrow) MsvFutureTask<int32_t, std::function<int32_t()>>([i]() { return i; }));
+			EXPECT_NE(spTask, nullptr);
+
+			m_tasks.push_back(spTask);
+			m_futures.push_back(MsvFuture<int32_t>(spTask));
+		}
+	}
+
+	virtual void TearDown()
+	{
+		m_futures.clear();
+		m_tasks.clear();
+	}
+
+	//tasks and their futures
+	std::vector<std::shared_ptr<IMsvTask>> m_tasks;
+	std::vector<MsvFuture<int32_t>> m_futures;
+};
+
+TEST_F(MsvWhenTests, WhenAllShouldBeReadyWhenAllFuturesAreReady)
+{
+	MsvFuture<void> all = MsvWhenAll(m_futures);
+	EXPECT_TRUE(all.IsValid());
+
+	m_tasks[2]->Execute();
+	m_tasks[0]->Execute();
+	EXPECT_FALSE(all.IsReady());
+
+	m_tasks[1]->Execute();
+	EXPECT_TRUE(all.IsReady());
+	EXPECT_NO_THROW(all.Get());
+}
+
+TEST_F(MsvWhenTests, WhenAllShouldBeReadyImmediatelyWhenFuturesAreReadyOrEmpty)
+{
+	for (std::shared_ptr<IMsvTask>& spTask: m_tasks)
+	{
+		spTask->Execute();
+	}
+
+	EXPECT_TRUE(MsvWhenAll(m_futures).IsReady());
+	EXPECT_TRUE(MsvWhenAll(std::vector<MsvFuture<int32_t>>()).IsReady());
+}
+
+TEST_F(MsvWhenTests, WhenAnyShouldReturnIndexOfTheFirstReadyFuture)
+{
+	MsvFuture<size_t> any = MsvWhenAny(m_futures);
+	EXPECT_TRUE(any.IsValid());
+	EXPECT_FALSE(any.IsReady());
+
+	m_tasks[1]->Execute();
+	m_tasks[0]->Execute();
+
+	EXPECT_TRUE(any.IsReady());
+	EXPECT_EQ(any.Get(), 1);
+}
+
+TEST_F(MsvWhenTests, WhenAnyShouldNotBeValidForEmptyFutures)
+{
+	MsvFuture<size_t> any = MsvWhenAny(std::vector<MsvFuture<int32_t>>());
+
+	EXPECT_FALSE(any.IsValid());
+	EXPECT_EQ(any.GetErrorCode(), MSV_INVALID_DATA_ERROR);
+}
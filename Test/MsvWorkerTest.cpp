@@ -3,6 +3,7 @@
 
 
 #include "mthreading\MsvWorker.h"
+#include "mthreading\MsvThreadingErrorCodes.h"
 #include "merror\MsvErrorCodes.h"
 
 #include "mthreading\Mocks\MsvWorker_Factory_Mock.h"
@@ -132,6 +133,22 @@ TEST_F(MsvWorkerTests, AddTaskShouldFailedWhenNullptrIsReturnedForVoidContextFun
 	EXPECT_EQ(m_spWorker->GetTasks().size(), 0);
 }
 
+TEST_F(MsvWorkerTests, ItShouldHaveAllWorksAfterBatchInsertion)
+{
+	std::shared_ptr<MsvTask_Mock> spTask2(new (std::nothrow) MsvTask_Mock());
+	std::vector<std::shared_ptr<MsvTask_Mock>> derivedTasks = { m_spTask, spTask2 };
+
+	EXPECT_EQ(m_spWorker->AddTasks({ m_spTask, nullptr, spTask2 }), MSV_SUCCESS);
+	EXPECT_EQ(m_spWorker->AddTasks(derivedTasks), MSV_SUCCESS);
+	EXPECT_EQ(m_spWorker->AddTasks(derivedTasks.begin(), derivedTasks.begin() + 1), MSV_SUCCESS);
+	EXPECT_EQ(m_spWorker->AddTasks(nullptr, 0), MSV_SUCCESS);
+
+	//nullptr task is skipped
+	EXPECT_EQ(m_spWorker->GetTasks().size(), 5);
+	EXPECT_EQ(m_spWorker->GetTasks().front(), m_spTask);
+	EXPECT_EQ(m_spWorker->GetTasks().back(), m_spTask);
+}
+
 TEST_F(MsvWorkerTests, ItShouldCallExecuteMethodOfAllInsertedWorks)
 {
 	EXPECT_CALL(*m_spWorkerFactoryMock, GetIMsvTask(Matcher<std::function<void()>&>(_)))
@@ -155,3 +172,35 @@ TEST_F(MsvWorkerTests, ItShouldCallExecuteMethodOfAllInsertedWorks)
 
 	EXPECT_EQ(m_spWorker->GetTasks().size(), 0);
 }
+
+TEST_F(MsvWorkerTests, ItShouldApplyQueueFullPolicyWhenTaskQueueIsFull)
+{
+	std::shared_ptr<MsvTask_Mock> spTask2(new (std::nothrow) MsvTask_Mock());
+	std::shared_ptr<MsvTask_Mock> spTask3(new (std::nothrow) MsvTask_Mock());
+
+	EXPECT_EQ(m_spWorker->SetTaskQueueCapacity(2), MSV_SUCCESS);
+	EXPECT_EQ(m_spWorker->SetQueueFullPolicy(MsvQueueFullPolicy::MSV_QUEUE_FULL_REJECT), MSV_SUCCESS);
+	EXPECT_EQ(m_spWorker->AddTasks({ m_spTask, spTask2 }), MSV_SUCCESS);
+	EXPECT_EQ(m_spWorker->AddTask(spTask3), MSV_QUEUE_FULL_ERROR);
+	EXPECT_EQ(m_spWorker->GetTasks().size(), 2);
+
+	//the oldest task is replaced
+	EXPECT_EQ(m_spWorker->SetQueueFullPolicy(MsvQueueFullPolicy::MSV_QUEUE_FULL_DROP_OLDEST), MSV_SUCCESS);
+	EXPECT_EQ(m_spWorker->AddTask(spTask3), MSV_SUCCESS);
+	EXPECT_EQ(m_spWorker->GetTasks().size(), 2);
+	EXPECT_EQ(m_spWorker->GetTasks().front(), spTask2);
+	EXPECT_EQ(m_spWorker->GetTasks().back(), spTask3);
+
+	//task is executed by caller
+	EXPECT_CALL(*m_spTask, Execute())
+		.Times(1);
+	EXPECT_EQ(m_spWorker->SetQueueFullPolicy(MsvQueueFullPolicy::MSV_QUEUE_FULL_CALLER_RUNS), MSV_SUCCESS);
+	EXPECT_EQ(m_spWorker->AddTask(m_spTask), MSV_SUCCESS);
+	EXPECT_EQ(m_spWorker->GetTasks().size(), 2);
+
+	//nobody makes free space
+	EXPECT_EQ(m_spWorker->SetQueueFullPolicy(MsvQueueFullPolicy::MSV_QUEUE_FULL_BLOCK, 1000), MSV_SUCCESS);
+	EXPECT_EQ(m_spWorker->AddTask(m_spTask), MSV_QUEUE_FULL_ERROR);
+
+	EXPECT_EQ(m_spWorker->GetQueueFullCount(), 4);
+}
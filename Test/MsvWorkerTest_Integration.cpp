@@ -216,3 +216,53 @@ TEST_F(MsvWorkerTests_Integration, ItShouldExecuteAllRegisteredFunctionsWithCont
 
 	EXPECT_EQ(GetCallCount(), 20);
 }
+
+TEST_F(MsvWorkerTests_Integration, ItShouldExecuteAllTasksAddedInBatch)
+{
+	std::shared_ptr<IMsvWorker> spWorker(new (std::nothrow) MsvWorker());
+	EXPECT_NE(spWorker, nullptr);
+
+	std::vector<std::shared_ptr<IMsvTask>> tasks(1000, m_spTask);
+
+	//tasks can be added before start
+	EXPECT_EQ(spWorker->AddTasks(tasks), MSV_SUCCESS);
+
+	EXPECT_EQ(spWorker->StartThread(0), MSV_SUCCESS);
+	EXPECT_TRUE(spWorker->IsRunning());
+
+	EXPECT_EQ(spWorker->AddTasks(tasks.begin(), tasks.end()), MSV_SUCCESS);
+
+	//wait for all tasks execution
+	for (int32_t i = 0; i < 100 && m_spTask->GetCallCount() < 2000; ++i)
+	{
+		using namespace std::chrono_literals;
+		std::this_thread::sleep_for(50ms);
+	}
+
+	EXPECT_EQ(spWorker->StopAndWaitForThreadStop(3000000), MSV_SUCCESS);
+
+	EXPECT_EQ(m_spTask->GetCallCount(), 2000);
+}
+
+TEST_F(MsvWorkerTests_Integration, ItShouldReturnResultsOfSubmittedTasks)
+{
+	std::shared_ptr<IMsvWorker> spWorker(new (std::nothrow) MsvWorker());
+	EXPECT_NE(spWorker, nullptr);
+
+	EXPECT_EQ(spWorker->StartThread(0), MSV_SUCCESS);
+	EXPECT_TRUE(spWorker->IsRunning());
+
+	std::vector<MsvFuture<int32_t>> futures;
+	for (int32_t i = 0; i < 100; ++i)
+	{
+		futures.push_back(spWorker->Submit([i]() { return i * i; }));
+		EXPECT_TRUE(futures.back().IsValid());
+	}
+
+	for (int32_t i = 0; i < 100; ++i)
+	{
+		EXPECT_EQ(futures[i].Get(), i * i);
+	}
+
+	EXPECT_EQ(spWorker->StopAndWaitForThreadStop(3000000), MSV_SUCCESS);
+}